@@ -0,0 +1,207 @@
+/**
+ * File: jsonarena_stress.c
+ * Author: Diego Parrilla Santamaría
+ * Date: October 2026
+ * Copyright: 2026 - GOODDATA LABS SL
+ * Description: Host stress test for the cJSON arena. Runs thousands of
+ * catalog installs in the main loop context, preempted by config saves in the
+ * IRQ context, and checks every tree parsed and the heap traffic. The sizes
+ * are the host ones: a cJSON node takes 64 bytes here and 40 on the RP2040.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// The firmware logs through DPRINTF from debug.h, which needs the SDK
+#define DEBUG_H
+#define DPRINTF(fmt, ...)
+
+#include "../src/jsonarena.c"
+
+#define STRESS_CYCLES 5000
+#define STRESS_PREEMPT_EVERY 97  // Task allocations between two config saves
+#define STRESS_MAX_SETTINGS 12
+#define STRESS_IRQ_EXCEPTION 31  // Any IRQ: only zero or not matters
+
+unsigned int host_current_exception = 0;
+
+static unsigned long task_allocations = 0;
+static unsigned long heap_allocations = 0;
+static unsigned long config_saves = 0;
+static unsigned long errors = 0;
+
+static void *stress_malloc(size_t size);
+static void stress_free(void *ptr);
+
+static void *heap_malloc(size_t size) {
+  heap_allocations++;
+  return malloc(size);
+}
+
+static char *read_file(const char *path) {
+  FILE *file = fopen(path, "rb");
+  if (file == NULL) {
+    return NULL;
+  }
+  fseek(file, 0, SEEK_END);
+  long size = ftell(file);
+  fseek(file, 0, SEEK_SET);
+  char *data = malloc((size_t)size + 1);
+  if (data != NULL && fread(data, 1, (size_t)size, file) == (size_t)size) {
+    data[size] = '\0';
+  } else {
+    free(data);
+    data = NULL;
+  }
+  fclose(file);
+  return data;
+}
+
+// The JSON posted to saveparams, as the config pages build it
+static void build_settings(char *json, size_t size, int count, int seed) {
+  size_t len = (size_t)snprintf(json, size, "[");
+  for (int i = 0; i < count; i++) {
+    len += (size_t)snprintf(json + len, size - len,
+                            "%s{\"name\":\"SETTING_%02d\",\"type\":\"STRING\","
+                            "\"value\":\"value-%d-%d\"}",
+                            i == 0 ? "" : ",", i, seed, i);
+  }
+  snprintf(json + len, size - len, "]");
+}
+
+// cgi_saveparams: parse, check every setting, delete and reset
+static void config_save(int seed) {
+  unsigned int previous = host_current_exception;
+  host_current_exception = STRESS_IRQ_EXCEPTION;
+  char json[4096];
+  int count = seed % STRESS_MAX_SETTINGS + 1;
+  build_settings(json, sizeof(json), count, seed);
+  cJSON *root = cJSON_Parse(json);
+  int index = 0;
+  cJSON *item = NULL;
+  cJSON_ArrayForEach(item, root) {
+    char name[32];
+    char value[32];
+    snprintf(name, sizeof(name), "SETTING_%02d", index);
+    snprintf(value, sizeof(value), "value-%d-%d", seed, index);
+    cJSON *n = cJSON_GetObjectItem(item, "name");
+    cJSON *v = cJSON_GetObjectItem(item, "value");
+    if (!cJSON_IsString(n) || !cJSON_IsString(v) ||
+        strcmp(n->valuestring, name) != 0 ||
+        strcmp(v->valuestring, value) != 0) {
+      errors++;
+    }
+    index++;
+  }
+  if (root == NULL || index != count) {
+    errors++;
+  }
+  cJSON_Delete(root);
+  jsonarena_reset();
+  if (arenas[JSONARENA_CONTEXT_IRQ].stats.used != 0) {
+    errors++;
+  }
+  config_saves++;
+  host_current_exception = previous;
+}
+
+// Every few allocations of the main loop, the lwIP IRQ saves the config
+static void *stress_malloc(size_t size) {
+  if (__get_current_exception() == 0 &&
+      ++task_allocations % STRESS_PREEMPT_EVERY == 0) {
+    config_save((int)task_allocations);
+  }
+  return jsonarena_malloc(size);
+}
+
+static void stress_free(void *ptr) { jsonarena_free(ptr); }
+
+// catalog_build_index: parse, print every app, delete and reset
+static int catalog_install(const char *catalog, char **expected, int apps) {
+  cJSON *root = cJSON_Parse(catalog);
+  cJSON *app = NULL;
+  int index = 0;
+  cJSON_ArrayForEach(app, cJSON_GetObjectItem(root, "apps")) {
+    char *object = cJSON_PrintUnformatted(app);
+    if (object == NULL || index >= apps || strcmp(object, expected[index])) {
+      errors++;
+    }
+    cJSON_free(object);
+    index++;
+  }
+  if (root == NULL || index != apps) {
+    errors++;
+  }
+  cJSON_Delete(root);
+  jsonarena_reset();
+  return index;
+}
+
+static void print_stats(const char *name, jsonarena_context_t context) {
+  const jsonarena_stats_t *stats = jsonarena_get_stats(context);
+  printf(
+      "%s arena: %lu bytes, high water %lu, resets %lu, leaks %lu, "
+      "overflows %lu (%lu bytes)\n",
+      name, (unsigned long)arenas[context].size,
+      (unsigned long)stats->high_water, (unsigned long)stats->resets,
+      (unsigned long)stats->leaks, (unsigned long)stats->overflows,
+      (unsigned long)stats->overflow_bytes);
+}
+
+int main(int argc, char **argv) {
+  const char *path = argc > 1 ? argv[1] : "../../appsremote/apps.json";
+  char *catalog = read_file(path);
+  if (catalog == NULL) {
+    fprintf(stderr, "Cannot read %s\n", path);
+    return 1;
+  }
+
+  // Reference output and heap traffic of one install with plain malloc
+  cJSON_Hooks heap_hooks = {.malloc_fn = heap_malloc, .free_fn = free};
+  cJSON_InitHooks(&heap_hooks);
+  cJSON *root = cJSON_Parse(catalog);
+  cJSON *apps = cJSON_GetObjectItem(root, "apps");
+  int count = cJSON_GetArraySize(apps);
+  char **expected = calloc((size_t)count, sizeof(char *));
+  for (int i = 0; i < count; i++) {
+    expected[i] = cJSON_PrintUnformatted(cJSON_GetArrayItem(apps, i));
+  }
+  cJSON_Delete(root);
+  unsigned long heap_per_install = heap_allocations;
+  heap_allocations = 0;
+  char json[4096];
+  build_settings(json, sizeof(json), STRESS_MAX_SETTINGS, 0);
+  cJSON_Delete(cJSON_Parse(json));
+  unsigned long heap_per_save = heap_allocations;
+
+  cJSON_Hooks stress_hooks = {.malloc_fn = stress_malloc,
+                              .free_fn = stress_free};
+  cJSON_InitHooks(&stress_hooks);
+  for (int cycle = 0; cycle < STRESS_CYCLES; cycle++) {
+    catalog_install(catalog, expected, count);
+  }
+
+  printf("%d installs of %s (%d apps), %lu config saves preempting them\n",
+         STRESS_CYCLES, path, count, config_saves);
+  print_stats("Task", JSONARENA_CONTEXT_TASK);
+  print_stats("IRQ", JSONARENA_CONTEXT_IRQ);
+  printf("Heap allocations without the arena: %lu per install, %lu per save\n",
+         heap_per_install, heap_per_save);
+  printf(
+      "Heap allocations with the arena: %.1f per install, %.1f per save\n",
+      (double)jsonarena_get_stats(JSONARENA_CONTEXT_TASK)->overflows /
+          STRESS_CYCLES,
+      (double)jsonarena_get_stats(JSONARENA_CONTEXT_IRQ)->overflows /
+          (config_saves ? config_saves : 1));
+  printf("Errors: %lu\n", errors);
+
+  for (int i = 0; i < count; i++) {
+    free(expected[i]);
+  }
+  free(expected);
+  free(catalog);
+  bool leaked = jsonarena_get_stats(JSONARENA_CONTEXT_TASK)->leaks ||
+                jsonarena_get_stats(JSONARENA_CONTEXT_IRQ)->leaks;
+  return (errors == 0 && !leaked) ? 0 : 1;
+}
@@ -0,0 +1,286 @@
+/**
+ * File: jsontok_bench.c
+ * Author: Diego Parrilla Santamaría
+ * Date: October 2026
+ * Copyright: 2026 - GOODDATA LABS SL
+ * Description: Host benchmark of the app JSON parsing. Reads the fields of
+ * set_app_info() from every app of a catalog with cJSON, as the app manager
+ * did, and with jsontok, and compares the parse time, the peak heap and the
+ * fields read. The times are the host ones, only the ratio is meaningful.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "cjson/cJSON.h"
+#include "jsontok.h"
+
+#define BENCH_ROUNDS 20000
+#define BENCH_MAX_TOKENS 128  // APPMNGR_JSON_MAX_TOKENS
+#define BENCH_MAX_ITEMS 6     // MAX_TAGS and MAX_DEVICES
+
+// The string fields of app_info_t read by set_app_info()
+typedef struct {
+  char uuid[37];
+  char name[64];
+  char description[512];
+  char image[128];
+  char tags[BENCH_MAX_ITEMS][32];
+  char devices[BENCH_MAX_ITEMS][32];
+  char binary[256];
+  char md5[34];
+  char version[32];
+  int tags_count;
+  int devices_count;
+} bench_app_t;
+
+// Heap accounting of the cJSON hooks. Every block starts with its size.
+typedef struct {
+  size_t size;
+  size_t reserved;
+} bench_block_t;
+
+static size_t heap_used = 0;
+static size_t heap_peak = 0;
+static unsigned long heap_allocations = 0;
+
+static void *bench_malloc(size_t size) {
+  bench_block_t *block = malloc(sizeof(bench_block_t) + size);
+  if (block == NULL) {
+    return NULL;
+  }
+  block->size = size;
+  heap_used += size;
+  heap_allocations++;
+  if (heap_used > heap_peak) {
+    heap_peak = heap_used;
+  }
+  return block + 1;
+}
+
+static void bench_free(void *ptr) {
+  if (ptr == NULL) {
+    return;
+  }
+  bench_block_t *block = (bench_block_t *)ptr - 1;
+  heap_used -= block->size;
+  free(block);
+}
+
+static double bench_now_us(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec * 1e6 + ts.tv_nsec / 1e3;
+}
+
+static char *read_file(const char *path) {
+  FILE *file = fopen(path, "rb");
+  if (file == NULL) {
+    return NULL;
+  }
+  fseek(file, 0, SEEK_END);
+  long size = ftell(file);
+  fseek(file, 0, SEEK_SET);
+  char *data = malloc((size_t)size + 1);
+  if (data != NULL && fread(data, 1, (size_t)size, file) == (size_t)size) {
+    data[size] = '\0';
+  } else {
+    free(data);
+    data = NULL;
+  }
+  fclose(file);
+  return data;
+}
+
+// The previous set_app_info(): a cJSON tree and snprintf of each string
+static void cjson_copy_string(cJSON *root, const char *key, char *out,
+                              size_t out_len) {
+  cJSON *item = cJSON_GetObjectItem(root, key);
+  if (cJSON_IsString(item)) {
+    snprintf(out, out_len, "%s", item->valuestring);
+  }
+}
+
+static int cjson_copy_array(cJSON *root, const char *key, char *out,
+                            size_t item_len) {
+  int items = 0;
+  cJSON *item = NULL;
+  cJSON_ArrayForEach(item, cJSON_GetObjectItem(root, key)) {
+    if (items >= BENCH_MAX_ITEMS) {
+      break;
+    }
+    if (cJSON_IsString(item)) {
+      snprintf(out + items * item_len, item_len, "%s", item->valuestring);
+      items++;
+    }
+  }
+  return items;
+}
+
+static int cjson_read_app(const char *json, bench_app_t *app) {
+  cJSON *root = cJSON_Parse(json);
+  if (root == NULL) {
+    return -1;
+  }
+  cjson_copy_string(root, "uuid", app->uuid, sizeof(app->uuid));
+  cjson_copy_string(root, "name", app->name, sizeof(app->name));
+  cjson_copy_string(root, "description", app->description,
+                    sizeof(app->description));
+  cjson_copy_string(root, "image", app->image, sizeof(app->image));
+  app->tags_count =
+      cjson_copy_array(root, "tags", &app->tags[0][0], sizeof(app->tags[0]));
+  app->devices_count = cjson_copy_array(root, "devices", &app->devices[0][0],
+                                        sizeof(app->devices[0]));
+  cjson_copy_string(root, "binary", app->binary, sizeof(app->binary));
+  cjson_copy_string(root, "md5", app->md5, sizeof(app->md5));
+  cjson_copy_string(root, "version", app->version, sizeof(app->version));
+  cJSON_Delete(root);
+  return 0;
+}
+
+// The current set_app_info(): tokens in a fixed pool, strings copied once
+static void jsontok_copy_member(const char *json, const jsontok_t *tokens,
+                                int count, const char *key, char *out,
+                                size_t out_len) {
+  int value = jsontok_find(json, tokens, count, 0, key);
+  if (jsontok_is_string(tokens, value)) {
+    jsontok_copy_string(json, &tokens[value], out, out_len);
+  }
+}
+
+static int jsontok_copy_array(const char *json, const jsontok_t *tokens,
+                              int count, const char *key, char *out,
+                              size_t item_len) {
+  int array = jsontok_find(json, tokens, count, 0, key);
+  if (array < 0 || tokens[array].type != JSONTOK_ARRAY) {
+    return 0;
+  }
+  int items = 0;
+  int i = array + 1;
+  for (int n = 0; n < tokens[array].size && items < BENCH_MAX_ITEMS; n++) {
+    if (jsontok_is_string(tokens, i)) {
+      jsontok_copy_string(json, &tokens[i], out + items * item_len, item_len);
+      items++;
+    }
+    i = jsontok_skip(tokens, count, i);
+  }
+  return items;
+}
+
+static int jsontok_read_app(const char *json, bench_app_t *app) {
+  jsontok_t tokens[BENCH_MAX_TOKENS];
+  int count = jsontok_parse(json, strlen(json), tokens, BENCH_MAX_TOKENS);
+  if (count < 1 || tokens[0].type != JSONTOK_OBJECT) {
+    return -1;
+  }
+  jsontok_copy_member(json, tokens, count, "uuid", app->uuid,
+                      sizeof(app->uuid));
+  jsontok_copy_member(json, tokens, count, "name", app->name,
+                      sizeof(app->name));
+  jsontok_copy_member(json, tokens, count, "description", app->description,
+                      sizeof(app->description));
+  jsontok_copy_member(json, tokens, count, "image", app->image,
+                      sizeof(app->image));
+  app->tags_count = jsontok_copy_array(json, tokens, count, "tags",
+                                       &app->tags[0][0], sizeof(app->tags[0]));
+  app->devices_count =
+      jsontok_copy_array(json, tokens, count, "devices", &app->devices[0][0],
+                         sizeof(app->devices[0]));
+  jsontok_copy_member(json, tokens, count, "binary", app->binary,
+                      sizeof(app->binary));
+  jsontok_copy_member(json, tokens, count, "md5", app->md5, sizeof(app->md5));
+  jsontok_copy_member(json, tokens, count, "version", app->version,
+                      sizeof(app->version));
+  return count;
+}
+
+typedef int (*bench_reader_t)(const char *json, bench_app_t *app);
+
+static double bench_run(bench_reader_t reader, char **apps, int count) {
+  bench_app_t app;
+  double start = bench_now_us();
+  for (int round = 0; round < BENCH_ROUNDS; round++) {
+    for (int i = 0; i < count; i++) {
+      memset(&app, 0, sizeof(app));
+      reader(apps[i], &app);
+    }
+  }
+  return (bench_now_us() - start) / ((double)BENCH_ROUNDS * count);
+}
+
+int main(int argc, char **argv) {
+  const char *path = argc > 1 ? argv[1] : "../../appsremote/apps.json";
+  char *catalog = read_file(path);
+  if (catalog == NULL) {
+    fprintf(stderr, "Cannot read %s\n", path);
+    return 1;
+  }
+
+  // One app JSON per catalog entry, like the UUID.json files of the SD card
+  cJSON *root = cJSON_Parse(catalog);
+  cJSON *list = cJSON_GetObjectItem(root, "apps");
+  int count = cJSON_GetArraySize(list);
+  char **apps = calloc((size_t)count + 1, sizeof(char *));
+  for (int i = 0; i < count; i++) {
+    apps[i] = cJSON_PrintUnformatted(cJSON_GetArrayItem(list, i));
+  }
+  cJSON_Delete(root);
+  free(catalog);
+  // Keys are matched ignoring the case, as cJSON_GetObjectItem() does
+  apps[count++] = strdup(
+      "{\"UUID\":\"44444444-4444-4444-8444-444444444444\",\"Name\":\"Case\","
+      "\"MD5\":\"087904d8391bf6aa9b47945474826071\",\"Tags\":[\"A\",\"B\"]}");
+
+  cJSON_Hooks hooks = {.malloc_fn = bench_malloc, .free_fn = bench_free};
+  cJSON_InitHooks(&hooks);
+
+  int errors = 0;
+  int max_tokens = 0;
+  size_t cjson_peak = 0;
+  unsigned long cjson_allocations = 0;
+  for (int i = 0; i < count; i++) {
+    bench_app_t with_cjson = {0};
+    bench_app_t with_jsontok = {0};
+    heap_peak = heap_used = 0;
+    heap_allocations = 0;
+    if (cjson_read_app(apps[i], &with_cjson) != 0) {
+      errors++;
+    }
+    if (heap_peak > cjson_peak) {
+      cjson_peak = heap_peak;
+    }
+    cjson_allocations += heap_allocations;
+    heap_peak = heap_used = 0;
+    heap_allocations = 0;
+    int tokens = jsontok_read_app(apps[i], &with_jsontok);
+    if (tokens > max_tokens) {
+      max_tokens = tokens;
+    }
+    if (tokens < 0 || heap_allocations != 0 ||
+        memcmp(&with_cjson, &with_jsontok, sizeof(bench_app_t)) != 0) {
+      fprintf(stderr, "App %d: the fields read differ\n", i);
+      errors++;
+    }
+  }
+
+  double cjson_us = bench_run(cjson_read_app, apps, count);
+  double jsontok_us = bench_run(jsontok_read_app, apps, count);
+
+  printf("%d app JSONs of %s, %d rounds\n", count, path, BENCH_ROUNDS);
+  printf("cJSON:   %.2f us per app, peak heap %zu bytes, %.1f mallocs per app\n",
+         cjson_us, cjson_peak, (double)cjson_allocations / count);
+  printf("jsontok: %.2f us per app, peak heap 0 bytes, %d of %d tokens "
+         "(%zu bytes of pool)\n",
+         jsontok_us, max_tokens, BENCH_MAX_TOKENS,
+         sizeof(jsontok_t) * BENCH_MAX_TOKENS);
+  printf("Speedup: %.1fx\n", cjson_us / jsontok_us);
+  printf("Errors: %d\n", errors);
+
+  for (int i = 0; i < count; i++) {
+    free(apps[i]);
+  }
+  free(apps);
+  return errors == 0 ? 0 : 1;
+}
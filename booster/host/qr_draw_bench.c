@@ -0,0 +1,270 @@
+/**
+ * File: qr_draw_bench.c
+ * Author: Diego Parrilla Santamaría
+ * Date: October 2026
+ * Copyright: 2026 - GOODDATA LABS SL
+ * Description: Host benchmark of the QR code drawing. Draws QR codes with
+ * display_draw_qr() as it was, a pixel at a time, and as it is now, a row of
+ * modules at a time, over random framebuffers in several areas and scales,
+ * and checks the framebuffers are the same. The times are the host ones.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "qrcodegen.h"
+
+#define BENCH_ROUNDS 2000
+#define DISPLAY_WIDTH 320   // As in display.h
+#define DISPLAY_HEIGHT 200  // As in display.h
+#define BUFFER_SIZE (DISPLAY_WIDTH / 8 * DISPLAY_HEIGHT)
+
+typedef void (*draw_qr_t)(uint8_t *buffer, const uint8_t qrcode[],
+                          uint16_t display_size_x, uint16_t display_size_y,
+                          uint16_t pos_x, uint16_t pos_y, int border,
+                          int scale);
+
+// The previous display_draw_qr() of display.c
+static void draw_qr_pixels(uint8_t *buffer, const uint8_t qrcode[],
+                           uint16_t display_size_x, uint16_t display_size_y,
+                           uint16_t pos_x, uint16_t pos_y, int border,
+                           int scale) {
+  uint8_t *display_address = buffer;
+
+  // Get the native size of the QR code
+  int size = qrcodegen_getSize(qrcode);
+
+  // Clear or initialize the display buffer if needed (optional)
+  // Example: memset(display_address, 0, (display_size_x / 8) * display_size_y);
+
+  // Calculate total size in pixels (QR code modules + border) * scale
+  int total_size_in_pixels = (size + 2 * border) * scale;
+
+  // Loop through each pixel in the scaled QR code + border
+  // Note: y and x indices are in 'pixel' units, not 'modules'.
+  for (int y = 0; y < total_size_in_pixels; y++) {
+    for (int x = 0; x < total_size_in_pixels; x++) {
+      // Center the QR code by offsetting the position
+      // We subtract half of the total scaled size from the center of the
+      // display
+      int abs_x = pos_x + x + (display_size_x - total_size_in_pixels) / 2;
+      int abs_y = pos_y + y + (display_size_y - total_size_in_pixels) / 2;
+
+      // Ensure we are within display bounds
+      if (abs_x >= 0 && abs_x < (display_size_x + pos_x) && abs_y >= 0 &&
+          abs_y < (display_size_y + pos_y)) {
+        // Determine the tile (byte) and bit within the display buffer
+        int tile_x = abs_x / 8;
+        int bit = 7 - (abs_x % 8);
+        int address = (abs_y * (DISPLAY_WIDTH / 8)) + tile_x;
+
+        // Translate scaled/bordered pixel coordinates back to original QR
+        // modules: (x / scale) - border and (y / scale) - border will give us
+        // which original QR module this pixel belongs to.
+        int module_x = (x / scale) - border;
+        int module_y = (y / scale) - border;
+
+        // Check if we're within the QR code module area
+        bool is_within_qr = (module_x >= 0 && module_x < size) &&
+                            (module_y >= 0 && module_y < size);
+
+        // If within the original QR code area, get the module state
+        bool module_on = false;
+        if (is_within_qr) {
+          module_on = qrcodegen_getModule(qrcode, module_x, module_y);
+        }
+
+        // Set or clear the bit accordingly
+        if (module_on) {
+          display_address[address] |= (1 << bit);
+        } else {
+          display_address[address] &= ~(1 << bit);
+        }
+      }
+    }
+  }
+}
+
+// Set the pixels from x0 to x1 - 1 of a line, leftmost pixel in bit 7
+static void display_fill_span(uint8_t *line, int x0, int x1) {
+  while (x0 < x1 && (x0 & 7)) {
+    line[x0 >> 3] |= 0x80 >> (x0 & 7);
+    x0++;
+  }
+  while (x1 - x0 >= 8) {
+    line[x0 >> 3] = 0xFF;
+    x0 += 8;
+  }
+  while (x0 < x1) {
+    line[x0 >> 3] |= 0x80 >> (x0 & 7);
+    x0++;
+  }
+}
+
+// As display_draw_qr() in display.c
+static void draw_qr_rows(uint8_t *buffer, const uint8_t qrcode[],
+                         uint16_t display_size_x, uint16_t display_size_y,
+                         uint16_t pos_x, uint16_t pos_y, int border,
+                         int scale) {
+  uint8_t *display_address = buffer;
+
+  // Get the native size of the QR code
+  int size = qrcodegen_getSize(qrcode);
+
+  // Calculate total size in pixels (QR code modules + border) * scale
+  int total_size_in_pixels = (size + 2 * border) * scale;
+
+  // Top left corner of the QR code, centered in the area
+  int left = pos_x + (display_size_x - total_size_in_pixels) / 2;
+  int top = pos_y + (display_size_y - total_size_in_pixels) / 2;
+
+  // Clip to the area and the display
+  int clip_x0 = (left < 0) ? 0 : left;
+  int clip_x1 = left + total_size_in_pixels;
+  if (clip_x1 > display_size_x + pos_x) clip_x1 = display_size_x + pos_x;
+  if (clip_x1 > DISPLAY_WIDTH) clip_x1 = DISPLAY_WIDTH;
+  int clip_y0 = (top < 0) ? 0 : top;
+  int clip_y1 = top + total_size_in_pixels;
+  if (clip_y1 > display_size_y + pos_y) clip_y1 = display_size_y + pos_y;
+  if (clip_y1 > DISPLAY_HEIGHT) clip_y1 = DISPLAY_HEIGHT;
+  if (clip_x0 >= clip_x1 || clip_y0 >= clip_y1) {
+    return;
+  }
+
+  // Pixels of a line covered by the QR code
+  uint8_t area[DISPLAY_WIDTH / 8] = {0};
+  display_fill_span(area, clip_x0, clip_x1);
+  int first_byte = clip_x0 >> 3;
+  int last_byte = (clip_x1 - 1) >> 3;
+
+  uint8_t pattern[DISPLAY_WIDTH / 8];
+  for (int module_y = -border; module_y < size + border; module_y++) {
+    int y0 = top + (module_y + border) * scale;
+    if (y0 + scale <= clip_y0 || y0 >= clip_y1) {
+      continue;
+    }
+
+    // Expand the runs of dark modules of the row
+    memset(pattern, 0, sizeof(pattern));
+    if (module_y >= 0 && module_y < size) {
+      int module_x = 0;
+      while (module_x < size) {
+        if (!qrcodegen_getModule(qrcode, module_x, module_y)) {
+          module_x++;
+          continue;
+        }
+        int run_end = module_x + 1;
+        while (run_end < size &&
+               qrcodegen_getModule(qrcode, run_end, module_y)) {
+          run_end++;
+        }
+        int x0 = left + (module_x + border) * scale;
+        int x1 = left + (run_end + border) * scale;
+        if (x0 < clip_x0) x0 = clip_x0;
+        if (x1 > clip_x1) x1 = clip_x1;
+        if (x0 < x1) {
+          display_fill_span(pattern, x0, x1);
+        }
+        module_x = run_end;
+      }
+    }
+
+    // Copy the line into every pixel line of the row
+    for (int y = y0; y < y0 + scale; y++) {
+      if (y < clip_y0 || y >= clip_y1) {
+        continue;
+      }
+      uint8_t *line = display_address + y * (DISPLAY_WIDTH / 8);
+      for (int b = first_byte; b <= last_byte; b++) {
+        line[b] = (uint8_t)((line[b] & ~area[b]) | pattern[b]);
+      }
+    }
+  }
+}
+
+static double now_us(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec * 1e6 + ts.tv_nsec / 1e3;
+}
+
+// An area of the screen and the QR code drawn in it
+typedef struct {
+  uint16_t size_x;
+  uint16_t size_y;
+  uint16_t pos_x;
+  uint16_t pos_y;
+  int border;
+  int scale;
+} bench_area_t;
+
+static double bench_draw(draw_qr_t draw, const uint8_t *qrcode,
+                         const bench_area_t *area) {
+  static uint8_t buffer[BUFFER_SIZE];
+  double start = now_us();
+  for (int round = 0; round < BENCH_ROUNDS; round++) {
+    draw(buffer, qrcode, area->size_x, area->size_y, area->pos_x, area->pos_y,
+         area->border, area->scale);
+  }
+  return (now_us() - start) / BENCH_ROUNDS;
+}
+
+int main(void) {
+  static const char *texts[] = {
+      "http://192.168.1.10",
+      "WIFI:T:WPA;S:mynetwork;P:secretpass123;;",
+      "x",
+  };
+  // Full screen, the halves of the fabric screens, larger than the screen,
+  // and an area not aligned to the bytes
+  static const bench_area_t areas[] = {
+      {320, 200, 0, 0, 2, 5}, {160, 200, 0, 0, 2, 4}, {160, 200, 160, 0, 2, 4},
+      {320, 200, 0, 0, 2, 9}, {100, 50, 7, 3, 1, 3},
+  };
+  static uint8_t qrcode[qrcodegen_BUFFER_LEN_MAX];
+  static uint8_t temp[qrcodegen_BUFFER_LEN_MAX];
+  static uint8_t before[BUFFER_SIZE];
+  static uint8_t after[BUFFER_SIZE];
+
+  int errors = 0;
+  for (size_t t = 0; t < sizeof(texts) / sizeof(texts[0]); t++) {
+    if (!qrcodegen_encodeText(texts[t], temp, qrcode, qrcodegen_Ecc_LOW,
+                              qrcodegen_VERSION_MIN, qrcodegen_VERSION_MAX,
+                              qrcodegen_Mask_AUTO, true)) {
+      errors++;
+      continue;
+    }
+    for (size_t a = 0; a < sizeof(areas) / sizeof(areas[0]); a++) {
+      const bench_area_t *area = &areas[a];
+      for (int i = 0; i < BUFFER_SIZE; i++) {
+        before[i] = after[i] = (uint8_t)rand();
+      }
+      draw_qr_pixels(before, qrcode, area->size_x, area->size_y, area->pos_x,
+                     area->pos_y, area->border, area->scale);
+      draw_qr_rows(after, qrcode, area->size_x, area->size_y, area->pos_x,
+                   area->pos_y, area->border, area->scale);
+      if (memcmp(before, after, BUFFER_SIZE) != 0) {
+        fprintf(stderr, "\"%s\" in area %zu: the pixels differ\n", texts[t],
+                a);
+        errors++;
+      }
+    }
+  }
+
+  // The WiFi QR code of the fabric screen
+  qrcodegen_encodeText(texts[1], temp, qrcode, qrcodegen_Ecc_LOW,
+                       qrcodegen_VERSION_MIN, qrcodegen_VERSION_MAX,
+                       qrcodegen_Mask_AUTO, true);
+  double pixels_us = bench_draw(draw_qr_pixels, qrcode, &areas[1]);
+  double rows_us = bench_draw(draw_qr_rows, qrcode, &areas[1]);
+  printf("QR code of %d modules, scale %d: a pixel at a time %.1f us, "
+         "a row at a time %.1f us\n",
+         qrcodegen_getSize(qrcode), areas[1].scale, pixels_us, rows_us);
+  printf("Speedup: %.1fx\n", pixels_us / rows_us);
+  printf("Errors: %d\n", errors);
+  return errors == 0 ? 0 : 1;
+}
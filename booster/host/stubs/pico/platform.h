@@ -0,0 +1,19 @@
+/**
+ * File: platform.h
+ * Author: Diego Parrilla Santamaría
+ * Date: October 2026
+ * Copyright: 2026 - GOODDATA LABS SL
+ * Description: Host stand-in for pico/platform.h. The harness sets the
+ * exception number to run code as if it were in an IRQ.
+ */
+
+#ifndef PICO_PLATFORM_H
+#define PICO_PLATFORM_H
+
+extern unsigned int host_current_exception;
+
+static inline unsigned int __get_current_exception(void) {
+  return host_current_exception;
+}
+
+#endif  // PICO_PLATFORM_H
@@ -0,0 +1,204 @@
+/**
+ * File: term_glyph_bench.c
+ * Author: Diego Parrilla Santamaría
+ * Date: October 2026
+ * Copyright: 2026 - GOODDATA LABS SL
+ * Description: Host benchmark of the terminal glyphs. Draws a full 40x25
+ * screen with u8g2_DrawGlyph() per char, as display_term.c did, and with a
+ * blit from a table decoded once with u8g2, per char and per row. Checks the
+ * pixels are the same, and the same as the display_font_amstrad table that
+ * display_term.c blits now. The times are the host ones.
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include "display_fonts.h"
+#include "u8g2.h"
+
+#define BENCH_ROUNDS 2000
+#define SCREEN_X 40
+#define SCREEN_Y 25
+#define LINE_BYTES 40  // DISPLAY_TERM_LINE_BYTES
+#define ROW_BYTES 320  // DISPLAY_ROW_BYTES
+#define BUFFER_SIZE (ROW_BYTES * SCREEN_Y)
+
+// As in display.c
+static const u8x8_display_info_t u8x8_ataristlow_320x200_display_info = {
+    /* chip_enable_level = */ 0,
+    /* chip_disable_level = */ 1,
+    /* post_chip_enable_wait_ns = */ 30,
+    /* pre_chip_disable_wait_ns = */ 10,
+    /* reset_pulse_width_ms = */ 1,
+    /* post_reset_wait_ms = */ 6,
+    /* sda_setup_time_ns = */ 20,
+    /* sck_pulse_width_ns = */ 140,
+    /* sck_clock_hz = */ 1000000UL,
+    /* spi_mode = */ 0,
+    /* i2c_bus_clock_100kHz = */ 4,
+    /* data_setup_time_ns = */ 120,
+    /* write_pulse_width_ns = */ 220,
+    /* tile_width = */ 40,
+    /* tile_height = */ 25,
+    /* default_x_offset = */ 0,
+    /* flipmode_x_offset = */ 0,
+    /* pixel_width = */ 320,
+    /* pixel_height = */ 200};
+
+static uint8_t u8x8_d_custom(u8x8_t *u8x8, uint8_t msg, uint8_t arg_int,
+                             void *arg_ptr) {
+  (void)arg_int;
+  (void)arg_ptr;
+  if (msg == U8X8_MSG_DISPLAY_SETUP_MEMORY) {
+    u8x8_d_helper_display_setup_memory(u8x8,
+                                       &u8x8_ataristlow_320x200_display_info);
+  }
+  return 1;
+}
+
+static uint8_t u8x8_dummy(u8x8_t *u8x8, uint8_t msg, uint8_t arg_int,
+                          void *arg_ptr) {
+  (void)u8x8;
+  (void)msg;
+  (void)arg_int;
+  (void)arg_ptr;
+  return 1;
+}
+
+static u8g2_t u8g2;
+static uint8_t buffer[BUFFER_SIZE];
+static uint8_t glyph_table[256][8];
+
+// Stops the compiler from merging the stores of the rounds
+static inline void keep_stores(void) {
+  __asm__ volatile("" : : "r"(buffer) : "memory");
+}
+
+static double now_us(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec * 1e6 + ts.tv_nsec / 1e3;
+}
+
+// Draw each glyph in the first cell and read its lines back
+static void build_glyph_table(void) {
+  for (int c = 0; c < 256; c++) {
+    u8g2_DrawGlyph(&u8g2, 0, 8, (uint16_t)c);
+    for (int line = 0; line < 8; line++) {
+      glyph_table[c][line] = buffer[line * LINE_BYTES];
+    }
+  }
+}
+
+static void blit_chars(const uint8_t glyphs[][8], int col, int row,
+                       const char *chars, int len) {
+  uint8_t *cell = buffer + row * ROW_BYTES + col;
+  for (int line = 0; line < 8; line++) {
+    uint8_t *dst = cell + line * LINE_BYTES;
+    for (int i = 0; i < len; i++) {
+      dst[i] = glyphs[(uint8_t)chars[i]][line];
+    }
+  }
+}
+
+static void draw_with_u8g2(char text[][SCREEN_X + 1]) {
+  for (int row = 0; row < SCREEN_Y; row++) {
+    for (int col = 0; col < SCREEN_X; col++) {
+      u8g2_DrawGlyph(&u8g2, col * 8, (row + 1) * 8, (uint8_t)text[row][col]);
+    }
+  }
+}
+
+int main(void) {
+  u8g2_SetupDisplay(&u8g2, u8x8_d_custom, u8x8_dummy, u8x8_dummy, u8x8_dummy);
+  u8g2_SetupBuffer(&u8g2, buffer, SCREEN_Y, u8g2_ll_hvline_horizontal_right_lsb,
+                   U8G2_R0);
+  u8g2_InitDisplay(&u8g2);
+  u8g2_SetFont(&u8g2, u8g2_font_amstrad_cpc_extended_8f);
+
+  static char text[SCREEN_Y][SCREEN_X + 1];
+  for (int row = 0; row < SCREEN_Y; row++) {
+    for (int col = 0; col < SCREEN_X; col++) {
+      text[row][col] = (char)(32 + (row * SCREEN_X + col) % 95);
+    }
+  }
+
+  double start = now_us();
+  build_glyph_table();
+  double build_us = now_us() - start;
+
+  // The same pixels with the three methods
+  static uint8_t reference[BUFFER_SIZE];
+  memset(buffer, 0, sizeof(buffer));
+  draw_with_u8g2(text);
+  memcpy(reference, buffer, sizeof(buffer));
+  memset(buffer, 0, sizeof(buffer));
+  for (int row = 0; row < SCREEN_Y; row++) {
+    blit_chars((const uint8_t(*)[8])glyph_table, 0, row, text[row], SCREEN_X);
+  }
+  int errors = memcmp(reference, buffer, sizeof(buffer)) != 0;
+  static uint8_t amstrad[256][8];
+  for (int c = 0; c < 256; c++) {
+    memcpy(amstrad[c], display_font_amstrad.glyphs[c].lines, 8);
+  }
+  memset(buffer, 0, sizeof(buffer));
+  for (int row = 0; row < SCREEN_Y; row++) {
+    blit_chars((const uint8_t(*)[8])amstrad, 0, row, text[row], SCREEN_X);
+  }
+  errors += memcmp(reference, buffer, sizeof(buffer)) != 0;
+  printf("Pixels: %s\n", errors ? "DIFFER" : "match");
+
+  start = now_us();
+  for (int n = 0; n < BENCH_ROUNDS; n++) {
+    draw_with_u8g2(text);
+  }
+  double glyph_us = (now_us() - start) / BENCH_ROUNDS;
+
+  start = now_us();
+  for (int n = 0; n < BENCH_ROUNDS; n++) {
+    for (int row = 0; row < SCREEN_Y; row++) {
+      for (int col = 0; col < SCREEN_X; col++) {
+        blit_chars((const uint8_t(*)[8])glyph_table, col, row,
+                   &text[row][col], 1);
+      }
+    }
+    keep_stores();
+  }
+  double char_us = (now_us() - start) / BENCH_ROUNDS;
+
+  start = now_us();
+  for (int n = 0; n < BENCH_ROUNDS; n++) {
+    for (int row = 0; row < SCREEN_Y; row++) {
+      blit_chars((const uint8_t(*)[8])glyph_table, 0, row, text[row],
+                 SCREEN_X);
+    }
+    keep_stores();
+  }
+  double row_us = (now_us() - start) / BENCH_ROUNDS;
+
+  int cursors = BENCH_ROUNDS * 100;
+  start = now_us();
+  for (int n = 0; n < cursors; n++) {
+    u8g2_DrawBox(&u8g2, (n % SCREEN_X) * 8, (n % SCREEN_Y) * 8, 8, 8);
+  }
+  double box_ns = (now_us() - start) * 1e3 / cursors;
+
+  start = now_us();
+  for (int n = 0; n < cursors; n++) {
+    uint8_t *cell = buffer + (n % SCREEN_Y) * ROW_BYTES + (n % SCREEN_X);
+    for (int line = 0; line < 8; line++) {
+      cell[line * LINE_BYTES] = 0xFF;
+    }
+    keep_stores();
+  }
+  double blit_ns = (now_us() - start) * 1e3 / cursors;
+
+  printf("Glyph table built in %.1f us\n", build_us);
+  printf("Screen of %d chars: u8g2_DrawGlyph %.1f us, blit per char %.1f us, "
+         "blit per row %.1f us\n",
+         SCREEN_X * SCREEN_Y, glyph_us, char_us, row_us);
+  printf("Cursor: u8g2_DrawBox %.1f ns, blit %.1f ns\n", box_ns, blit_ns);
+  return errors ? 1 : 0;
+}
@@ -0,0 +1,280 @@
+/**
+ * File: term_menu_replay.c
+ * Author: Diego Parrilla Santamaría
+ * Date: October 2026
+ * Copyright: 2026 - GOODDATA LABS SL
+ * Description: Host replay of the terminal menu, drawn with the writes of
+ * term.c before and after they were batched. The display is a model with the
+ * same ring of char rows and dirty bitmap as display.c: the glyphs are
+ * written straight into the frame buffer, as with DISPLAY_BYPASS_FRAMEBUFFER,
+ * and each refresh counts a frame and its dirty rows. On the RP2040 every
+ * dirty row of a frame is expanded for the high resolution and compared with
+ * the shadow copy for the deltas, and the ST copies the rows or their spans.
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#define REPLAY_ROUNDS 20000
+#define SCREEN_X 40  // TERM_SCREEN_SIZE_X
+#define SCREEN_Y 25  // TERM_SCREEN_SIZE_Y, and DISPLAY_CHAR_ROWS
+#define ROW_BYTES 320
+#define BUFFER_SIZE (ROW_BYTES * SCREEN_Y)
+
+// ------------------- display model -------------------
+
+static uint8_t frame_buffer[BUFFER_SIZE];
+static uint8_t glyphs[256][8];
+static uint8_t top_row = 0;
+static uint32_t dirty_rows = 0;
+static unsigned long frames = 0;
+static unsigned long rows_published = 0;
+
+static void display_mark(uint8_t row, uint8_t count) {
+  if (row < SCREEN_Y) {
+    dirty_rows |= ((1ul << count) - 1) << row;
+  }
+}
+
+static uint8_t *display_cell(uint8_t x, uint8_t y) {
+  return frame_buffer + ((y + top_row) % SCREEN_Y) * ROW_BYTES + x;
+}
+
+static void display_term_chars(uint8_t x, uint8_t y, const char *text,
+                               uint8_t len) {
+  if (x >= SCREEN_X) {
+    return;
+  }
+  if (len > SCREEN_X - x) {
+    len = SCREEN_X - x;
+  }
+  uint8_t *cell = display_cell(x, y);
+  for (int line = 0; line < 8; line++) {
+    for (int i = 0; i < len; i++) {
+      cell[line * SCREEN_X + i] = glyphs[(uint8_t)text[i]][line];
+    }
+  }
+  display_mark(y, 1);
+}
+
+static void display_term_char(uint8_t x, uint8_t y, char c) {
+  display_term_chars(x, y, &c, 1);
+}
+
+static void display_term_cursor(uint8_t x, uint8_t y) {
+  uint8_t *cell = display_cell(x, y);
+  for (int line = 0; line < 8; line++) {
+    cell[line * SCREEN_X] = 0xFF;
+  }
+  display_mark(y, 1);
+}
+
+static void display_scrollup(uint8_t rows) {
+  for (int i = 0; i < rows; i++) {
+    memset(frame_buffer + top_row * ROW_BYTES, 0, ROW_BYTES);
+    top_row = (top_row + 1) % SCREEN_Y;
+  }
+  display_mark(0, SCREEN_Y);
+}
+
+static void display_refresh_dirty(void) {
+  if (dirty_rows == 0) {
+    return;
+  }
+  frames++;
+  rows_published += (unsigned long)__builtin_popcount(dirty_rows);
+  dirty_rows = 0;
+}
+
+static void display_term_clear(void) {
+  top_row = 0;
+  memset(frame_buffer, 0, sizeof(frame_buffer));
+  display_mark(0, SCREEN_Y);
+}
+
+// ------------------- terminal -------------------
+
+static char screen[SCREEN_X * SCREEN_Y];
+static uint8_t cursor_x, cursor_y, prev_cursor_x, prev_cursor_y;
+
+static void term_clear_screen(void) {
+  memset(screen, 0, sizeof(screen));
+  cursor_x = cursor_y = prev_cursor_x = prev_cursor_y = 0;
+  display_term_clear();
+}
+
+// Before: one scroll per line, and a refresh per string
+static void old_scroll_up(void) {
+  memmove(screen, screen + SCREEN_X, SCREEN_X * (SCREEN_Y - 1));
+  memset(screen + SCREEN_X * (SCREEN_Y - 1), 0, SCREEN_X);
+  display_scrollup(1);
+}
+
+static void old_new_line(void) {
+  cursor_x = 0;
+  if (++cursor_y >= SCREEN_Y) {
+    old_scroll_up();
+    cursor_y = SCREEN_Y - 1;
+  }
+}
+
+static void old_print_string(const char *str) {
+  display_term_char(prev_cursor_x, prev_cursor_y, ' ');
+  while (*str) {
+    if (*str == '\n' || *str == '\r') {
+      old_new_line();
+      str++;
+      continue;
+    }
+    uint8_t len = 0;
+    while (str[len] && str[len] != '\n' && str[len] != '\r' &&
+           cursor_x + len < SCREEN_X) {
+      len++;
+    }
+    memcpy(&screen[cursor_y * SCREEN_X + cursor_x], str, len);
+    display_term_chars(cursor_x, cursor_y, str, len);
+    str += len;
+    cursor_x += len;
+    if (cursor_x >= SCREEN_X) {
+      old_new_line();
+    }
+  }
+  display_term_cursor(cursor_x, cursor_y);
+  prev_cursor_x = cursor_x;
+  prev_cursor_y = cursor_y;
+  display_refresh_dirty();
+}
+
+// After: term_scroll_up() and term_write_text() of term.c
+static void term_scroll_up(uint8_t rows) {
+  if (rows == 0) {
+    return;
+  }
+  if (rows > SCREEN_Y) {
+    rows = SCREEN_Y;
+  }
+  size_t kept = (size_t)(SCREEN_Y - rows) * SCREEN_X;
+  memmove(screen, screen + rows * SCREEN_X, kept);
+  memset(screen + kept, 0, sizeof(screen) - kept);
+  display_scrollup(rows);
+}
+
+static void term_write_text(const char *buf, size_t len) {
+  uint16_t lines = 0;
+  uint8_t x = cursor_x;
+  for (size_t i = 0; i < len; i++) {
+    if (buf[i] == '\n' || buf[i] == '\r' || ++x >= SCREEN_X) {
+      x = 0;
+      lines++;
+    }
+  }
+  uint16_t scroll = 0;
+  if (cursor_y + lines > SCREEN_Y - 1) {
+    scroll = cursor_y + lines - (SCREEN_Y - 1);
+  }
+
+  display_term_char(prev_cursor_x, prev_cursor_y, ' ');
+  term_scroll_up(scroll > SCREEN_Y ? SCREEN_Y : scroll);
+
+  int y = (int)cursor_y - (int)scroll;
+  x = cursor_x;
+  size_t i = 0;
+  while (i < len) {
+    if (buf[i] == '\n' || buf[i] == '\r') {
+      x = 0;
+      y++;
+      i++;
+      continue;
+    }
+    uint8_t run = 0;
+    while (i + run < len && buf[i + run] != '\n' && buf[i + run] != '\r' &&
+           x + run < SCREEN_X) {
+      run++;
+    }
+    if (y >= 0) {
+      memcpy(&screen[y * SCREEN_X + x], &buf[i], run);
+      display_term_chars(x, (uint8_t)y, &buf[i], run);
+    }
+    i += run;
+    x += run;
+    if (x >= SCREEN_X) {
+      x = 0;
+      y++;
+    }
+  }
+  cursor_x = x;
+  cursor_y = (uint8_t)y;
+
+  display_term_cursor(cursor_x, cursor_y);
+  prev_cursor_x = cursor_x;
+  prev_cursor_y = cursor_y;
+}
+
+static void new_print_string(const char *str) {
+  term_write_text(str, strlen(str));
+}
+
+// ------------------- replay -------------------
+
+typedef void (*print_fn_t)(const char *str);
+
+// The menu as term_print_menu() printed it when the writes were batched:
+// the options, then one line per installed app, then the prompt
+static void replay_menu(print_fn_t print, int apps, int batched) {
+  term_clear_screen();
+  print("Booster Terminal - Apps\n");
+  print("Enter the number of an app and RETURN\n");
+  print("R. Return to the manager\n");
+  print("C. Apps catalog\n");
+  print("B. Boot timeline\n");
+  char line[256];
+  for (int i = 0; i < apps; i++) {
+    snprintf(line, sizeof(line), "%d. %s (%s)\n", i + 1,
+             "Some downloaded app", "v1.2.3");
+    print(line);
+  }
+  print("> ");
+  if (batched) {
+    display_refresh_dirty();
+  }
+}
+
+static double now_us(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec * 1e6 + ts.tv_nsec / 1e3;
+}
+
+int main(void) {
+  for (int c = 0; c < 256; c++) {
+    for (int line = 0; line < 8; line++) {
+      glyphs[c][line] = (uint8_t)(c * 7 + line);
+    }
+  }
+
+  static const int sizes[] = {5, 19, 40};
+  printf("apps  frames     dirty rows published   draw time\n");
+  for (size_t k = 0; k < sizeof(sizes) / sizeof(sizes[0]); k++) {
+    unsigned long frame_count[2];
+    unsigned long row_count[2];
+    double draw_us[2];
+    for (int batched = 0; batched < 2; batched++) {
+      print_fn_t print = batched ? new_print_string : old_print_string;
+      frames = rows_published = 0;
+      replay_menu(print, sizes[k], batched);
+      frame_count[batched] = frames;
+      row_count[batched] = rows_published;
+      double start = now_us();
+      for (int round = 0; round < REPLAY_ROUNDS; round++) {
+        replay_menu(print, sizes[k], batched);
+      }
+      draw_us[batched] = (now_us() - start) / REPLAY_ROUNDS;
+    }
+    printf("%4d  %3lu -> %lu   %4lu -> %2lu              %.1f -> %.1f us\n",
+           sizes[k], frame_count[0], frame_count[1], row_count[0],
+           row_count[1], draw_us[0], draw_us[1]);
+  }
+  return 0;
+}
@@ -24,10 +24,24 @@ static char request_host_buf[256];
 static char request_uri_buf[512];
 static DIR s_dir;
 static bool s_dir_opened = false;
+// Token pools of the app JSON parser, so parsing never touches the heap. One
+// per context that parses: the SD card boot on core 1, and on core 0 the main
+// loop and the lwIP callbacks, which can preempt it.
+#define APPMNGR_JSON_POOLS 3
+static jsontok_t json_tokens[APPMNGR_JSON_POOLS][APPMNGR_JSON_MAX_TOKENS];
 static char s_folder[256];
 static download_launch_err_t launch_status = DOWNLOAD_LAUNCHAPP_IDLE;
 static char launch_app_uuid[37] = {0};
 static bool download_update = false;
+// Throughput of the download in progress, and WiFi scans that competed
+// with it for the airtime
+static uint32_t download_start_us = 0;
+static uint32_t download_bytes = 0;
+static uint32_t download_start_scans = 0;
+static mirror_route_t download_route = {MIRROR_ORIGIN};
+// Set when a mirror served a file with the wrong MD5: the retry skips the
+// mirrors
+static bool download_from_origin = false;
 
 static int appmngr_hex_nibble(char c) {
   if (c >= '0' && c <= '9') {
@@ -178,6 +192,7 @@ static int sdcard_write_file(const char *filename, const char *data,
   // Write the data to the file
   res = f_write(&file, data, size, &bytes_written);
   if (res != FR_OK) {
+    metrics_inc(METRICS_SD_ERRORS);
     DPRINTF("Error writing to file %s: %i\n", filename, res);
     f_close(&file);
     return -1;
@@ -191,104 +206,103 @@ static int sdcard_write_file(const char *filename, const char *data,
   return 0;
 }
 
-static download_err_t set_app_info(const char *json_str) {
-  cJSON *root = cJSON_Parse(json_str);
-  if (root == NULL) {
-    DPRINTF("Error parsing JSON\n");
-    return DOWNLOAD_PARSEJSON_ERROR;  // Error parsing JSON
+// Token pool of the calling context
+static jsontok_t *appmngr_json_tokens(void) {
+  if (get_core_num() != 0) {
+    return json_tokens[2];
   }
+  return json_tokens[__get_current_exception() == 0 ? 0 : 1];
+}
 
-  // Retrieve JSON fields
-  cJSON *uuid = cJSON_GetObjectItem(root, "uuid");
-  cJSON *name = cJSON_GetObjectItem(root, "name");
-  cJSON *description = cJSON_GetObjectItem(root, "description");
-  cJSON *image = cJSON_GetObjectItem(root, "image");
-  cJSON *tags = cJSON_GetObjectItem(root, "tags");
-  cJSON *devices = cJSON_GetObjectItem(root, "devices");
-  cJSON *binary = cJSON_GetObjectItem(root, "binary");
-  cJSON *md5 = cJSON_GetObjectItem(root, "md5");
-  cJSON *version = cJSON_GetObjectItem(root, "version");
-
-  // For each field, confirm it's a string before copying
-  if (uuid && cJSON_IsString(uuid)) {
-    snprintf(app_info.uuid, sizeof(app_info.uuid), "%s", uuid->valuestring);
-  }
-  if (name && cJSON_IsString(name)) {
-    snprintf(app_info.name, sizeof(app_info.name), "%s", name->valuestring);
-  }
-  if (description && cJSON_IsString(description)) {
-    snprintf(app_info.description, sizeof(app_info.description), "%s",
-             description->valuestring);
-  }
-  if (image && cJSON_IsString(image)) {
-    snprintf(app_info.image, sizeof(app_info.image), "%s", image->valuestring);
-  }
-
-  // tags is expected to be an array of strings
-  if (tags && cJSON_IsArray(tags)) {
-    cJSON *tag = NULL;
-    int i = 0;
-    cJSON_ArrayForEach(tag, tags) {
-      if (cJSON_IsString(tag)) {
-        snprintf(app_info.tags[i], sizeof(app_info.tags[i]), "%s",
-                 tag->valuestring);
-        i++;
-        if (i >= MAX_TAGS) break;
-      }
-    }
-    app_info.tags_count = i;
-  } else {
-    app_info.tags_count = 0;  // No valid tags array
-  }
-
-  // devices is expected to be an array of strings
-  if (devices && cJSON_IsArray(devices)) {
-    cJSON *device = NULL;
-    int i = 0;
-    cJSON_ArrayForEach(device, devices) {
-      if (cJSON_IsString(device)) {
-        snprintf(app_info.devices[i], sizeof(app_info.devices[i]), "%s",
-                 device->valuestring);
-        i++;
-        if (i >= MAX_DEVICES) break;
-      }
+// Copy a string member of the root object of a tokenized app JSON
+static bool appmngr_json_get_string(const char *json_str,
+                                    const jsontok_t *tokens, int count,
+                                    const char *key, char *out,
+                                    size_t out_len) {
+  int value = jsontok_find(json_str, tokens, count, 0, key);
+  if (!jsontok_is_string(tokens, value)) {
+    return false;
+  }
+  jsontok_copy_string(json_str, &tokens[value], out, out_len);
+  return true;
+}
+
+// Copy the strings of an array member, up to max_items of them
+static int appmngr_json_get_string_array(const char *json_str,
+                                         const jsontok_t *tokens, int count,
+                                         const char *key, char *out,
+                                         size_t item_len, int max_items) {
+  int array = jsontok_find(json_str, tokens, count, 0, key);
+  if (array < 0 || tokens[array].type != JSONTOK_ARRAY) {
+    return 0;
+  }
+  int items = 0;
+  int i = array + 1;
+  for (int n = 0; n < tokens[array].size && items < max_items; n++) {
+    if (jsontok_is_string(tokens, i)) {
+      jsontok_copy_string(json_str, &tokens[i], out + items * item_len,
+                          item_len);
+      items++;
     }
-    app_info.devices_count = i;
-  } else {
-    app_info.devices_count = 0;  // No valid devices array
+    i = jsontok_skip(tokens, count, i);
   }
+  return items;
+}
 
-  if (binary && cJSON_IsString(binary)) {
-    snprintf(app_info.binary, sizeof(app_info.binary), "%s",
-             binary->valuestring);
+static download_err_t set_app_info(const char *json_str) {
+  uint32_t start_us = time_us_32();
+  jsontok_t *tokens = appmngr_json_tokens();
+  int count = jsontok_parse(json_str, strlen(json_str), tokens,
+                            APPMNGR_JSON_MAX_TOKENS);
+  if (count < 1 || tokens[0].type != JSONTOK_OBJECT) {
+    DPRINTF("Error parsing JSON: %d\n", count);
+    return DOWNLOAD_PARSEJSON_ERROR;  // Error parsing JSON
   }
-  if (md5 && cJSON_IsString(md5) && md5->valuestring) {
-    // Convert MD5 string to 16-byte binary array
-    const char *md5_str = md5->valuestring;
+
+  // For each field, only strings are copied
+  appmngr_json_get_string(json_str, tokens, count, "uuid", app_info.uuid,
+                          sizeof(app_info.uuid));
+  appmngr_json_get_string(json_str, tokens, count, "name", app_info.name,
+                          sizeof(app_info.name));
+  appmngr_json_get_string(json_str, tokens, count, "description",
+                          app_info.description, sizeof(app_info.description));
+  appmngr_json_get_string(json_str, tokens, count, "image", app_info.image,
+                          sizeof(app_info.image));
+
+  // tags and devices are expected to be arrays of strings
+  app_info.tags_count = appmngr_json_get_string_array(
+      json_str, tokens, count, "tags", &app_info.tags[0][0],
+      sizeof(app_info.tags[0]), MAX_TAGS);
+  app_info.devices_count = appmngr_json_get_string_array(
+      json_str, tokens, count, "devices", &app_info.devices[0][0],
+      sizeof(app_info.devices[0]), MAX_DEVICES);
+
+  appmngr_json_get_string(json_str, tokens, count, "binary", app_info.binary,
+                          sizeof(app_info.binary));
+
+  // Convert MD5 string to 16-byte binary array. It should be exactly 32 hex
+  // characters, so a larger buffer detects longer strings.
+  char md5_str[34];
+  if (appmngr_json_get_string(json_str, tokens, count, "md5", md5_str,
+                              sizeof(md5_str))) {
     size_t md5_len = strlen(md5_str);
-    if (md5_len != 32) {  // MD5 string should be exactly 32 hex characters
+    if (md5_len != 32) {
       DPRINTF("Invalid MD5 length in JSON: %zu\n", md5_len);
-      cJSON_Delete(root);
       return DOWNLOAD_PARSEMD5_ERROR;
     }
     if (!appmngr_parse_md5_hex(md5_str, app_info.md5)) {
       DPRINTF("Error parsing MD5 hex string\n");
-      cJSON_Delete(root);
       return DOWNLOAD_PARSEMD5_ERROR;
     }
   } else {
     DPRINTF("MD5 field is missing or is not a valid string\n");
-    cJSON_Delete(root);
     return DOWNLOAD_PARSEMD5_ERROR;
   }
 
-  if (version && cJSON_IsString(version)) {
-    snprintf(app_info.version, sizeof(app_info.version), "%s",
-             version->valuestring);
-  }
-
-  // Always free the cJSON root object to avoid memory leaks
-  cJSON_Delete(root);
+  appmngr_json_get_string(json_str, tokens, count, "version",
+                          app_info.version, sizeof(app_info.version));
+  DPRINTF("App info parsed in %lu us (%d tokens)\n",
+          (unsigned long)(time_us_32() - start_us), count);
 
   // Finally, copy the JSON string into the app_info struct in the json field
   snprintf(app_info.json, sizeof(app_info.json), "%s", json_str);
@@ -317,36 +331,33 @@ static download_err_t set_app_info(const char *json_str) {
 static bool appmngr_parse_installed_app(
     const char *json_str, const char *expected_uuid,
     appmngr_installed_app_t *installed_app) {
-  cJSON *root = cJSON_Parse(json_str);
-  if (root == NULL) {
+  jsontok_t *tokens = appmngr_json_tokens();
+  int count = jsontok_parse(json_str, strlen(json_str), tokens,
+                            APPMNGR_JSON_MAX_TOKENS);
+  if (count < 1 || tokens[0].type != JSONTOK_OBJECT) {
     return false;
   }
 
-  cJSON *uuid = cJSON_GetObjectItem(root, "uuid");
-  cJSON *name = cJSON_GetObjectItem(root, "name");
-  cJSON *version = cJSON_GetObjectItem(root, "version");
-
-  bool valid = false;
-  if (uuid && cJSON_IsString(uuid) && uuid->valuestring && name &&
-      cJSON_IsString(name) && name->valuestring &&
-      strcasecmp(uuid->valuestring, expected_uuid) == 0 &&
-      is_valid_uuid4(expected_uuid)) {
-    snprintf(installed_app->uuid, sizeof(installed_app->uuid), "%s",
-             expected_uuid);
-    snprintf(installed_app->name, sizeof(installed_app->name), "%s",
-             name->valuestring);
-    if (version && cJSON_IsString(version) && version->valuestring) {
-      snprintf(installed_app->version, sizeof(installed_app->version), "%s",
-               version->valuestring);
-    } else {
-      snprintf(installed_app->version, sizeof(installed_app->version), "%s",
-               "unknown");
-    }
-    valid = true;
+  char uuid[sizeof(installed_app->uuid) + 1];
+  if (!appmngr_json_get_string(json_str, tokens, count, "uuid", uuid,
+                               sizeof(uuid)) ||
+      strcasecmp(uuid, expected_uuid) != 0 || !is_valid_uuid4(expected_uuid)) {
+    return false;
   }
-
-  cJSON_Delete(root);
-  return valid;
+  if (!appmngr_json_get_string(json_str, tokens, count, "name",
+                               installed_app->name,
+                               sizeof(installed_app->name))) {
+    return false;
+  }
+  snprintf(installed_app->uuid, sizeof(installed_app->uuid), "%s",
+           expected_uuid);
+  if (!appmngr_json_get_string(json_str, tokens, count, "version",
+                               installed_app->version,
+                               sizeof(installed_app->version))) {
+    snprintf(installed_app->version, sizeof(installed_app->version), "%s",
+             "unknown");
+  }
+  return true;
 }
 
 static int appmngr_compare_installed_apps(const void *lhs, const void *rhs) {
@@ -461,6 +472,7 @@ static err_t http_client_receive_file_fn(__unused void *arg,
     UINT bw = 0;
     fres = f_write(&file, q->payload, q->len, &bw);
     if (fres != FR_OK || bw != q->len) {
+      metrics_inc(METRICS_SD_ERRORS);
       DPRINTF("Error writing to file: %i (wrote %u of %u)\n", fres,
               (unsigned)bw, q->len);
       if (download_type == DOWNLOAD_TYPE_FIRMWARE)
@@ -472,6 +484,9 @@ static err_t http_client_receive_file_fn(__unused void *arg,
     }
   }
 
+  download_bytes += p->tot_len;
+  metrics_add(METRICS_DOWNLOAD_BYTES, p->tot_len);
+  TRACE2(DOWNLOAD_RECV, p->tot_len, download_bytes);
 #if BOOSTER_DOWNLOAD_HTTPS == 1
   altcp_recved(conn, p->tot_len);
 #else
@@ -490,10 +505,8 @@ static err_t http_client_receive_file_fn(__unused void *arg,
 static err_t http_client_header_check_size_fn(
     __unused httpc_state_t *connection, __unused void *arg, struct pbuf *hdr,
     u16_t hdr_len, __unused u32_t content_len) {
-  size_t max_allowed =
-      (download_type == DOWNLOAD_TYPE_FIRMWARE)
-          ? MAXIMUM_APP_UF2_SIZE
-          : MAXIMUM_APP_INFO_SIZE;  // or another cap for app files
+  // Both app and firmware downloads are UF2 images
+  size_t max_allowed = MAXIMUM_APP_UF2_SIZE;
 
   char buf[512];
   u16_t copy = hdr_len < sizeof(buf) - 1 ? hdr_len : (sizeof(buf) - 1);
@@ -538,6 +551,14 @@ static void http_client_result_complete_fn(void *arg,
   HTTPC_REQUEST_T *req = (HTTPC_REQUEST_T *)arg;
   DPRINTF("Requet complete: result %d len %u server_response %u err %d\n",
           httpc_result, rx_content_len, srv_res, err);
+  uint32_t elapsed_us = time_us_32() - download_start_us;
+  uint32_t kbps = (elapsed_us > 0)
+                      ? (uint32_t)((uint64_t)download_bytes * 1000 / elapsed_us)
+                      : 0;
+  DPRINTF("Downloaded %lu bytes in %lu ms: %lu KB/s. Scans during: %lu\n",
+          (unsigned long)download_bytes, (unsigned long)(elapsed_us / 1000),
+          (unsigned long)kbps,
+          (unsigned long)(network_getScanCount() - download_start_scans));
   req->complete = true;
   if (err == ERR_OK) {
     if (download_type == DOWNLOAD_TYPE_FIRMWARE) {
@@ -565,6 +586,27 @@ static void http_client_result_complete_fn(void *arg,
       download_error = DOWNLOAD_HTTP_ERROR;
     }
   }
+  bool ok = (err == ERR_OK) && (srv_res == 200);
+  mirror_report(&download_route, ok);
+  if (ok) {
+    metrics_observe(METRICS_HISTOGRAM_DOWNLOAD_MS, elapsed_us / 1000);
+    metrics_set(METRICS_GAUGE_DOWNLOAD_KBPS, (int32_t)kbps);
+  } else {
+    metrics_inc(METRICS_DOWNLOAD_FAILURES);
+  }
+  if (!ok && download_route.mirror != MIRROR_ORIGIN) {
+    // Request the download again. The failed mirror is skipped now, so it
+    // goes to the next mirror or to the origin.
+    DPRINTF("Mirror %s failed. Retrying the download.\n",
+            download_route.hostname);
+    if (download_type == DOWNLOAD_TYPE_FIRMWARE) {
+      download_firmware_status = DOWNLOAD_STATUS_REQUESTED;
+      download_firmware_error = DOWNLOAD_OK;
+    } else {
+      download_status = DOWNLOAD_STATUS_REQUESTED;
+      download_error = DOWNLOAD_OK;
+    }
+  }
 }
 
 static void get_tmp_filename_path(char filename[256]) {
@@ -864,9 +906,13 @@ static int8_t appmngr_delete_config_sector(uint8_t sector) {
       (flash_start - XIP_BASE) + (uint32_t)sector * FLASH_SECTOR_SIZE;
   DPRINTF("Erase config sector %u at offset 0x%08X\n", sector, offs);
 
+  uint32_t erase_us = time_us_32();
   uint32_t ints = save_and_disable_interrupts();
   flash_range_erase(offs, FLASH_SECTOR_SIZE);
   restore_interrupts(ints);
+  metrics_inc(METRICS_FLASH_ERASES);
+  metrics_observe(METRICS_HISTOGRAM_FLASH_ERASE_MS,
+                  (time_us_32() - erase_us) / 1000);
   return 0;
 }
 
@@ -1243,8 +1289,12 @@ static int8_t appmngr_persist_app_lookup_table(const uint8_t *table,
                                  (uint32_t)&_global_lookup_flash_start;
 
   // Erase the whole region that stores the table (or at least the first sector)
+  uint32_t erase_us = time_us_32();
   uint32_t ints = save_and_disable_interrupts();
   flash_range_erase(flash_start - XIP_BASE, FLASH_SECTOR_SIZE);
+  metrics_inc(METRICS_FLASH_ERASES);
+  metrics_observe(METRICS_HISTOGRAM_FLASH_ERASE_MS,
+                  (time_us_32() - erase_us) / 1000);
 
   const uint32_t PAGE = FLASH_PAGE_SIZE;
   uint32_t wrote = 0;
@@ -1266,12 +1316,11 @@ static int8_t appmngr_persist_app_lookup_table(const uint8_t *table,
 // -----------------------------------------------------------------------------
 // Sync lookup table with JSON files on SD card
 // -----------------------------------------------------------------------------
-void appmngr_sync_lookup_table() {
+bool appmngr_scan_lookup_table(uint8_t *table, uint16_t *table_len) {
   // 1) Load current lookup table into RAM buffer
-  uint8_t table[4096];  // Enough for ~107 entries (4096/38)
-  memset(table, 0, sizeof(table));
-  uint16_t table_len = 0;
-  appmngr_load_apps_lookup_table(table, &table_len);
+  memset(table, 0, FLASH_SECTOR_SIZE);
+  *table_len = 0;
+  appmngr_load_apps_lookup_table(table, table_len);
   bool changed = false;
 
   // 2) Open apps folder from settings
@@ -1283,7 +1332,15 @@ void appmngr_sync_lookup_table() {
   FRESULT res = f_opendir(&dir, apps_folder);
   if (res != FR_OK) {
     DPRINTF("sync: cannot open apps folder %s (err=%d)\n", apps_folder, res);
-    return;
+    return false;
+  }
+
+  // On the heap: this runs on the small stack of core 1 at boot
+  char *json_buf = malloc(MAXIMUM_APP_INFO_SIZE);
+  if (json_buf == NULL) {
+    DPRINTF("sync: no memory to read the apps info\n");
+    f_closedir(&dir);
+    return false;
   }
 
   FILINFO fno;
@@ -1306,7 +1363,7 @@ void appmngr_sync_lookup_table() {
     if (!is_valid_uuid4(base)) continue;
 
     // Check if already present in table
-    int16_t page = appmngr_get_page_number_for_uuid(base, table, table_len);
+    int16_t page = appmngr_get_page_number_for_uuid(base, table, *table_len);
     if (page >= 0) {
       // Already present
       continue;
@@ -1322,9 +1379,8 @@ void appmngr_sync_lookup_table() {
       continue;
     }
     // Read file content into buffer
-    char json_buf[MAXIMUM_APP_INFO_SIZE];
     UINT br = 0;
-    FRESULT rr = f_read(&fil, json_buf, sizeof(json_buf) - 1, &br);
+    FRESULT rr = f_read(&fil, json_buf, MAXIMUM_APP_INFO_SIZE - 1, &br);
     f_close(&fil);
     if (rr != FR_OK) {
       DPRINTF("sync: cannot read %s (err=%d)\n", path, rr);
@@ -1339,11 +1395,11 @@ void appmngr_sync_lookup_table() {
 
     // app_info.uuid should now be set; add a new entry with next free sector
     int16_t next_sector =
-        appmngr_find_first_empty_config_sector(table, &table_len);
+        appmngr_find_first_empty_config_sector(table, table_len);
     if (next_sector < 0) next_sector = 0;  // fallback
 
     if (appmngr_update_lookup_table(app_info.uuid, (uint16_t)next_sector, table,
-                                    &table_len) == 0) {
+                                    table_len) == 0) {
       DPRINTF("sync: added %.*s -> sector %d\n", 36, app_info.uuid,
               next_sector);
       changed = true;
@@ -1351,10 +1407,20 @@ void appmngr_sync_lookup_table() {
       DPRINTF("sync: failed to add %.*s\n", 36, app_info.uuid);
     }
   }
+  free(json_buf);
   f_closedir(&dir);
+  return changed;
+}
+
+int8_t appmngr_save_lookup_table(const uint8_t *table, uint16_t table_len) {
+  return appmngr_persist_app_lookup_table(table, table_len);
+}
 
-  // 3) Persist any updates
-  if (changed) {
+void appmngr_sync_lookup_table() {
+  uint8_t table[FLASH_SECTOR_SIZE];  // Enough for ~107 entries (4096/38)
+  uint16_t table_len = 0;
+  if (appmngr_scan_lookup_table(table, &table_len)) {
+    // 3) Persist any updates
     appmngr_persist_app_lookup_table(table, table_len);
   } else {
     DPRINTF("sync: no changes, nothing to persist\n");
@@ -1431,9 +1497,13 @@ static FRESULT __not_in_flash_func(storeUF2FileToFlash)(const char *filename,
 
   DPRINTF("Erasing %u bytes of flash at offset 0x%X\n", flashSize, offset);
   {
+    uint32_t erase_us = time_us_32();
     uint32_t ints = save_and_disable_interrupts();
     flash_range_erase(offset, flashSize);
     restore_interrupts(ints);
+    metrics_inc(METRICS_FLASH_ERASES);
+    metrics_observe(METRICS_HISTOGRAM_FLASH_ERASE_MS,
+                    (time_us_32() - erase_us) / 1000);
   }
 
   uf2FileSize = f_size(&file);
@@ -1586,9 +1656,13 @@ int8_t appmngr_erase_app_lookup_table() {
           flash_start, flash_length, num_sectors);
 
   // Erase the sector
+  uint32_t erase_us = time_us_32();
   uint32_t ints = save_and_disable_interrupts();
   flash_range_erase(flash_start - XIP_BASE, flash_length);  // 4 Kbytes
   restore_interrupts(ints);
+  metrics_inc(METRICS_FLASH_ERASES);
+  metrics_observe(METRICS_HISTOGRAM_FLASH_ERASE_MS,
+                  (time_us_32() - erase_us) / 1000);
 
   return 0;  // Success
 }
@@ -1823,37 +1897,49 @@ download_err_t appmngr_start_download(const char *url) {
     download_firmware_error = DOWNLOAD_OK;
   }
   // Copy host and URI into persistent buffers (components is on stack)
-  snprintf(request_host_buf, sizeof(request_host_buf), "%s", components.host);
+  // Only the app binaries come from a mirror. They are checked against the
+  // MD5 of the catalog before they are installed, and the firmware has no
+  // checksum to check it against.
+  bool mirrored = false;
+  if (download_type == DOWNLOAD_TYPE_APP && !download_from_origin) {
+    mirrored = mirror_route(&download_route);
+  } else {
+    download_route = (mirror_route_t){MIRROR_ORIGIN};
+  }
+  download_from_origin = false;
+  snprintf(request_host_buf, sizeof(request_host_buf), "%s",
+           mirrored ? download_route.hostname : components.host);
   snprintf(request_uri_buf, sizeof(request_uri_buf), "%s", components.uri);
 
   request = (HTTPC_REQUEST_T){0};
   request.complete = false;
   request.hostname = request_host_buf;
   request.url = request_uri_buf;
-  DPRINTF("HOST: %s. URI: %s\n", components.host, components.uri);
+  request.port = download_route.port;
+  DPRINTF("HOST: %s. URI: %s\n", request_host_buf, components.uri);
   request.headers_fn = http_client_header_check_size_fn;
   request.recv_fn = http_client_receive_file_fn;
   request.result_fn = http_client_result_complete_fn;
   DPRINTF("Downloading app binary: %s\n", request.url);
 #if BOOSTER_DOWNLOAD_HTTPS == 1
-  request.tls_config = altcp_tls_create_config_client(NULL, 0);  // https
-  DPRINTF("Download with HTTPS\n");
+  // The mirrors are on the LAN and serve plain HTTP
+  request.tls_config = mirrored ? NULL : http_client_tls_config();  // https
+  DPRINTF("Download with %s\n", mirrored ? "HTTP" : "HTTPS");
 #else
   DPRINTF("Download with HTTP\n");
 #endif
+  download_start_us = time_us_32();
+  download_bytes = 0;
+  metrics_inc(METRICS_DOWNLOADS);
+  download_start_scans = network_getScanCount();
   int result = http_client_request_async(cyw43_arch_async_context(), &request);
   if (result != 0) {
     DPRINTF("Error initializing the download app binary: %i\n", result);
+    mirror_report(&download_route, false);
     res = f_close(&file);
     if (res != FR_OK) {
       DPRINTF("Error closing file %s: %i\n", filename, res);
     }
-#if BOOSTER_DOWNLOAD_HTTPS == 1
-    if (request.tls_config) {
-      altcp_tls_free_config(request.tls_config);
-      request.tls_config = NULL;
-    }
-#endif
     return DOWNLOAD_CANNOTSTARTDOWNLOAD_ERROR;
   }
   return DOWNLOAD_OK;
@@ -1917,10 +2003,6 @@ download_err_t appmngr_finish_download_app() {
   }
   DPRINTF("Downloaded.\n");
 
-#if BOOSTER_DOWNLOAD_HTTPS == 1
-  altcp_tls_free_config(request.tls_config);
-#endif
-
   if (download_status != DOWNLOAD_STATUS_COMPLETED) {
     DPRINTF("Error downloading app binary: %i\n", download_status);
     return DOWNLOAD_FORCEDABORT_ERROR;
@@ -1952,6 +2034,16 @@ download_err_t appmngr_finish_download_app() {
   if (memcmp(app_info.md5, app_info.file_md5_digest, sizeof(app_info.md5)) !=
       0) {
     DPRINTF("MD5 hash mismatch\n");
+    if (download_route.mirror != MIRROR_ORIGIN) {
+      // The mirror serves another file. Hold it back and request the
+      // download again from the origin.
+      DPRINTF("Mirror %s served a wrong file. Retrying from the origin.\n",
+              download_route.hostname);
+      mirror_report(&download_route, false);
+      download_from_origin = true;
+      download_status = DOWNLOAD_STATUS_REQUESTED;
+      download_error = DOWNLOAD_OK;
+    }
     return DOWNLOAD_MD5MISMATCH_ERROR;
   } else {
     DPRINTF("MD5 hash match\n");
@@ -2060,10 +2152,6 @@ download_err_t appmngr_finish_download_firmware() {
   }
   DPRINTF("Downloaded.\n");
 
-#if BOOSTER_DOWNLOAD_HTTPS == 1
-  altcp_tls_free_config(request.tls_config);
-#endif
-
   download_firmware_status = DOWNLOAD_STATUS_COMPLETED;
   download_firmware_error = DOWNLOAD_OK;
 
@@ -2170,10 +2258,7 @@ void appmngr_deinit(void) {
     f_close(&file);
   }
 #if BOOSTER_DOWNLOAD_HTTPS == 1
-  if (request.tls_config) {
-    altcp_tls_free_config(request.tls_config);
-    request.tls_config = NULL;
-  }
+  request.tls_config = NULL;  // Shared by all the requests, never freed
 #endif
 
   sdcard_info = (sdcard_info_t){false, 0, 0, false};
@@ -0,0 +1,302 @@
+/**
+ * File: bench.c
+ * Author: Diego Parrilla Santamaría
+ * Date: October 2026
+ * Copyright: 2026 - GOODDATA LABS SL
+ * Description: Network throughput benchmarks served by the HTTP server. A
+ * download of generated data, an upload to a discard sink and an upload to
+ * the SD card, each with the lwIP counters of the run, to tune lwipopts.h and
+ * the WiFi power management with repeatable numbers.
+ */
+
+#include "bench.h"
+
+#include <stdlib.h>
+
+// Only one benchmark runs at a time. The result of the last one is kept.
+static bench_result_t result = {0};
+static void *upload_connection = NULL;
+static uint32_t start_us = 0;
+static uint32_t start_retransmits = 0;
+static uint32_t start_pool_errors = 0;
+static uint32_t download_bytes = BENCH_DEFAULT_BYTES;
+static FIL sd_file;
+static bool sd_file_open = false;
+
+// A custom file of one connection, freed when the server closes it. The
+// download holds only its header, the result holds the whole file.
+#define BENCH_FILE_SIZE 384
+
+typedef struct {
+  int len;  // Bytes of data
+  char data[BENCH_FILE_SIZE];
+} bench_file_t;
+
+// The download being measured. Only its close stops the run.
+static bench_file_t *download_file = NULL;
+
+static void bench_start(bench_mode_t mode) {
+  result = (bench_result_t){0};
+  result.mode = mode;
+  result.running = true;
+#if LWIP_STATS && TCP_STATS
+  start_retransmits = lwip_stats.tcp.rexmit;
+#endif
+#if LWIP_STATS && MEMP_STATS
+  start_pool_errors = lwip_stats.memp[MEMP_PBUF_POOL]->err;
+#endif
+  start_us = time_us_32();
+}
+
+// lwIP counters are 16 bits unless LWIP_STATS_LARGE is set: the difference
+// must be taken in the counter width
+static void bench_stop(void) {
+  result.elapsed_us = time_us_32() - start_us;
+  result.running = false;
+#if LWIP_STATS && TCP_STATS
+  result.retransmits =
+      (STAT_COUNTER)(lwip_stats.tcp.rexmit - (STAT_COUNTER)start_retransmits);
+#else
+  result.retransmits = -1;
+#endif
+#if LWIP_STATS && MEMP_STATS
+  result.pbuf_pool_errors =
+      (STAT_COUNTER)(lwip_stats.memp[MEMP_PBUF_POOL]->err -
+                     (STAT_COUNTER)start_pool_errors);
+#else
+  result.pbuf_pool_errors = -1;
+#endif
+  DPRINTF("Benchmark %d: %lu bytes in %lu us. Rexmit: %ld. Pool errors: %ld\n",
+          result.mode, (unsigned long)result.bytes,
+          (unsigned long)result.elapsed_us, (long)result.retransmits,
+          (long)result.pbuf_pool_errors);
+}
+
+static uint32_t bench_bytes_per_second(void) {
+  if (result.elapsed_us == 0) {
+    return 0;
+  }
+  return (uint32_t)((uint64_t)result.bytes * 1000000u / result.elapsed_us);
+}
+
+static const char *bench_mode_name(bench_mode_t mode) {
+  switch (mode) {
+    case BENCH_MODE_DOWNLOAD:
+      return "download";
+    case BENCH_MODE_UPLOAD:
+      return "upload";
+    case BENCH_MODE_UPLOAD_SD:
+      return "upload_sd";
+    default:
+      return "none";
+  }
+}
+
+const char *bench_cgi_download(int iIndex, int iNumParams, char *pcParam[],
+                               char *pcValue[]) {
+  download_bytes = BENCH_DEFAULT_BYTES;
+  for (int i = 0; i < iNumParams; i++) {
+    if (strcmp(pcParam[i], "bytes") == 0) {
+      long bytes = strtol(pcValue[i], NULL, 10);
+      if (bytes > 0) {
+        download_bytes =
+            (bytes > BENCH_MAX_BYTES) ? BENCH_MAX_BYTES : (uint32_t)bytes;
+      }
+    }
+  }
+  return BENCH_DOWNLOAD_URI;
+}
+
+bool bench_post_begin(void *connection, const char *uri, char *response_uri,
+                      u16_t response_uri_len) {
+  if (strncmp(uri, BENCH_UPLOAD_URI, strlen(BENCH_UPLOAD_URI)) != 0) {
+    return false;
+  }
+  bench_mode_t mode = (strstr(uri, "sd=1") != NULL) ? BENCH_MODE_UPLOAD_SD
+                                                    : BENCH_MODE_UPLOAD;
+  if (sd_file_open) {
+    f_close(&sd_file);
+    sd_file_open = false;
+  }
+  if (mode == BENCH_MODE_UPLOAD_SD) {
+    FRESULT res =
+        f_open(&sd_file, BENCH_SD_FILENAME, FA_WRITE | FA_CREATE_ALWAYS);
+    if (res != FR_OK) {
+      DPRINTF("Error opening %s: %i\n", BENCH_SD_FILENAME, res);
+      return false;
+    }
+    sd_file_open = true;
+  }
+  upload_connection = connection;
+  bench_start(mode);
+  snprintf(response_uri, response_uri_len, BENCH_RESULT_URI);
+  return true;
+}
+
+bool bench_post_receive(void *connection, struct pbuf *p) {
+  if (connection != upload_connection) {
+    return false;
+  }
+  result.bytes += p->tot_len;
+  if (sd_file_open) {
+    for (struct pbuf *q = p; q != NULL; q = q->next) {
+      UINT bw = 0;
+      if (f_write(&sd_file, q->payload, q->len, &bw) != FR_OK ||
+          bw != q->len) {
+        result.sd_errors++;
+        metrics_inc(METRICS_SD_ERRORS);
+      }
+    }
+  }
+  pbuf_free(p);
+  return true;
+}
+
+bool bench_post_finished(void *connection, char *response_uri,
+                         u16_t response_uri_len) {
+  if (connection != upload_connection) {
+    return false;
+  }
+  upload_connection = NULL;
+  if (sd_file_open) {
+    // The data is on the card only after the sync
+    if (f_sync(&sd_file) != FR_OK) {
+      result.sd_errors++;
+      metrics_inc(METRICS_SD_ERRORS);
+    }
+    f_close(&sd_file);
+    f_unlink(BENCH_SD_FILENAME);
+    sd_file_open = false;
+  }
+  bench_stop();
+  snprintf(response_uri, response_uri_len, BENCH_RESULT_URI);
+  return true;
+}
+
+const bench_result_t *bench_get_result(void) { return &result; }
+
+// Custom files of the HTTP server. Their headers are part of the data, like
+// the files generated in fsdata. The metrics and trace files are served from
+// here too.
+
+static void bench_open_file(struct fs_file *file, const char *data, int len) {
+  memset(file, 0, sizeof(*file));
+  file->data = data;
+  file->len = len;
+  file->flags = FS_FILE_FLAGS_HEADER_INCLUDED;
+}
+
+int fs_open_custom(struct fs_file *file, const char *name) {
+  // Every file the server opens goes through here first. A request may open
+  // several: the default pages of a directory, the 404 page.
+  metrics_inc(METRICS_HTTPD_FILE_OPENS);
+  if (metrics_open_file(file, name) || trace_open_file(file, name)) {
+    return 1;
+  }
+  bool download = strcmp(name, BENCH_DOWNLOAD_URI) == 0;
+  if (!download && strcmp(name, BENCH_RESULT_URI) != 0) {
+    return 0;
+  }
+  // Several connections may fetch the files at once: each gets its own copy
+  bench_file_t *bench_file = malloc(sizeof(bench_file_t));
+  if (bench_file == NULL) {
+    DPRINTF("No memory for %s\n", name);
+    return 0;
+  }
+  if (download) {
+    bench_file->len = snprintf(
+        bench_file->data, sizeof(bench_file->data),
+        "HTTP/1.1 200 OK\r\n"
+        "Content-Type: application/octet-stream\r\n"
+        "Content-Length: %lu\r\n"
+        "Cache-Control: no-store\r\n"
+        "Connection: close\r\n\r\n",
+        (unsigned long)download_bytes);
+    // No data pointer: the server reads it with fs_read_async_custom()
+    bench_open_file(file, NULL, bench_file->len + (int)download_bytes);
+    file->pextension = bench_file;
+    download_file = bench_file;
+    bench_start(BENCH_MODE_DOWNLOAD);
+    return 1;
+  }
+  char body[256];
+  int body_len = snprintf(
+      body, sizeof(body),
+      "{\"mode\": \"%s\", \"running\": %s, \"bytes\": %lu, \"us\": %lu, "
+      "\"bytes_per_s\": %lu, \"retransmits\": %ld, "
+      "\"pbuf_pool_errors\": %ld, \"sd_errors\": %lu}",
+      bench_mode_name(result.mode), result.running ? "true" : "false",
+      (unsigned long)result.bytes, (unsigned long)result.elapsed_us,
+      (unsigned long)bench_bytes_per_second(), (long)result.retransmits,
+      (long)result.pbuf_pool_errors, (unsigned long)result.sd_errors);
+  bench_file->len = snprintf(bench_file->data, sizeof(bench_file->data),
+                             "HTTP/1.1 200 OK\r\n"
+                             "Content-Type: application/json\r\n"
+                             "Content-Length: %d\r\n"
+                             "Cache-Control: no-store\r\n"
+                             "Connection: close\r\n\r\n%s",
+                             body_len, body);
+  bench_open_file(file, bench_file->data, bench_file->len);
+  file->pextension = bench_file;
+  return 1;
+}
+
+void fs_close_custom(struct fs_file *file) {
+  metrics_close_file(file);
+  if (trace_close_file(file) || file->pextension == NULL) {
+    return;
+  }
+  bench_file_t *bench_file = (bench_file_t *)file->pextension;
+  if (bench_file == download_file) {
+    download_file = NULL;
+    if (result.running && result.mode == BENCH_MODE_DOWNLOAD) {
+      // Closed when the last byte is queued, or when the client goes away,
+      // maybe before the whole header is sent
+      int sent = file->index - bench_file->len;
+      result.bytes = (sent > 0) ? (uint32_t)sent : 0;
+      bench_stop();
+    }
+  }
+  file->pextension = NULL;
+  free(bench_file);
+}
+
+int fs_read_async_custom(struct fs_file *file, char *buffer, int count,
+                         fs_wait_cb callback_fn, void *callback_arg) {
+  LWIP_UNUSED_ARG(callback_fn);
+  LWIP_UNUSED_ARG(callback_arg);
+  int left = file->len - file->index;
+  if (left <= 0) {
+    return FS_READ_EOF;
+  }
+  if (count > left) {
+    count = left;
+  }
+  int traced = trace_read_file(file, buffer, count);
+  if (traced >= 0) {
+    return traced;
+  }
+  const bench_file_t *bench_file = (const bench_file_t *)file->pextension;
+  const char *header = bench_file->data;
+  int header_len = bench_file->len;
+  for (int i = 0; i < count; i++) {
+    int pos = file->index + i;
+    // A pattern a client can verify, cheaper than a random generator
+    buffer[i] = (pos < header_len) ? header[pos] : (char)(pos - header_len);
+  }
+  file->index += count;
+  return count;
+}
+
+u8_t fs_canread_custom(struct fs_file *file) {
+  LWIP_UNUSED_ARG(file);
+  return 1;  // Generated on the fly, never waits
+}
+
+u8_t fs_wait_read_custom(struct fs_file *file, fs_wait_cb callback_fn,
+                         void *callback_arg) {
+  LWIP_UNUSED_ARG(file);
+  LWIP_UNUSED_ARG(callback_fn);
+  LWIP_UNUSED_ARG(callback_arg);
+  return 1;
+}
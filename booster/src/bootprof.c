@@ -0,0 +1,92 @@
+/**
+ * File: bootprof.c
+ * Author: Diego Parrilla Santamaría
+ * Date: October 2026
+ * Copyright: 2026 - GOODDATA LABS SL
+ * Description: Boot phases timing profiler. Records the raw timer at the end
+ * of each boot phase so the startup time can be compared across builds.
+ */
+
+#include "bootprof.h"
+
+static uint32_t bootprof_starts[BOOTPROF_PHASE_COUNT] = {0};
+static uint32_t bootprof_marks[BOOTPROF_PHASE_COUNT] = {0};
+
+static const char *bootprof_names[BOOTPROF_PHASE_COUNT] = {
+    "main",
+    "gconfig",
+    "firmware_copy",
+    "term_init",
+    "romemul_init",
+    "boot_feature",
+    "appmngr_init",
+    "wifi_init",
+    "sdcard_mount",
+    "lookup_sync",
+    "wifi_connect",
+    "version_check",
+    "sdcard_wait",
+    "catalog_load",
+    "httpd_start",
+    "ready"};
+
+void __not_in_flash_func(bootprof_begin)(bootprof_phase_t phase) {
+  if (phase < BOOTPROF_PHASE_COUNT) {
+    bootprof_starts[phase] = timer_hw->timerawl;
+  }
+}
+
+void __not_in_flash_func(bootprof_mark)(bootprof_phase_t phase) {
+  if (phase < BOOTPROF_PHASE_COUNT) {
+    // Low word of the microsecond timer. The marks are read as times since
+    // boot, so the boot must end before the word wraps, after 71 minutes.
+    // A zero mark means the phase was not reached.
+    bootprof_marks[phase] = timer_hw->timerawl;
+  }
+}
+
+uint32_t bootprof_get_end_us(bootprof_phase_t phase) {
+  return (phase < BOOTPROF_PHASE_COUNT) ? bootprof_marks[phase] : 0;
+}
+
+uint32_t bootprof_get_duration_us(bootprof_phase_t phase) {
+  if (phase >= BOOTPROF_PHASE_COUNT || bootprof_marks[phase] == 0) {
+    return 0;
+  }
+  if (bootprof_starts[phase] != 0) {
+    return bootprof_marks[phase] - bootprof_starts[phase];
+  }
+  for (int i = (int)phase - 1; i >= 0; i--) {
+    if (bootprof_marks[i] != 0) {
+      return bootprof_marks[phase] - bootprof_marks[i];
+    }
+  }
+  return bootprof_marks[phase];
+}
+
+const char *bootprof_get_name(bootprof_phase_t phase) {
+  return (phase < BOOTPROF_PHASE_COUNT) ? bootprof_names[phase] : "unknown";
+}
+
+uint32_t bootprof_get_total_us(void) {
+  for (int i = BOOTPROF_PHASE_COUNT - 1; i >= 0; i--) {
+    if (bootprof_marks[i] != 0) {
+      return bootprof_marks[i];
+    }
+  }
+  return 0;
+}
+
+void bootprof_print(void) {
+  DPRINTF("Boot timeline (%s):\n", RELEASE_VERSION);
+  for (int i = 0; i < BOOTPROF_PHASE_COUNT; i++) {
+    if (bootprof_marks[i] == 0) {
+      DPRINTF("  %-16s skipped\n", bootprof_names[i]);
+    } else {
+      DPRINTF("  %-16s %8lu us at %10lu us\n", bootprof_names[i],
+              (unsigned long)bootprof_get_duration_us(i),
+              (unsigned long)bootprof_marks[i]);
+    }
+  }
+  DPRINTF("Boot total: %lu us\n", (unsigned long)bootprof_get_total_us());
+}
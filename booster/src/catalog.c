@@ -0,0 +1,792 @@
+/**
+ * File: catalog.c
+ * Author: Diego Parrilla Santamaría
+ * Date: October 2026
+ * Copyright: 2026 - GOODDATA LABS SL
+ * Description: Device-side cache of the apps catalog. The catalog is fetched
+ * in the background with a conditional GET and stored in the apps folder as a
+ * compact index (per-app offsets and tag/device bitmasks) so the browser and
+ * the terminal can browse it without downloading the whole JSON each time.
+ */
+
+#include "catalog.h"
+
+#include <ctype.h>
+#include <stdlib.h>
+#include <strings.h>
+
+static catalog_status_t catalog_status = CATALOG_STATUS_EMPTY;
+static catalog_header_t catalog_header = {0};
+static catalog_entry_t catalog_entries[CATALOG_MAX_APPS];
+static catalog_stats_t catalog_stats = {0};
+static absolute_time_t next_fetch_time = {0};
+static bool catalog_initialized = false;
+
+// Conditional GET state
+static HTTPC_REQUEST_T request = {0};
+static char request_host_buf[256];
+static char request_uri_buf[512];
+static FIL download_file;
+static bool download_file_open = false;
+static bool download_failed = false;
+static uint32_t download_bytes = 0;
+static uint32_t download_server_status = 0;
+static uint32_t fetch_url_hash = 0;
+static uint32_t fetch_start_us = 0;
+static bool request_in_flight = false;  // The HTTP client owns the request
+// Set when the fetch timed out. lwIP may still call back until it closes the
+// connection, so the callbacks stop storing the body.
+static volatile bool fetch_abandoned = false;
+static char pending_etag[CATALOG_ETAG_LENGTH];
+static char pending_last_modified[CATALOG_LAST_MODIFIED_LENGTH];
+
+// Reader used by the HTTP server to stream the app objects
+static FIL reader_file;
+static bool reader_open = false;
+
+// Set while the index is rebuilt outside the lwIP lock. The HTTP server then
+// sees an empty catalog and does not open the index.
+static volatile bool catalog_rebuilding = false;
+static const catalog_header_t catalog_empty_header = {0};
+
+// FNV-1a. Only used to detect a change of PARAM_APPS_CATALOG_URL.
+static uint32_t catalog_hash_string(const char *str) {
+  uint32_t hash = 2166136261u;
+  while (str != NULL && *str) {
+    hash ^= (uint8_t)*str++;
+    hash *= 16777619u;
+  }
+  return hash;
+}
+
+static const char *catalog_get_url(void) {
+  SettingsConfigEntry *entry =
+      settings_find_entry(gconfig_getContext(), PARAM_APPS_CATALOG_URL);
+  return (entry != NULL) ? entry->value : "";
+}
+
+static void catalog_get_path(const char *filename, char path[256]) {
+  snprintf(path, 256, "%s/%s",
+           settings_find_entry(gconfig_getContext(), PARAM_APPS_FOLDER)->value,
+           filename);
+}
+
+// Extract the components of the URL (http/https://host[/uri])
+static int parse_url(const char *url, url_components_t *components) {
+  if (!url || !components) return -1;
+  memset(components, 0, sizeof(*components));
+
+  const char *protocol_end = strstr(url, "://");
+  if (!protocol_end) return -1;
+
+  size_t protocol_len = (size_t)(protocol_end - url);
+  if (protocol_len == 0 || protocol_len >= sizeof(components->protocol))
+    return -1;
+  memcpy(components->protocol, url, protocol_len);
+  components->protocol[protocol_len] = '\0';
+
+  const char *host_start = protocol_end + 3;  // skip ://
+  const char *uri_start = strchr(host_start, '/');
+  if (uri_start) {
+    size_t host_len = (size_t)(uri_start - host_start);
+    if (host_len == 0 || host_len >= sizeof(components->host)) return -1;
+    memcpy(components->host, host_start, host_len);
+    components->host[host_len] = '\0';
+
+    if (strlen(uri_start) >= sizeof(components->uri)) return -1;
+    strcpy(components->uri, uri_start);
+  } else {
+    if (strlen(host_start) == 0 ||
+        strlen(host_start) >= sizeof(components->host))
+      return -1;
+    strcpy(components->host, host_start);
+    components->uri[0] = '/';
+    components->uri[1] = '\0';
+  }
+  return 0;
+}
+
+void catalog_close_reader(void) {
+  if (reader_open) {
+    f_close(&reader_file);
+    reader_open = false;
+  }
+}
+
+static void catalog_clear(void) {
+  catalog_close_reader();
+  memset(&catalog_header, 0, sizeof(catalog_header));
+  memset(catalog_entries, 0, sizeof(catalog_entries));
+  catalog_status = CATALOG_STATUS_EMPTY;
+}
+
+// Load the compact index from the SD card. Only the header and the entries are
+// kept in RAM; the app objects are read on demand.
+static bool catalog_load_index(void) {
+  char path[256];
+  catalog_get_path(CATALOG_INDEX_FILENAME, path);
+
+  catalog_clear();
+
+  FIL fil;
+  FRESULT res = f_open(&fil, path, FA_READ);
+  if (res != FR_OK) {
+    DPRINTF("No catalog index found at %s (res=%d)\n", path, res);
+    return false;
+  }
+
+  UINT br = 0;
+  res = f_read(&fil, &catalog_header, sizeof(catalog_header), &br);
+  if (res != FR_OK || br != sizeof(catalog_header) ||
+      catalog_header.magic != CATALOG_INDEX_MAGIC ||
+      catalog_header.version != CATALOG_INDEX_VERSION ||
+      catalog_header.app_count > CATALOG_MAX_APPS) {
+    DPRINTF("Invalid catalog index header in %s\n", path);
+    f_close(&fil);
+    catalog_clear();
+    return false;
+  }
+
+  UINT entries_size = catalog_header.app_count * sizeof(catalog_entry_t);
+  res = f_read(&fil, catalog_entries, entries_size, &br);
+  f_close(&fil);
+  if (res != FR_OK || br != entries_size) {
+    DPRINTF("Error reading catalog entries from %s (res=%d)\n", path, res);
+    catalog_clear();
+    return false;
+  }
+
+  if (catalog_header.url_hash != catalog_hash_string(catalog_get_url())) {
+    DPRINTF("Catalog index built from another URL. Ignoring it.\n");
+    catalog_clear();
+    return false;
+  }
+
+  catalog_status = CATALOG_STATUS_READY;
+  return true;
+}
+
+// Find or add a label in a dictionary of the header. Returns the bit index or
+// -1 if the dictionary is full.
+static int catalog_label_index(char labels[][CATALOG_LABEL_LENGTH],
+                               uint8_t *count, uint8_t max,
+                               const char *label) {
+  for (uint8_t i = 0; i < *count; i++) {
+    if (strncmp(labels[i], label, CATALOG_LABEL_LENGTH - 1) == 0) {
+      return i;
+    }
+  }
+  if (*count >= max) {
+    DPRINTF("Catalog label dictionary full. Ignoring %s\n", label);
+    return -1;
+  }
+  snprintf(labels[*count], CATALOG_LABEL_LENGTH, "%s", label);
+  return (*count)++;
+}
+
+static uint32_t catalog_build_mask(cJSON *array,
+                                   char labels[][CATALOG_LABEL_LENGTH],
+                                   uint8_t *count, uint8_t max) {
+  uint32_t mask = 0;
+  cJSON *item = NULL;
+  cJSON_ArrayForEach(item, array) {
+    if (!cJSON_IsString(item)) continue;
+    int bit = catalog_label_index(labels, count, max, item->valuestring);
+    if (bit >= 0) mask |= (1u << bit);
+  }
+  return mask;
+}
+
+// Convert the raw catalog into the compact index:
+//   catalog_header_t | catalog_entry_t[app_count] | app objects
+static download_catalog_err_t catalog_build_index(void) {
+  char raw_path[256];
+  char idx_path[256];
+  catalog_get_path(CATALOG_RAW_FILENAME, raw_path);
+  catalog_get_path(CATALOG_INDEX_FILENAME, idx_path);
+
+  FIL fil;
+  FRESULT res = f_open(&fil, raw_path, FA_READ);
+  if (res != FR_OK) {
+    DPRINTF("Cannot open raw catalog %s (res=%d)\n", raw_path, res);
+    return DOWNLOAD_CREATECATALOG_CANNOTOPENFILE_ERROR;
+  }
+  FSIZE_t raw_size = f_size(&fil);
+  if (raw_size == 0 || raw_size > CATALOG_MAX_JSON_SIZE) {
+    DPRINTF("Raw catalog size out of range: %u\n", (unsigned)raw_size);
+    f_close(&fil);
+    return DOWNLOAD_CREATECATALOG_JSON_ERROR;
+  }
+  char *raw = malloc((size_t)raw_size + 1);
+  if (raw == NULL) {
+    DPRINTF("Cannot allocate %u bytes for the raw catalog\n",
+            (unsigned)raw_size);
+    f_close(&fil);
+    return DOWNLOAD_CREATECATALOG_ERROR;
+  }
+  UINT br = 0;
+  res = f_read(&fil, raw, (UINT)raw_size, &br);
+  f_close(&fil);
+  if (res != FR_OK || br != raw_size) {
+    DPRINTF("Error reading raw catalog (res=%d)\n", res);
+    free(raw);
+    return DOWNLOAD_CREATECATALOG_CANNOTOPENFILE_ERROR;
+  }
+  raw[br] = '\0';
+
+  cJSON *root = cJSON_Parse(raw);
+  free(raw);
+  cJSON *apps = cJSON_GetObjectItem(root, "apps");
+  if (root == NULL || !cJSON_IsArray(apps)) {
+    DPRINTF("Raw catalog is not a valid apps catalog\n");
+    cJSON_Delete(root);
+    jsonarena_reset();
+    return DOWNLOAD_CREATECATALOG_JSON_ERROR;
+  }
+
+  catalog_clear();
+  catalog_header.magic = CATALOG_INDEX_MAGIC;
+  catalog_header.version = CATALOG_INDEX_VERSION;
+  catalog_header.url_hash = fetch_url_hash;
+  snprintf(catalog_header.etag, sizeof(catalog_header.etag), "%s",
+           pending_etag);
+  snprintf(catalog_header.last_modified, sizeof(catalog_header.last_modified),
+           "%s", pending_last_modified);
+
+  int total = cJSON_GetArraySize(apps);
+  catalog_header.total_count = (uint16_t)(total > UINT16_MAX ? UINT16_MAX
+                                                             : total);
+  if (total > CATALOG_MAX_APPS) {
+    DPRINTF("Catalog has %d apps. Only %d are cached.\n", total,
+            CATALOG_MAX_APPS);
+    total = CATALOG_MAX_APPS;
+  }
+  catalog_header.blob_offset =
+      sizeof(catalog_header_t) + total * sizeof(catalog_entry_t);
+
+  res = f_open(&fil, idx_path, FA_WRITE | FA_CREATE_ALWAYS);
+  if (res == FR_OK) {
+    res = f_lseek(&fil, catalog_header.blob_offset);
+    if (res != FR_OK) {
+      f_close(&fil);
+    }
+  }
+  if (res != FR_OK) {
+    DPRINTF("Cannot create catalog index %s (res=%d)\n", idx_path, res);
+    cJSON_Delete(root);
+    jsonarena_reset();
+    return DOWNLOAD_CREATECATALOG_CANNOTOPENFILE_ERROR;
+  }
+
+  download_catalog_err_t err = DOWNLOAD_CREATECATALOG_OK;
+  uint16_t count = 0;
+  uint32_t blob_size = 0;
+  cJSON *app = NULL;
+  cJSON_ArrayForEach(app, apps) {
+    if (count >= total) break;
+    cJSON *uuid = cJSON_GetObjectItem(app, "uuid");
+    cJSON *name = cJSON_GetObjectItem(app, "name");
+    cJSON *version = cJSON_GetObjectItem(app, "version");
+    if (!cJSON_IsString(uuid) || !cJSON_IsString(name)) {
+      DPRINTF("Skipping catalog app without uuid or name\n");
+      continue;
+    }
+
+    char *object = cJSON_PrintUnformatted(app);
+    if (object == NULL) {
+      err = DOWNLOAD_CREATECATALOG_ERROR;
+      break;
+    }
+    UINT length = (UINT)strlen(object);
+    UINT bw = 0;
+    res = f_write(&fil, object, length, &bw);
+    cJSON_free(object);
+    if (res != FR_OK || bw != length) {
+      DPRINTF("Error writing catalog index (res=%d)\n", res);
+      err = DOWNLOAD_CREATECATALOG_CANNOTWRITEFILE_ERROR;
+      break;
+    }
+
+    catalog_entry_t *entry = &catalog_entries[count++];
+    snprintf(entry->uuid, sizeof(entry->uuid), "%s", uuid->valuestring);
+    snprintf(entry->name, sizeof(entry->name), "%s", name->valuestring);
+    snprintf(entry->version, sizeof(entry->version), "%s",
+             cJSON_IsString(version) ? version->valuestring : "");
+    entry->tag_mask = catalog_build_mask(
+        cJSON_GetObjectItem(app, "tags"), catalog_header.tags,
+        &catalog_header.tag_count, CATALOG_MAX_TAGS);
+    entry->device_mask = catalog_build_mask(
+        cJSON_GetObjectItem(app, "devices"), catalog_header.devices,
+        &catalog_header.device_count, CATALOG_MAX_DEVICES);
+    entry->offset = blob_size;
+    entry->length = length;
+    blob_size += length;
+  }
+  cJSON_Delete(root);
+  jsonarena_reset();
+
+  if (err == DOWNLOAD_CREATECATALOG_OK) {
+    // Skipped apps leave a gap between the entries and the blobs. Keep the
+    // blob offset where the objects were written.
+    catalog_header.app_count = count;
+    catalog_header.blob_size = blob_size;
+    UINT bw = 0;
+    res = f_lseek(&fil, 0);
+    if (res == FR_OK) {
+      res = f_write(&fil, &catalog_header, sizeof(catalog_header), &bw);
+    }
+    if (res == FR_OK) {
+      res = f_write(&fil, catalog_entries, count * sizeof(catalog_entry_t),
+                    &bw);
+    }
+    if (res != FR_OK) {
+      DPRINTF("Error writing catalog index header (res=%d)\n", res);
+      err = DOWNLOAD_CREATECATALOG_CANNOTWRITEFILE_ERROR;
+    }
+  }
+  if (f_close(&fil) != FR_OK && err == DOWNLOAD_CREATECATALOG_OK) {
+    err = DOWNLOAD_CREATECATALOG_CANNOTWRITEFILE_ERROR;
+  }
+
+  if (err != DOWNLOAD_CREATECATALOG_OK) {
+    f_unlink(idx_path);
+    catalog_clear();
+    return err;
+  }
+
+  catalog_status = CATALOG_STATUS_READY;
+  DPRINTF("Catalog index built: %u apps, %u tags, %u devices, %u bytes\n",
+          count, catalog_header.tag_count, catalog_header.device_count,
+          (unsigned)(catalog_header.blob_offset + blob_size));
+  return DOWNLOAD_CREATECATALOG_OK;
+}
+
+// ------------------- HTTP callbacks -------------------
+
+// Copy the value of a header line into dest, without the leading blanks
+static void catalog_copy_header_value(const char *line, size_t line_len,
+                                      size_t label_len, char *dest,
+                                      size_t dest_len) {
+  const char *value = line + label_len;
+  const char *end = line + line_len;
+  while (value < end && (*value == ' ' || *value == '\t')) ++value;
+  size_t len = (size_t)(end - value);
+  if (len >= dest_len) len = dest_len - 1;
+  memcpy(dest, value, len);
+  dest[len] = '\0';
+}
+
+static err_t http_client_header_catalog_fn(__unused httpc_state_t *connection,
+                                           __unused void *arg,
+                                           struct pbuf *hdr, u16_t hdr_len,
+                                           u32_t content_len) {
+  char buf[512];
+  u16_t copy = hdr_len < sizeof(buf) - 1 ? hdr_len : (sizeof(buf) - 1);
+  pbuf_copy_partial(hdr, buf, copy, 0);
+  buf[copy] = '\0';
+
+  // Status line: "HTTP/1.1 304 Not Modified"
+  const char *code = strchr(buf, ' ');
+  download_server_status = code ? (uint32_t)strtoul(code + 1, NULL, 10) : 0;
+  if (fetch_abandoned) {
+    download_failed = true;
+    return ERR_ABRT;
+  }
+  if (download_server_status != 200) {
+    // 304 or an error: nothing to store, keep the current cache
+    return ERR_OK;
+  }
+  if (content_len != 0xFFFFFFFF && content_len > CATALOG_MAX_JSON_SIZE) {
+    DPRINTF("Catalog too large: %u > %u\n", (unsigned)content_len,
+            CATALOG_MAX_JSON_SIZE);
+    catalog_stats.oversize = true;
+    download_failed = true;
+    return ERR_VAL;
+  }
+
+  pending_etag[0] = '\0';
+  pending_last_modified[0] = '\0';
+  char *p = buf;
+  while (p && *p) {
+    char *eol = strstr(p, "\r\n");
+    size_t line_len = eol ? (size_t)(eol - p) : strlen(p);
+    if (line_len > 5 && strncasecmp(p, "ETag:", 5) == 0) {
+      catalog_copy_header_value(p, line_len, 5, pending_etag,
+                                sizeof(pending_etag));
+    } else if (line_len > 14 && strncasecmp(p, "Last-Modified:", 14) == 0) {
+      catalog_copy_header_value(p, line_len, 14, pending_last_modified,
+                                sizeof(pending_last_modified));
+    }
+    p = eol ? (eol + 2) : NULL;
+  }
+
+  char path[256];
+  catalog_get_path(CATALOG_TMP_FILENAME, path);
+  FRESULT res = f_open(&download_file, path, FA_WRITE | FA_CREATE_ALWAYS);
+  if (res != FR_OK) {
+    DPRINTF("Cannot open %s to store the catalog (res=%d)\n", path, res);
+    download_failed = true;
+    return ERR_ABRT;
+  }
+  download_file_open = true;
+  return ERR_OK;
+}
+
+static err_t http_client_receive_catalog_fn(__unused void *arg,
+                                            struct altcp_pcb *conn,
+                                            struct pbuf *p, err_t err) {
+  if (p == NULL) {
+    return ERR_OK;
+  }
+  if (err != ERR_OK) {
+    DPRINTF("Error receiving catalog: %d\n", err);
+    download_failed = true;
+    pbuf_free(p);
+    return err;
+  }
+
+  if (fetch_abandoned) {
+    download_failed = true;
+    pbuf_free(p);
+    return ERR_ABRT;
+  }
+  if (download_file_open) {
+    if (download_bytes + p->tot_len > CATALOG_MAX_JSON_SIZE) {
+      DPRINTF("Catalog exceeds %u bytes\n", CATALOG_MAX_JSON_SIZE);
+      catalog_stats.oversize = true;
+      download_failed = true;
+      pbuf_free(p);
+      return ERR_ABRT;
+    }
+    for (struct pbuf *q = p; q != NULL; q = q->next) {
+      UINT bw = 0;
+      FRESULT fres = f_write(&download_file, q->payload, q->len, &bw);
+      if (fres != FR_OK || bw != q->len) {
+        DPRINTF("Error writing catalog: %i\n", fres);
+        download_failed = true;
+        pbuf_free(p);
+        return ERR_ABRT;
+      }
+    }
+    download_bytes += p->tot_len;
+  }
+
+#if BOOSTER_DOWNLOAD_HTTPS == 1
+  altcp_recved(conn, p->tot_len);
+#else
+  tcp_recved(conn, p->tot_len);
+#endif
+  pbuf_free(p);
+  return ERR_OK;
+}
+
+static void http_client_result_catalog_fn(void *arg,
+                                          httpc_result_t httpc_result,
+                                          u32_t rx_content_len, u32_t srv_res,
+                                          err_t err) {
+  HTTPC_REQUEST_T *req = (HTTPC_REQUEST_T *)arg;
+  DPRINTF("Catalog request complete: result %d len %u server_response %u "
+          "err %d\n",
+          httpc_result, rx_content_len, srv_res, err);
+
+  if (download_file_open) {
+    if (f_close(&download_file) != FR_OK) download_failed = true;
+    download_file_open = false;
+  }
+  download_server_status = srv_res;
+  if (err != ERR_OK || (srv_res != 200 && srv_res != 304)) {
+    download_failed = true;
+  }
+  req->complete = true;
+}
+
+// ------------------- driver code -------------------
+
+static bool catalog_start_fetch(void) {
+  const char *url = catalog_get_url();
+  url_components_t components;
+  if (parse_url(url, &components) != 0) {
+    DPRINTF("Error parsing catalog URL: %s\n", url);
+    return false;
+  }
+
+  // A new URL invalidates the cache and its validators
+  fetch_url_hash = catalog_hash_string(url);
+  if (catalog_status == CATALOG_STATUS_READY &&
+      catalog_header.url_hash != fetch_url_hash) {
+    catalog_clear();
+  }
+
+  // lwIP's http client has no hook for extra request headers, but the URI is
+  // copied verbatim into the request line. Append the validators after a
+  // complete request line; the client then terminates the last header with
+  // its own " HTTP/1.1\r\n".
+  int len = snprintf(request_uri_buf, sizeof(request_uri_buf), "%s",
+                     components.uri);
+  if (catalog_status == CATALOG_STATUS_READY &&
+      (catalog_header.etag[0] != '\0' ||
+       catalog_header.last_modified[0] != '\0')) {
+    len += snprintf(request_uri_buf + len, sizeof(request_uri_buf) - len,
+                    " HTTP/1.1\r\n");
+    if (catalog_header.etag[0] != '\0') {
+      len += snprintf(request_uri_buf + len, sizeof(request_uri_buf) - len,
+                      "If-None-Match: %s\r\n", catalog_header.etag);
+    }
+    if (catalog_header.last_modified[0] != '\0') {
+      len += snprintf(request_uri_buf + len, sizeof(request_uri_buf) - len,
+                      "If-Modified-Since: %s\r\n",
+                      catalog_header.last_modified);
+    }
+    len += snprintf(request_uri_buf + len, sizeof(request_uri_buf) - len,
+                    "X-Catalog-Cache: 1");
+    if (len >= (int)sizeof(request_uri_buf)) {
+      // Validators too long: fall back to a plain GET
+      snprintf(request_uri_buf, sizeof(request_uri_buf), "%s", components.uri);
+    }
+  }
+  // Never from a mirror: the catalog holds the MD5 of every app binary, and
+  // the binaries downloaded from a mirror are checked against it
+  snprintf(request_host_buf, sizeof(request_host_buf), "%s", components.host);
+
+  request = (HTTPC_REQUEST_T){0};
+  request.hostname = request_host_buf;
+  request.url = request_uri_buf;
+  request.headers_fn = http_client_header_catalog_fn;
+  request.recv_fn = http_client_receive_catalog_fn;
+  request.result_fn = http_client_result_catalog_fn;
+  download_failed = false;
+  download_file_open = false;
+  download_bytes = 0;
+  download_server_status = 0;
+  fetch_abandoned = false;
+
+#if BOOSTER_DOWNLOAD_HTTPS == 1
+  request.tls_config = http_client_tls_config();
+#endif
+
+  fetch_start_us = time_us_32();
+  int rc = http_client_request_async(cyw43_arch_async_context(), &request);
+  if (rc != 0) {
+    DPRINTF("Error starting the catalog download: %d\n", rc);
+    return false;
+  }
+  request_in_flight = true;
+  DPRINTF("Catalog fetch started: %s%s\n", components.host, components.uri);
+  catalog_stats.fetches++;
+  return true;
+}
+
+// Replace the raw catalog with the downloaded one and rebuild the index
+static void catalog_install_download(void) {
+  char tmp_path[256];
+  char raw_path[256];
+  catalog_get_path(CATALOG_TMP_FILENAME, tmp_path);
+  catalog_get_path(CATALOG_RAW_FILENAME, raw_path);
+
+  uint32_t start_us = time_us_32();
+
+  // The HTTP server may be streaming the index from the background context.
+  // Hold the lock only to stop it: the rebuild reads, parses and writes up to
+  // CATALOG_MAX_JSON_SIZE and would stall the network.
+  cyw43_arch_lwip_begin();
+  catalog_rebuilding = true;
+  catalog_close_reader();
+  cyw43_arch_lwip_end();
+
+  f_unlink(raw_path);
+  FRESULT res = f_rename(tmp_path, raw_path);
+  download_catalog_err_t err = DOWNLOAD_CREATECATALOG_CANNOTWRITEFILE_ERROR;
+  if (res == FR_OK) {
+    err = catalog_build_index();
+  } else {
+    DPRINTF("Cannot rename %s to %s (res=%d)\n", tmp_path, raw_path, res);
+  }
+
+  cyw43_arch_lwip_begin();
+  catalog_rebuilding = false;
+  cyw43_arch_lwip_end();
+
+  catalog_stats.build_us = time_us_32() - start_us;
+  if (err == DOWNLOAD_CREATECATALOG_OK) {
+    catalog_stats.source = CATALOG_SOURCE_COLD;
+    catalog_stats.load_us = catalog_stats.fetch_us + catalog_stats.build_us;
+    DPRINTF("Catalog cold load: fetch %u us, build %u us\n",
+            catalog_stats.fetch_us, catalog_stats.build_us);
+  } else {
+    DPRINTF("Error building the catalog index: %d\n", err);
+  }
+}
+
+void catalog_init(void) {
+  catalog_clear();
+  memset(&catalog_stats, 0, sizeof(catalog_stats));
+  catalog_initialized = appmngr_get_sdcard_info()->ready;
+  if (!catalog_initialized) {
+    DPRINTF("SD card not ready. Catalog cache disabled.\n");
+    return;
+  }
+
+  uint32_t start_us = time_us_32();
+  if (catalog_load_index()) {
+    catalog_stats.source = CATALOG_SOURCE_WARM;
+    catalog_stats.load_us = time_us_32() - start_us;
+    DPRINTF("Catalog warm load: %u apps in %u us\n", catalog_header.app_count,
+            catalog_stats.load_us);
+  }
+  next_fetch_time = make_timeout_time_ms(CATALOG_FIRST_FETCH_DELAY_MS);
+}
+
+void catalog_request_refresh(void) {
+  next_fetch_time = make_timeout_time_ms(0);
+}
+
+void catalog_loop(bool network_ready) {
+  if (!catalog_initialized) {
+    return;
+  }
+
+  switch (catalog_status) {
+    case CATALOG_STATUS_FETCHING: {
+      uint32_t elapsed_us = time_us_32() - fetch_start_us;
+      if (!request.complete) {
+        if (elapsed_us >= CATALOG_FETCH_TIMEOUT_MS * 1000u) {
+          // lwIP closes the connection on its own timeout. Until then the
+          // request buffers stay busy and no new fetch is started.
+          DPRINTF("Catalog fetch timed out after %u ms\n",
+                  (unsigned)CATALOG_FETCH_TIMEOUT_MS);
+          fetch_abandoned = true;
+          catalog_stats.fetch_us = elapsed_us;
+          catalog_status = (catalog_header.app_count > 0)
+                               ? CATALOG_STATUS_READY
+                               : CATALOG_STATUS_EMPTY;
+          next_fetch_time = make_timeout_time_ms(CATALOG_RETRY_INTERVAL_MS);
+        }
+        break;
+      }
+      request_in_flight = false;
+      catalog_stats.fetch_us = elapsed_us;
+      if (download_failed) {
+        DPRINTF("Catalog fetch failed (server status %u)\n",
+                (unsigned)download_server_status);
+        catalog_status = (catalog_header.app_count > 0)
+                             ? CATALOG_STATUS_READY
+                             : CATALOG_STATUS_EMPTY;
+        next_fetch_time = make_timeout_time_ms(CATALOG_RETRY_INTERVAL_MS);
+      } else if (download_server_status == 304) {
+        catalog_stats.oversize = false;
+        catalog_status = CATALOG_STATUS_NOT_MODIFIED;
+      } else {
+        catalog_stats.oversize = false;
+        catalog_status = CATALOG_STATUS_DOWNLOADED;
+      }
+      break;
+    }
+    case CATALOG_STATUS_NOT_MODIFIED: {
+      DPRINTF("Catalog not modified in %u us\n", catalog_stats.fetch_us);
+      catalog_stats.not_modified++;
+      catalog_status = CATALOG_STATUS_READY;
+      next_fetch_time = make_timeout_time_ms(CATALOG_REFRESH_INTERVAL_MS);
+      break;
+    }
+    case CATALOG_STATUS_DOWNLOADED: {
+      catalog_install_download();
+      next_fetch_time = make_timeout_time_ms(
+          (catalog_status == CATALOG_STATUS_READY)
+              ? CATALOG_REFRESH_INTERVAL_MS
+              : CATALOG_RETRY_INTERVAL_MS);
+      break;
+    }
+    default: {
+      if (request_in_flight) {
+        // A timed out fetch still owns the request until lwIP gives it up
+        if (!request.complete) {
+          break;
+        }
+        request_in_flight = false;
+      }
+      if (!network_ready ||
+          absolute_time_diff_us(get_absolute_time(), next_fetch_time) > 0) {
+        break;
+      }
+      if (catalog_start_fetch()) {
+        catalog_status = CATALOG_STATUS_FETCHING;
+      } else {
+        next_fetch_time = make_timeout_time_ms(CATALOG_RETRY_INTERVAL_MS);
+      }
+      break;
+    }
+  }
+}
+
+catalog_status_t catalog_get_status(void) { return catalog_status; }
+
+const catalog_header_t *catalog_get_header(void) {
+  return catalog_rebuilding ? &catalog_empty_header : &catalog_header;
+}
+
+const catalog_stats_t *catalog_get_stats(void) { return &catalog_stats; }
+
+uint16_t catalog_get_count(void) {
+  return catalog_rebuilding ? 0 : catalog_header.app_count;
+}
+
+bool catalog_is_truncated(void) {
+  return catalog_stats.oversize ||
+         (!catalog_rebuilding && catalog_header.total_count > CATALOG_MAX_APPS);
+}
+
+const catalog_entry_t *catalog_get_entry(uint16_t index) {
+  if (catalog_rebuilding || index >= catalog_header.app_count) {
+    return NULL;
+  }
+  return &catalog_entries[index];
+}
+
+bool catalog_entry_matches(const catalog_entry_t *entry, uint32_t tag_mask,
+                           uint32_t device_mask) {
+  if (entry == NULL) {
+    return false;
+  }
+  if (tag_mask != 0 && (entry->tag_mask & tag_mask) == 0) {
+    return false;
+  }
+  if (device_mask != 0 && (entry->device_mask & device_mask) == 0) {
+    return false;
+  }
+  return true;
+}
+
+int catalog_read_app_chunk(uint16_t index, uint32_t offset, char *buf,
+                           uint32_t len) {
+  const catalog_entry_t *entry = catalog_get_entry(index);
+  if (entry == NULL || buf == NULL) {
+    return -1;
+  }
+  if (offset >= entry->length) {
+    return 0;
+  }
+  if (!reader_open) {
+    char path[256];
+    catalog_get_path(CATALOG_INDEX_FILENAME, path);
+    if (f_open(&reader_file, path, FA_READ) != FR_OK) {
+      DPRINTF("Cannot open catalog index %s\n", path);
+      return -1;
+    }
+    reader_open = true;
+  }
+  if (len > entry->length - offset) {
+    len = entry->length - offset;
+  }
+  UINT br = 0;
+  FRESULT res = f_lseek(&reader_file,
+                        catalog_header.blob_offset + entry->offset + offset);
+  if (res == FR_OK) {
+    res = f_read(&reader_file, buf, len, &br);
+  }
+  if (res != FR_OK) {
+    DPRINTF("Error reading catalog index (res=%d)\n", res);
+    catalog_close_reader();
+    return -1;
+  }
+  return (int)br;
+}
@@ -11,6 +11,20 @@
 static uint32_t display_address = 0;
 static uint32_t display_command_address = 0;
 static uint32_t displays_highres_transtable_address = 0;
+static uint32_t displays_highres_expanded_address = 0;
+
+// Rows changed since the last refresh. The generation is never reset, so the
+// computer cannot take a new screen for one it has already copied.
+static uint32_t display_dirty_rows = 0;
+static uint16_t display_frame_gen = 0;
+
+// Row of the framebuffer shown at the top of the screen
+static uint8_t display_top_row = 0;
+
+#if DISPLAY_DELTA_UPDATES == 1
+// The screen of the computer after the last frame, in screen order
+static uint8_t display_shadow[DISPLAY_BUFFER_SIZE];
+#endif
 
 // Static assert to ensure buffer size fits within uint32_t
 _Static_assert(DISPLAY_BUFFER_SIZE <= UINT32_MAX,
@@ -96,6 +110,16 @@ void set_displays_highres_transtable_address(uint32_t address) {
   displays_highres_transtable_address = address;
 }
 
+// Getter function for the expanded highres framebuffer address
+uint32_t get_displays_highres_expanded_address() {
+  return displays_highres_expanded_address;
+}
+
+// Setter function for the expanded highres framebuffer address
+void set_displays_highres_expanded_address(uint32_t address) {
+  displays_highres_expanded_address = address;
+}
+
 unsigned char u8x8_d_custom(u8x8_t *u8x8, unsigned char msg,
                             unsigned char arg_int, void *arg_ptr) {
   if (msg == U8X8_MSG_DISPLAY_SETUP_MEMORY) {
@@ -106,10 +130,30 @@ unsigned char u8x8_d_custom(u8x8_t *u8x8, unsigned char msg,
 }
 #endif
 
+// Set the pixels from x0 to x1 - 1 of a line, leftmost pixel in bit 7
+static void display_fill_span(uint8_t *line, int x0, int x1) {
+  while (x0 < x1 && (x0 & 7)) {
+    line[x0 >> 3] |= 0x80 >> (x0 & 7);
+    x0++;
+  }
+  while (x1 - x0 >= 8) {
+    line[x0 >> 3] = 0xFF;
+    x0 += 8;
+  }
+  while (x0 < x1) {
+    line[x0 >> 3] |= 0x80 >> (x0 & 7);
+    x0++;
+  }
+}
+
 /**
  * @brief Displays a QR code onto a bitmap buffer with support for border and
  * scaling.
  *
+ * The QR code is centered in the area, with a border of blank modules. Each
+ * row of modules is expanded once into a line of pixels, which is then copied
+ * a byte at a time into the scale lines of the row.
+ *
  * @param qrcode          The QR code data generated by qrcodegen.
  * @param display_address Pointer to the display buffer (bitmap array).
  * @param display_size_x  Width of the display in pixels.
@@ -129,64 +173,95 @@ void display_draw_qr(const uint8_t qrcode[], uint16_t display_size_x,
   // Get the native size of the QR code
   int size = qrcodegen_getSize(qrcode);
 
-  // Clear or initialize the display buffer if needed (optional)
-  // Example: memset(display_address, 0, (display_size_x / 8) * display_size_y);
-
   // Calculate total size in pixels (QR code modules + border) * scale
   int total_size_in_pixels = (size + 2 * border) * scale;
 
-  // Loop through each pixel in the scaled QR code + border
-  // Note: y and x indices are in 'pixel' units, not 'modules'.
-  for (int y = 0; y < total_size_in_pixels; y++) {
-    for (int x = 0; x < total_size_in_pixels; x++) {
-      // Center the QR code by offsetting the position
-      // We subtract half of the total scaled size from the center of the
-      // display
-      int abs_x = pos_x + x + (display_size_x - total_size_in_pixels) / 2;
-      int abs_y = pos_y + y + (display_size_y - total_size_in_pixels) / 2;
-
-      // Ensure we are within display bounds
-      if (abs_x >= 0 && abs_x < (display_size_x + pos_x) && abs_y >= 0 &&
-          abs_y < (display_size_y + pos_y)) {
-        // Determine the tile (byte) and bit within the display buffer
-        int tile_x = abs_x / 8;
-        int bit = 7 - (abs_x % 8);
-        int address = (abs_y * (DISPLAY_WIDTH / 8)) + tile_x;
-
-        // Translate scaled/bordered pixel coordinates back to original QR
-        // modules: (x / scale) - border and (y / scale) - border will give us
-        // which original QR module this pixel belongs to.
-        int module_x = (x / scale) - border;
-        int module_y = (y / scale) - border;
-
-        // Check if we're within the QR code module area
-        bool is_within_qr = (module_x >= 0 && module_x < size) &&
-                            (module_y >= 0 && module_y < size);
-
-        // If within the original QR code area, get the module state
-        bool module_on = false;
-        if (is_within_qr) {
-          module_on = qrcodegen_getModule(qrcode, module_x, module_y);
-        }
+  // Top left corner of the QR code, centered in the area
+  int left = pos_x + (display_size_x - total_size_in_pixels) / 2;
+  int top = pos_y + (display_size_y - total_size_in_pixels) / 2;
+
+  // Clip to the area and the display
+  int clip_x0 = (left < 0) ? 0 : left;
+  int clip_x1 = left + total_size_in_pixels;
+  if (clip_x1 > display_size_x + pos_x) clip_x1 = display_size_x + pos_x;
+  if (clip_x1 > DISPLAY_WIDTH) clip_x1 = DISPLAY_WIDTH;
+  int clip_y0 = (top < 0) ? 0 : top;
+  int clip_y1 = top + total_size_in_pixels;
+  if (clip_y1 > display_size_y + pos_y) clip_y1 = display_size_y + pos_y;
+  if (clip_y1 > DISPLAY_HEIGHT) clip_y1 = DISPLAY_HEIGHT;
+  if (clip_x0 >= clip_x1 || clip_y0 >= clip_y1) {
+    return;
+  }
 
-        // Set or clear the bit accordingly
-        if (module_on) {
-          display_address[address] |= (1 << bit);
-        } else {
-          display_address[address] &= ~(1 << bit);
+  // Pixels of a line covered by the QR code
+  uint8_t area[DISPLAY_WIDTH / 8] = {0};
+  display_fill_span(area, clip_x0, clip_x1);
+  int first_byte = clip_x0 >> 3;
+  int last_byte = (clip_x1 - 1) >> 3;
+
+  uint8_t pattern[DISPLAY_WIDTH / 8];
+  for (int module_y = -border; module_y < size + border; module_y++) {
+    int y0 = top + (module_y + border) * scale;
+    if (y0 + scale <= clip_y0 || y0 >= clip_y1) {
+      continue;
+    }
+
+    // Expand the runs of dark modules of the row
+    memset(pattern, 0, sizeof(pattern));
+    if (module_y >= 0 && module_y < size) {
+      int module_x = 0;
+      while (module_x < size) {
+        if (!qrcodegen_getModule(qrcode, module_x, module_y)) {
+          module_x++;
+          continue;
+        }
+        int run_end = module_x + 1;
+        while (run_end < size &&
+               qrcodegen_getModule(qrcode, run_end, module_y)) {
+          run_end++;
         }
+        int x0 = left + (module_x + border) * scale;
+        int x1 = left + (run_end + border) * scale;
+        if (x0 < clip_x0) x0 = clip_x0;
+        if (x1 > clip_x1) x1 = clip_x1;
+        if (x0 < x1) {
+          display_fill_span(pattern, x0, x1);
+        }
+        module_x = run_end;
+      }
+    }
+
+    // Copy the line into every pixel line of the row
+    for (int y = y0; y < y0 + scale; y++) {
+      if (y < clip_y0 || y >= clip_y1) {
+        continue;
+      }
+      uint8_t *line = display_address + y * (DISPLAY_WIDTH / 8);
+      for (int b = first_byte; b <= last_byte; b++) {
+        line[b] = (uint8_t)((line[b] & ~area[b]) | pattern[b]);
       }
     }
   }
 }
 
-void display_create_qr(uint8_t qrcode[], const char *text) {
+void display_create_qr(display_qr_t *qr, const char *text) {
+  // Same text, same QR code. Finding the best mask is the slow part
+  if (qr->text[0] != '\0' &&
+      strncmp(qr->text, text, sizeof(qr->text)) == 0) {
+    return;
+  }
   enum qrcodegen_Ecc errCorLvl = qrcodegen_Ecc_LOW;  // Error correction level
   // Make and print the QR Code symbol
   uint8_t tempBuffer[DISPLAY_QR_BUFFER_LEN_MAX];
-  bool ok = qrcodegen_encodeText(text, tempBuffer, qrcode, errCorLvl,
+  bool ok = qrcodegen_encodeText(text, tempBuffer, qr->code, errCorLvl,
                                  qrcodegen_VERSION_MIN, qrcodegen_VERSION_MAX,
                                  qrcodegen_Mask_AUTO, true);
+  // Keep the text only if it was encoded, and fully
+  if (ok && strlen(text) < sizeof(qr->text)) {
+    snprintf(qr->text, sizeof(qr->text), "%s", text);
+  } else {
+    qr->text[0] = '\0';
+  }
 }
 
 // Initialize u8g2 with the custom buffer
@@ -209,6 +284,8 @@ void display_setup_u8g2() {
                               DISPLAY_COMMAND_ADDRESS_OFFSET);
   set_displays_highres_transtable_address((unsigned int)&__rom_in_ram_start__ +
                                           DISPLAY_HIGHRES_TRANSTABLE_OFFSET);
+  set_displays_highres_expanded_address((unsigned int)&__rom_in_ram_start__ +
+                                        DISPLAY_HIGHRES_EXPANDED_ROM_OFFSET);
   DPRINTF("Display buffer address: 0x%08x\n", (unsigned int)u8g2_buffer);
   DPRINTF("Display command address: 0x%08x\n", get_display_command_address());
   DPRINTF("Highres translation table address: 0x%08x\n",
@@ -218,11 +295,21 @@ void display_setup_u8g2() {
   // We need to generate the mask table for the Atari ST display (faster highres
   // mode)
   display_generate_mask_table(get_displays_highres_transtable_address());
+  WRITE_WORD(get_display_address(), DISPLAY_EXPANDED_FLAG_OFFSET,
+             DISPLAY_HIGHRES_EXPANDED);
+  // Until the first frame, copy the dirty rows
+  WRITE_WORD(get_display_address(), DISPLAY_DELTA_FB_OFFSET,
+             DISPLAY_DELTA_NONE);
+  WRITE_WORD(get_display_address(),
+             DISPLAY_DELTA_FB_OFFSET + DISPLAY_DELTA_AREA_SIZE,
+             DISPLAY_DELTA_NONE);
 
   // We clear the command address just in case
   SEND_COMMAND_TO_DISPLAY(DISPLAY_COMMAND_NOP);
 #endif
 
+  display_reset_scroll();
+
   u8g2_SetupDisplay(&u8g2, u8x8_d_custom, (u8x8_msg_cb)u8x8_cad_dummy,
                     (u8x8_msg_cb)u8x8_dummy_byte, (u8x8_msg_cb)u8x8_dummy_gpio);
 
@@ -236,22 +323,229 @@ void display_setup_u8g2() {
   u8g2_InitDisplay(&u8g2);  // Initialize display (will use dummy callbacks)
 }
 
-void display_refresh() {
+void display_mark_dirty_rows(uint8_t first_row, uint8_t num_rows) {
+  if (first_row >= DISPLAY_CHAR_ROWS) {
+    return;
+  }
+  if (num_rows > DISPLAY_CHAR_ROWS - first_row) {
+    num_rows = DISPLAY_CHAR_ROWS - first_row;
+  }
+  display_dirty_rows |= (uint32_t)((1ul << num_rows) - 1) << first_row;
+}
+
+// The bits of each byte doubled: the translation table of the computer and the
+// copy used to fill the expanded framebuffer
+static uint16_t display_double_table[256];
+
+#if DISPLAY_HIGHRES_EXPANDED == 1
+// Double the pixels of a row of the framebuffer into the same row of the
+// expanded one, two bytes at a time with a single 32 bit write
+static void display_expand_row(uint8_t buffer_row) {
+  const uint8_t *src = u8g2_buffer + buffer_row * DISPLAY_ROW_BYTES;
+  uint32_t *dst = (uint32_t *)(displays_highres_expanded_address +
+                               buffer_row * DISPLAY_EXPANDED_ROW_BYTES);
+  for (int i = 0; i < DISPLAY_ROW_BYTES; i += 2) {
+    *dst++ = display_double_table[src[i]] |
+             ((uint32_t)display_double_table[src[i + 1]] << 16);
+  }
+}
+#endif
+
+#if DISPLAY_DELTA_UPDATES == 1
+// Write the spans of words of the dirty rows that differ from the shadow copy,
+// and update it. Returns the number of spans, or DISPLAY_DELTA_NONE if they do
+// not fit: the computer copies the dirty rows then. Adds to words the words
+// in the spans.
+static uint16_t display_publish_deltas(uint16_t frame_gen, uint32_t *words) {
+  uint32_t deltas = get_display_address() + DISPLAY_DELTA_FB_OFFSET +
+                    (frame_gen & 1) * DISPLAY_DELTA_AREA_SIZE;
+  uint16_t spans = 0;
+  bool overflow = false;
+  for (uint8_t row = 0; row < DISPLAY_CHAR_ROWS; row++) {
+    if (!(display_dirty_rows & (1ul << row))) {
+      continue;
+    }
+    const uint8_t *src =
+        u8g2_buffer + display_get_buffer_row(row) * DISPLAY_ROW_BYTES;
+    uint8_t *shadow = display_shadow + row * DISPLAY_ROW_BYTES;
+    for (int line = 0; line < 8; line++) {
+      int first = -1;
+      for (int word = 0; word <= DISPLAY_LINE_WORDS; word++) {
+        bool changed = false;
+        if (word < DISPLAY_LINE_WORDS) {
+          int i = word * 2;
+          changed = (src[i] != shadow[i]) || (src[i + 1] != shadow[i + 1]);
+          shadow[i] = src[i];
+          shadow[i + 1] = src[i + 1];
+        }
+        if (changed && first < 0) {
+          first = word;
+        } else if (!changed && first >= 0) {
+          if (spans < DISPLAY_DELTA_MAX_SPANS) {
+            uint16_t offset =
+                (uint16_t)(((row * 8) + line) * DISPLAY_LINE_WORDS + first);
+            WRITE_WORD(deltas, 2 + spans * 4, offset);
+            WRITE_WORD(deltas, 4 + spans * 4, (uint16_t)(word - first - 1));
+            *words += word - first;
+            spans++;
+          } else {
+            overflow = true;
+          }
+          first = -1;
+        }
+      }
+      src += DISPLAY_WIDTH / 8;
+      shadow += DISPLAY_WIDTH / 8;
+    }
+  }
+  if (overflow) {
+    spans = DISPLAY_DELTA_NONE;
+  }
+  WRITE_WORD(deltas, 0, spans);
+  return spans;
+}
+#endif
+
+// Publish the rows changed since the last refresh. The bitmap and the top row
+// go first, to the slot of the new generation: the computer reads the
+// generation before and after the slot.
+void display_refresh_dirty() {
+  if (display_dirty_rows == 0) {
+    return;
+  }
 #if DISPLAY_BYPASS_FRAMEBUFFER == 0
   uint32_t *display_buffer = (void *)get_display_address();
   COPY_AND_SWAP_16BIT_DMA(display_buffer, (uint16_t *)u8g2_buffer,
                           DISPLAY_BUFFER_SIZE);
 #endif
+#if defined(DISPLAY_ATARIST) && DISPLAY_HIGHRES_EXPANDED == 1
+  for (uint8_t row = 0; row < DISPLAY_CHAR_ROWS; row++) {
+    if (display_dirty_rows & (1ul << row)) {
+      display_expand_row(display_get_buffer_row(row));
+    }
+  }
+#endif
+  // What the computer copies if it does not miss the frame
+  uint32_t copy_bytes =
+      __builtin_popcount(display_dirty_rows) * DISPLAY_ROW_BYTES;
+#if DISPLAY_DELTA_UPDATES == 1
+  uint32_t delta_words = 0;
+  uint16_t spans = display_publish_deltas(display_frame_gen + 1, &delta_words);
+  if (spans != DISPLAY_DELTA_NONE) {
+    copy_bytes = delta_words * 2;
+  }
+#endif
+  metrics_inc(METRICS_DISPLAY_FRAMES);
+  metrics_add(METRICS_DISPLAY_COPY_BYTES, copy_bytes);
+  display_frame_gen++;
+  uint32_t slot = (display_frame_gen & 1) * DISPLAY_FRAME_SLOT_SIZE;
+  WRITE_AND_SWAP_LONGWORD(get_display_address(),
+                          DISPLAY_DIRTY_ROWS_OFFSET + slot, display_dirty_rows);
+  WRITE_WORD(get_display_address(), DISPLAY_TOP_ROW_OFFSET + slot,
+             display_top_row);
+  WRITE_WORD(get_display_address(), DISPLAY_FRAME_GEN_OFFSET,
+             display_frame_gen);
+  display_dirty_rows = 0;
+}
+
+// Full screen refresh, for the screens drawn with u8g2 directly
+void display_refresh() {
+  display_dirty_rows = DISPLAY_ALL_ROWS;
+  display_refresh_dirty();
+}
+
+static const display_font_glyph_t *display_font_glyph(
+    const display_font_t *font, char c) {
+  uint8_t encoding = (uint8_t)c;
+  if (encoding < font->first || encoding > font->last) {
+    return NULL;
+  }
+  const display_font_glyph_t *glyph = &font->glyphs[encoding - font->first];
+  return glyph->present ? glyph : NULL;
+}
+
+// Blit the bounding box of a glyph, a byte or two per line, clipped to the
+// display. top is the line of the display of the first line of the cell.
+static void display_blit_glyph(const display_font_glyph_t *glyph, int x,
+                               int top) {
+  if (glyph->height == 0 || x >= DISPLAY_WIDTH) {
+    return;
+  }
+  int col = x >> 3;
+  int shift = x & 7;
+  bool second = (shift != 0) && (col + 1 < DISPLAY_WIDTH / 8);
+  uint8_t mask_left = glyph->mask >> shift;
+  uint8_t mask_right = (uint8_t)(glyph->mask << (8 - shift));
+  for (int line = glyph->top; line < glyph->top + glyph->height; line++) {
+    int y = top + line;
+    if (y < 0 || y >= DISPLAY_HEIGHT) {
+      continue;
+    }
+    uint8_t *dst = u8g2_buffer + y * (DISPLAY_WIDTH / 8) + col;
+    uint8_t bits = glyph->lines[line];
+    dst[0] = (uint8_t)((dst[0] & ~mask_left) | (bits >> shift));
+    if (second) {
+      dst[1] = (uint8_t)((dst[1] & ~mask_right) | (bits << (8 - shift)));
+    }
+  }
+}
+
+// Draw a string with a pre-decoded font where u8g2_DrawStr() would, y being
+// the baseline, and with its solid font mode. As in u8g2, a new line ends the
+// string. Returns the advance of the string.
+uint16_t display_draw_text(const display_font_t *font, uint16_t x, uint16_t y,
+                           const char *str) {
+  uint16_t start = x;
+  int top = (int)y - font->ascent;
+  for (; *str != '\0' && *str != '\n'; str++) {
+    const display_font_glyph_t *glyph = display_font_glyph(font, *str);
+    if (glyph == NULL) {
+      continue;
+    }
+    display_blit_glyph(glyph, x, top);
+    x += glyph->advance;
+  }
+  return (uint16_t)(x - start);
+}
+
+// Width in pixels of a string, the same as u8g2_GetStrWidth(): the advance of
+// every glyph but the last, which counts up to its last column. A char with
+// no glyph at the end adds nothing and leaves the previous glyph as the last.
+uint16_t display_text_width(const display_font_t *font, const char *str) {
+  const display_font_glyph_t *first = NULL;
+  const display_font_glyph_t *last = NULL;
+  int8_t last_advance = 0;
+  uint16_t width = 0;
+  for (; *str != '\0' && *str != '\n'; str++) {
+    const display_font_glyph_t *glyph = display_font_glyph(font, *str);
+    last_advance = 0;
+    if (glyph == NULL) {
+      continue;
+    }
+    if (first == NULL) {
+      first = glyph;
+    }
+    last = glyph;
+    last_advance = glyph->advance;
+    width += glyph->advance;
+  }
+  if (last != NULL && last->width != 0) {
+    width = width - last_advance + last->width + last->x_offset;
+    if (first->x_offset > 0) {
+      width += first->x_offset;
+    }
+  }
+  return width;
 }
 
 void display_draw_product_info() {
   // Product info
   char product_str[80] = {0};
-  u8g2_SetFont(&u8g2, u8g2_font_squeezed_b7_tr);
   snprintf(product_str, sizeof(product_str), "%s %s - %s", DISPLAY_PRODUCT_MSG,
            RELEASE_VERSION, DISPLAY_COPYRIGHT_MESSAGE);
-  u8g2_DrawStr(&u8g2, LEFT_PADDING_FOR_CENTER(product_str, 68) * 6,
-               DISPLAY_HEIGHT - 1, product_str);
+  display_draw_text(&display_font_squeezed,
+                    LEFT_PADDING_FOR_CENTER(product_str, 68) * 6,
+                    DISPLAY_HEIGHT - 1, product_str);
 }
 
 void display_generate_mask_table(uint32_t memory_address) {
@@ -267,19 +561,38 @@ void display_generate_mask_table(uint32_t memory_address) {
 
     // Store the 16 bit result mask in the memory address
 #if DISPLAY_HIGHRES_INVERT == 1
-    WRITE_WORD(memory_address, i * 2, ~mask);
-#else
-    WRITE_WORD(memory_address, i * 2, mask);
+    mask = ~mask;
 #endif
+    display_double_table[i] = (uint16_t)mask;
+    WRITE_WORD(memory_address, i * 2, mask);
+  }
+}
+
+// Scroll up the screen by rows of chars. The framebuffer is a ring of rows:
+// the top row is blanked and becomes the bottom one, nothing else moves.
+void display_scrollup(uint8_t rows) {
+  if (rows > DISPLAY_CHAR_ROWS) {
+    rows = DISPLAY_CHAR_ROWS;
+  }
+  for (uint8_t i = 0; i < rows; i++) {
+    memset(u8g2_buffer + display_top_row * DISPLAY_ROW_BYTES, 0,
+           DISPLAY_ROW_BYTES);
+    display_top_row = (display_top_row + 1) % DISPLAY_CHAR_ROWS;
+  }
+  // Every row moves on the screen of the computer
+  display_mark_dirty_rows(0, DISPLAY_CHAR_ROWS);
+}
+
+// Back to a framebuffer in screen order, for the screens drawn with u8g2. The
+// content of the framebuffer is not moved: clear it after.
+void display_reset_scroll() {
+  if (display_top_row != 0) {
+    display_top_row = 0;
+    display_mark_dirty_rows(0, DISPLAY_CHAR_ROWS);
   }
 }
 
-// Scroll up the display buffer by blanking out the bottom part
-// blank_bytes is the number of bytes to blank out at the bottom of the screen
-// They should be the same as the number of bytes in a row of chars
-void display_scrollup(uint16_t blank_bytes) {
-  // blank bytes is the number of bytes to blank out at the bottom of the screen
-  memmove(u8g2_buffer, u8g2_buffer + blank_bytes,
-          DISPLAY_BUFFER_SIZE - blank_bytes);
-  memset(u8g2_buffer + DISPLAY_BUFFER_SIZE - blank_bytes, 0, blank_bytes);
+// Row of the framebuffer that holds a row of the screen
+uint8_t display_get_buffer_row(uint8_t row) {
+  return (uint8_t)((row + display_top_row) % DISPLAY_CHAR_ROWS);
 }
@@ -14,6 +14,8 @@ _Static_assert(DISPLAY_BUFFER_SIZE <= UINT32_MAX,
 
 static char url_ip[128] = {0};
 static char url_host[128] = {0};
+static display_qr_t qr_wifi = {0};
+static display_qr_t qr_url = {0};
 
 // Draw graphics into the buffer
 void draw_connection_step1_scr(const uint8_t qrcode_wifi[], const char *ssid,
@@ -33,32 +35,33 @@ void draw_connection_step1_scr(const uint8_t qrcode_wifi[], const char *ssid,
   snprintf(pass_str, sizeof(pass_str), "Pass: %s", password);
 
   // Use Amstrad CPC font!
-  u8g2_SetFont(display_get_u8g2_ref(), u8g2_font_amstrad_cpc_extended_8f);
-  u8g2_DrawStr(display_get_u8g2_ref(),
-               LEFT_PADDING_FOR_CENTER(ssid_str, DISPLAY_TILES_WIDTH / 2) * 8,
-               32, ssid_str);
+  display_draw_text(
+      &display_font_amstrad,
+      LEFT_PADDING_FOR_CENTER(ssid_str, DISPLAY_TILES_WIDTH / 2) * 8, 32,
+      ssid_str);
   if (strcmp(auth, "OPEN") != 0) {
-    u8g2_DrawStr(display_get_u8g2_ref(),
-                 LEFT_PADDING_FOR_CENTER(pass_str, DISPLAY_TILES_WIDTH / 2) * 8,
-                 40, pass_str);
+    display_draw_text(
+        &display_font_amstrad,
+        LEFT_PADDING_FOR_CENTER(pass_str, DISPLAY_TILES_WIDTH / 2) * 8, 40,
+        pass_str);
   }
 
   // Wifi status
   display_fabric_wifi_change_status(wifi_status);
 
   // Steps info
-  u8g2_SetFont(display_get_u8g2_ref(), u8g2_font_squeezed_b7_tr);
-  u8g2_DrawStr(display_get_u8g2_ref(),
-               LEFT_PADDING_FOR_CENTER(DISPLAY_CONNECTION_STEP1_MSG, 34) * 5, 8,
-               DISPLAY_CONNECTION_STEP1_MSG);
+  display_draw_text(&display_font_squeezed,
+                    LEFT_PADDING_FOR_CENTER(DISPLAY_CONNECTION_STEP1_MSG, 34) *
+                        5,
+                    8, DISPLAY_CONNECTION_STEP1_MSG);
 
   // Product info
   display_draw_product_info();
 
   // ByPass message
-  u8g2_DrawStr(display_get_u8g2_ref(),
-               LEFT_PADDING_FOR_CENTER(DISPLAY_BYPASS_MESSAGE, 68) * 5,
-               DISPLAY_HEIGHT - 8, DISPLAY_BYPASS_MESSAGE);
+  display_draw_text(&display_font_squeezed,
+                    LEFT_PADDING_FOR_CENTER(DISPLAY_BYPASS_MESSAGE, 68) * 5,
+                    DISPLAY_HEIGHT - 8, DISPLAY_BYPASS_MESSAGE);
 
   // Frames
   u8g2_DrawFrame(display_get_u8g2_ref(), 0, 16, 156, 168);
@@ -71,18 +74,18 @@ void draw_connection_step2_scr(const uint8_t qrcode_url[], const char *url1,
                   DISPLAY_QR_BORDER, DISPLAY_QR_SCALE);
 
   // URL 1
-  u8g2_DrawStr(display_get_u8g2_ref(),
-               160 + LEFT_PADDING_FOR_CENTER(url1, DISPLAY_TILES_WIDTH / 2) * 8,
-               32, url1);
+  display_draw_text(
+      &display_font_amstrad,
+      160 + LEFT_PADDING_FOR_CENTER(url1, DISPLAY_TILES_WIDTH / 2) * 8, 32,
+      url1);
 
-  u8g2_SetFont(display_get_u8g2_ref(), u8g2_font_squeezed_b7_tr);
   // URL 2
-  // u8g2_DrawStr(display_get_u8g2_ref(),
-  //              160 + LEFT_PADDING_FOR_CENTER(url2, 34) * 5, 40, url2);
+  // display_draw_text(&display_font_squeezed,
+  //                   160 + LEFT_PADDING_FOR_CENTER(url2, 34) * 5, 40, url2);
 
   // Steps info
-  u8g2_DrawStr(
-      display_get_u8g2_ref(),
+  display_draw_text(
+      &display_font_squeezed,
       160 + LEFT_PADDING_FOR_CENTER(DISPLAY_CONNECTION_STEP2_MSG, 34) * 5, 8,
       DISPLAY_CONNECTION_STEP2_MSG);
 
@@ -95,17 +98,16 @@ void draw_reset_scr() {
   u8g2_ClearBuffer(display_get_u8g2_ref());
 
   // Use Amstrad CPC font!
-  u8g2_SetFont(display_get_u8g2_ref(), u8g2_font_amstrad_cpc_extended_8f);
-  u8g2_DrawStr(
-      display_get_u8g2_ref(),
+  display_draw_text(
+      &display_font_amstrad,
       LEFT_PADDING_FOR_CENTER(DISPLAY_RESET_WAIT_MESSAGE, DISPLAY_TILES_WIDTH) *
           8,
       100, DISPLAY_RESET_WAIT_MESSAGE);
-  u8g2_DrawStr(display_get_u8g2_ref(),
-               LEFT_PADDING_FOR_CENTER(DISPLAY_RESET_FORCE_MESSAGE,
-                                       DISPLAY_TILES_WIDTH) *
-                   8,
-               108, DISPLAY_RESET_FORCE_MESSAGE);
+  display_draw_text(&display_font_amstrad,
+                    LEFT_PADDING_FOR_CENTER(DISPLAY_RESET_FORCE_MESSAGE,
+                                            DISPLAY_TILES_WIDTH) *
+                        8,
+                    108, DISPLAY_RESET_FORCE_MESSAGE);
 
   // Product info
   display_draw_product_info();
@@ -113,8 +115,6 @@ void draw_reset_scr() {
 
 // Change the wifi status in the buffer
 void display_fabric_wifi_change_status(uint8_t wifi_status) {
-  // Use 8x8 font
-  u8g2_SetFont(display_get_u8g2_ref(), u8g2_font_amstrad_cpc_extended_8f);
   // Wifi status
   char wifi_status_str[20] = {0};
   switch (wifi_status) {
@@ -128,15 +128,14 @@ void display_fabric_wifi_change_status(uint8_t wifi_status) {
       snprintf(wifi_status_str, sizeof(wifi_status_str), "   Connected!   ");
       break;
   }
-  u8g2_DrawStr(display_get_u8g2_ref(),
-               LEFT_PADDING_FOR_CENTER(wifi_status_str, 20) * 8,
-               DISPLAY_HEIGHT - 24, wifi_status_str);
+  // 8x8 font
+  display_draw_text(&display_font_amstrad,
+                    LEFT_PADDING_FOR_CENTER(wifi_status_str, 20) * 8,
+                    DISPLAY_HEIGHT - 24, wifi_status_str);
 }
 
 // Change the portal status in the buffer
 void display_fabric_portal_change_status(uint8_t portal_status) {
-  // Use 8x8 font
-  u8g2_SetFont(display_get_u8g2_ref(), u8g2_font_amstrad_cpc_extended_8f);
   // Wifi status
   char portal_status_str[20] = {0};
   switch (portal_status) {
@@ -153,9 +152,10 @@ void display_fabric_portal_change_status(uint8_t portal_status) {
                "   Connected!   ");
       break;
   }
-  u8g2_DrawStr(display_get_u8g2_ref(),
-               160 + LEFT_PADDING_FOR_CENTER(portal_status_str, 20) * 8,
-               DISPLAY_HEIGHT - 24, portal_status_str);
+  // 8x8 font
+  display_draw_text(&display_font_amstrad,
+                    160 + LEFT_PADDING_FOR_CENTER(portal_status_str, 20) * 8,
+                    DISPLAY_HEIGHT - 24, portal_status_str);
 }
 
 // The main function should be as follows:
@@ -173,17 +173,16 @@ void display_fabric_start(const char *ssid, const char *password,
   display_setup_u8g2();
 
   // Create the QR codes
-  uint8_t qrcode_wifi[DISPLAY_QR_BUFFER_LEN_MAX];
   char qr_text[256];
   snprintf(qr_text, sizeof(qr_text), "WIFI:T:%s;S:%s;P:%s;;", auth, ssid,
            password);  // WiFi information
   DPRINTF("QR WIFI text: %s\n", qr_text);
-  display_create_qr(qrcode_wifi, qr_text);
+  display_create_qr(&qr_wifi, qr_text);
 
   // Set the flag to NOT-RESET the computer
   SEND_COMMAND_TO_DISPLAY(DISPLAY_COMMAND_NOP);
 
-  draw_connection_step1_scr(qrcode_wifi, ssid, password, auth, 0);
+  draw_connection_step1_scr(qr_wifi.code, ssid, password, auth, 0);
   display_refresh();
 
   DPRINTF("Exiting fabric display\n");
@@ -191,13 +190,12 @@ void display_fabric_start(const char *ssid, const char *password,
 
 void display_fabric_portal_connection() {
   // Create the QR codes
-  uint8_t qrcode_url[DISPLAY_QR_BUFFER_LEN_MAX];
   char qr_text[256];
   snprintf(qr_text, sizeof(qr_text), url_ip);  // URL portal
   DPRINTF("QR URL text: %s\n", qr_text);
-  display_create_qr(qrcode_url, qr_text);
+  display_create_qr(&qr_url, qr_text);
 
-  draw_connection_step2_scr(qrcode_url, url_ip, url_host);
+  draw_connection_step2_scr(qr_url.code, url_ip, url_host);
   display_refresh();
 }
 
@@ -0,0 +1,369 @@
+// Generated by external/generate_fonts.py from u8g2/custom_fonts.c.
+// Do not edit.
+
+#include "display_fonts.h"
+
+// u8g2_font_squeezed_b7_tr, encodings 32 to 126
+static const display_font_glyph_t display_font_squeezed_glyphs[] = {
+    {1, 3, 0, 0, 0x00, 0, 0, {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}},  // 32: space
+    {1, 3, 0, 2, 0xc0, 0, 7, {0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0x00, 0xc0, 0x00}},  // 33: !
+    {1, 6, 0, 5, 0xf8, 0, 2, {0xd8, 0xd8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}},  // 34: "
+    {1, 8, 0, 7, 0xfe, 1, 5, {0x00, 0x6c, 0xfe, 0x6c, 0xfe, 0x6c, 0x00, 0x00}},  // 35: #
+    {1, 7, 0, 6, 0xfc, 0, 7, {0x30, 0x7c, 0xf0, 0x78, 0x3c, 0xf8, 0x30, 0x00}},  // 36: $
+    {1, 7, 0, 6, 0xfc, 0, 7, {0xcc, 0xd8, 0x18, 0x30, 0x60, 0x6c, 0xcc, 0x00}},  // 37: %
+    {1, 7, 0, 6, 0xfc, 0, 7, {0x70, 0xd8, 0xd8, 0x70, 0xdc, 0xd8, 0x7c, 0x00}},  // 38: &
+    {1, 3, 0, 2, 0xc0, 0, 2, {0xc0, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}},  // 39: '
+    {1, 4, 0, 3, 0xe0, 0, 7, {0x60, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0x60, 0x00}},  // 40: (
+    {1, 4, 0, 3, 0xe0, 0, 7, {0xc0, 0x60, 0x60, 0x60, 0x60, 0x60, 0xc0, 0x00}},  // 41: )
+    {1, 6, 0, 5, 0xf8, 1, 5, {0x00, 0xd8, 0x70, 0xf8, 0x70, 0xd8, 0x00, 0x00}},  // 42: *
+    {1, 5, 0, 4, 0xf0, 2, 3, {0x00, 0x00, 0x60, 0xf0, 0x60, 0x00, 0x00, 0x00}},  // 43: +
+    {1, 3, 0, 2, 0xc0, 6, 2, {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xc0}},  // 44: ,
+    {1, 4, 0, 3, 0xe0, 3, 1, {0x00, 0x00, 0x00, 0xe0, 0x00, 0x00, 0x00, 0x00}},  // 45: -
+    {1, 3, 0, 2, 0xc0, 5, 2, {0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xc0, 0x00}},  // 46: .
+    {1, 5, 0, 4, 0xf0, 0, 7, {0x30, 0x30, 0x60, 0x60, 0x60, 0xc0, 0xc0, 0x00}},  // 47: /
+    {1, 5, 0, 5, 0xf8, 0, 7, {0x70, 0xd8, 0xd8, 0xd8, 0xd8, 0xd8, 0x70, 0x00}},  // 48: 0
+    {1, 4, 0, 3, 0xe0, 0, 7, {0x60, 0xe0, 0x60, 0x60, 0x60, 0x60, 0x60, 0x00}},  // 49: 1
+    {1, 5, 0, 4, 0xf0, 0, 7, {0xe0, 0x30, 0x30, 0x60, 0xc0, 0xc0, 0xf0, 0x00}},  // 50: 2
+    {1, 5, 0, 4, 0xf0, 0, 7, {0xe0, 0x30, 0x30, 0xe0, 0x30, 0x30, 0xe0, 0x00}},  // 51: 3
+    {1, 6, 0, 5, 0xf8, 0, 7, {0xd8, 0xd8, 0xd8, 0xf8, 0x18, 0x18, 0x18, 0x00}},  // 52: 4
+    {1, 5, 0, 4, 0xf0, 0, 7, {0xf0, 0xc0, 0xe0, 0x30, 0x30, 0x30, 0xe0, 0x00}},  // 53: 5
+    {1, 6, 0, 5, 0xf8, 0, 7, {0x70, 0xc0, 0xc0, 0xf0, 0xd8, 0xd8, 0x70, 0x00}},  // 54: 6
+    {1, 5, 0, 4, 0xf0, 0, 7, {0xf0, 0x30, 0x30, 0x60, 0x60, 0x60, 0x60, 0x00}},  // 55: 7
+    {1, 6, 0, 5, 0xf8, 0, 7, {0x70, 0xd8, 0xd8, 0x70, 0xd8, 0xd8, 0x70, 0x00}},  // 56: 8
+    {1, 6, 0, 5, 0xf8, 0, 7, {0x70, 0xd8, 0xd8, 0x78, 0x18, 0xd8, 0x70, 0x00}},  // 57: 9
+    {1, 3, 0, 2, 0xc0, 2, 4, {0x00, 0x00, 0xc0, 0x00, 0x00, 0xc0, 0x00, 0x00}},  // 58: :
+    {1, 3, 0, 2, 0xc0, 3, 5, {0x00, 0x00, 0x00, 0xc0, 0x00, 0x00, 0xc0, 0xc0}},  // 59: ;
+    {1, 5, 0, 4, 0xf0, 1, 5, {0x00, 0x30, 0x60, 0xc0, 0x60, 0x30, 0x00, 0x00}},  // 60: <
+    {1, 4, 0, 3, 0xe0, 2, 3, {0x00, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0x00, 0x00}},  // 61: =
+    {1, 5, 0, 4, 0xf0, 1, 5, {0x00, 0xc0, 0x60, 0x30, 0x60, 0xc0, 0x00, 0x00}},  // 62: >
+    {1, 5, 0, 4, 0xf0, 0, 7, {0xe0, 0x30, 0x30, 0x60, 0x60, 0x00, 0x60, 0x00}},  // 63: ?
+    {1, 7, 0, 6, 0xfc, 0, 7, {0x78, 0xcc, 0xdc, 0xdc, 0xdc, 0xc0, 0x78, 0x00}},  // 64: @
+    {1, 6, 0, 5, 0xf8, 0, 7, {0x70, 0xd8, 0xd8, 0xf8, 0xd8, 0xd8, 0xd8, 0x00}},  // 65: A
+    {1, 6, 0, 5, 0xf8, 0, 7, {0xf0, 0xd8, 0xd8, 0xf0, 0xd8, 0xd8, 0xf0, 0x00}},  // 66: B
+    {1, 5, 0, 4, 0xf0, 0, 7, {0x70, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0x70, 0x00}},  // 67: C
+    {1, 6, 0, 5, 0xf8, 0, 7, {0xf0, 0xd8, 0xd8, 0xd8, 0xd8, 0xd8, 0xf0, 0x00}},  // 68: D
+    {1, 4, 0, 3, 0xe0, 0, 7, {0xe0, 0xc0, 0xc0, 0xe0, 0xc0, 0xc0, 0xe0, 0x00}},  // 69: E
+    {1, 4, 0, 3, 0xe0, 0, 7, {0xe0, 0xc0, 0xc0, 0xe0, 0xc0, 0xc0, 0xc0, 0x00}},  // 70: F
+    {1, 6, 0, 5, 0xf8, 0, 7, {0x70, 0xc0, 0xc0, 0xf8, 0xd8, 0xd8, 0x70, 0x00}},  // 71: G
+    {1, 6, 0, 5, 0xf8, 0, 7, {0xd8, 0xd8, 0xd8, 0xf8, 0xd8, 0xd8, 0xd8, 0x00}},  // 72: H
+    {1, 3, 0, 2, 0xc0, 0, 7, {0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0x00}},  // 73: I
+    {1, 4, 0, 3, 0xe0, 0, 7, {0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0xe0, 0x00}},  // 74: J
+    {1, 6, 0, 5, 0xf8, 0, 7, {0xd8, 0xd8, 0xf0, 0xe0, 0xf0, 0xd8, 0xd8, 0x00}},  // 75: K
+    {1, 4, 0, 3, 0xe0, 0, 7, {0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xe0, 0x00}},  // 76: L
+    {1, 8, 0, 7, 0xfe, 0, 7, {0xc6, 0xee, 0xfe, 0xd6, 0xc6, 0xc6, 0xc6, 0x00}},  // 77: M
+    {1, 7, 0, 6, 0xfc, 0, 7, {0xcc, 0xec, 0xfc, 0xdc, 0xcc, 0xcc, 0xcc, 0x00}},  // 78: N
+    {1, 6, 0, 5, 0xf8, 0, 7, {0x70, 0xd8, 0xd8, 0xd8, 0xd8, 0xd8, 0x70, 0x00}},  // 79: O
+    {1, 6, 0, 5, 0xf8, 0, 7, {0xf0, 0xd8, 0xd8, 0xf0, 0xc0, 0xc0, 0xc0, 0x00}},  // 80: P
+    {1, 7, 0, 6, 0xfc, 0, 7, {0x70, 0xd8, 0xd8, 0xd8, 0xd8, 0x58, 0x7c, 0x00}},  // 81: Q
+    {1, 6, 0, 5, 0xf8, 0, 7, {0xf0, 0xd8, 0xd8, 0xf0, 0xd8, 0xd8, 0xd8, 0x00}},  // 82: R
+    {1, 4, 0, 3, 0xe0, 0, 7, {0x60, 0xc0, 0xc0, 0x60, 0x60, 0x60, 0xc0, 0x00}},  // 83: S
+    {1, 5, 0, 4, 0xf0, 0, 7, {0xf0, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x00}},  // 84: T
+    {1, 6, 0, 5, 0xf8, 0, 7, {0xd8, 0xd8, 0xd8, 0xd8, 0xd8, 0xd8, 0xf8, 0x00}},  // 85: U
+    {1, 7, 0, 6, 0xfc, 0, 7, {0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0x78, 0x30, 0x00}},  // 86: V
+    {1, 9, 0, 8, 0xff, 0, 7, {0xc3, 0xc3, 0xc3, 0xc3, 0xdb, 0xff, 0x66, 0x00}},  // 87: W
+    {1, 6, 0, 5, 0xf8, 0, 7, {0xd8, 0xd8, 0x70, 0x70, 0xd8, 0xd8, 0xd8, 0x00}},  // 88: X
+    {1, 7, 0, 6, 0xfc, 0, 7, {0xcc, 0xcc, 0x78, 0x30, 0x30, 0x30, 0x30, 0x00}},  // 89: Y
+    {1, 5, 0, 4, 0xf0, 0, 7, {0xf0, 0x30, 0x70, 0xe0, 0xc0, 0xc0, 0xf0, 0x00}},  // 90: Z
+    {1, 4, 0, 3, 0xe0, 0, 7, {0xe0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xe0, 0x00}},  // 91: [
+    {1, 5, 0, 4, 0xf0, 0, 7, {0xc0, 0xc0, 0x60, 0x60, 0x60, 0x30, 0x30, 0x00}},  // 92: backslash
+    {1, 4, 0, 3, 0xe0, 0, 7, {0xe0, 0x60, 0x60, 0x60, 0x60, 0x60, 0xe0, 0x00}},  // 93: ]
+    {1, 5, 0, 4, 0xf0, 0, 2, {0x60, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}},  // 94: ^
+    {1, 4, 0, 3, 0xe0, 6, 1, {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x00}},  // 95: _
+    {1, 4, 0, 3, 0xe0, 0, 2, {0xc0, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}},  // 96: `
+    {1, 6, 0, 5, 0xf8, 2, 5, {0x00, 0x00, 0x78, 0xd8, 0xd8, 0xd8, 0x78, 0x00}},  // 97: a
+    {1, 6, 0, 5, 0xf8, 0, 7, {0xc0, 0xc0, 0xf0, 0xd8, 0xd8, 0xd8, 0xf0, 0x00}},  // 98: b
+    {1, 5, 0, 4, 0xf0, 2, 5, {0x00, 0x00, 0x70, 0xc0, 0xc0, 0xc0, 0x70, 0x00}},  // 99: c
+    {1, 6, 0, 5, 0xf8, 0, 7, {0x18, 0x18, 0x78, 0xd8, 0xd8, 0xd8, 0x78, 0x00}},  // 100: d
+    {1, 6, 0, 5, 0xf8, 2, 5, {0x00, 0x00, 0x70, 0xd8, 0xf8, 0xc0, 0x70, 0x00}},  // 101: e
+    {1, 4, 0, 3, 0xe0, 0, 7, {0x60, 0xc0, 0xe0, 0xc0, 0xc0, 0xc0, 0xc0, 0x00}},  // 102: f
+    {1, 6, 0, 5, 0xf8, 2, 6, {0x00, 0x00, 0x78, 0xd8, 0xd8, 0x78, 0x38, 0xf0}},  // 103: g
+    {1, 6, 0, 5, 0xf8, 0, 7, {0xc0, 0xc0, 0xf0, 0xd8, 0xd8, 0xd8, 0xd8, 0x00}},  // 104: h
+    {1, 3, 0, 2, 0xc0, 0, 7, {0xc0, 0x00, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0x00}},  // 105: i
+    {1, 4, 0, 3, 0xe0, 0, 8, {0x60, 0x00, 0x60, 0x60, 0x60, 0x60, 0x60, 0xc0}},  // 106: j
+    {1, 6, 0, 5, 0xf8, 0, 7, {0xc0, 0xc0, 0xd8, 0xf0, 0xd8, 0xd8, 0xd8, 0x00}},  // 107: k
+    {1, 3, 0, 2, 0xc0, 0, 7, {0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0x00}},  // 108: l
+    {1, 9, 0, 8, 0xff, 2, 5, {0x00, 0x00, 0xfe, 0xdb, 0xdb, 0xdb, 0xdb, 0x00}},  // 109: m
+    {1, 6, 0, 5, 0xf8, 2, 5, {0x00, 0x00, 0xf0, 0xd8, 0xd8, 0xd8, 0xd8, 0x00}},  // 110: n
+    {1, 6, 0, 5, 0xf8, 2, 5, {0x00, 0x00, 0x70, 0xd8, 0xd8, 0xd8, 0x70, 0x00}},  // 111: o
+    {1, 6, 0, 5, 0xf8, 2, 6, {0x00, 0x00, 0xf0, 0xd8, 0xd8, 0xd8, 0xf0, 0xc0}},  // 112: p
+    {1, 6, 0, 5, 0xf8, 2, 6, {0x00, 0x00, 0x78, 0xd8, 0xd8, 0xd8, 0x78, 0x18}},  // 113: q
+    {1, 6, 0, 5, 0xf8, 2, 5, {0x00, 0x00, 0xd8, 0xf0, 0xc0, 0xc0, 0xc0, 0x00}},  // 114: r
+    {1, 4, 0, 3, 0xe0, 2, 5, {0x00, 0x00, 0x60, 0xc0, 0x60, 0x60, 0xc0, 0x00}},  // 115: s
+    {1, 4, 0, 3, 0xe0, 0, 7, {0xc0, 0xc0, 0xe0, 0xc0, 0xc0, 0xc0, 0x60, 0x00}},  // 116: t
+    {1, 6, 0, 5, 0xf8, 2, 5, {0x00, 0x00, 0xd8, 0xd8, 0xd8, 0xd8, 0xf8, 0x00}},  // 117: u
+    {1, 6, 0, 5, 0xf8, 2, 5, {0x00, 0x00, 0xd8, 0xd8, 0xd8, 0xd8, 0x70, 0x00}},  // 118: v
+    {1, 9, 0, 8, 0xff, 2, 5, {0x00, 0x00, 0xc3, 0xc3, 0xdb, 0xdb, 0x66, 0x00}},  // 119: w
+    {1, 6, 0, 5, 0xf8, 2, 5, {0x00, 0x00, 0xd8, 0x70, 0x70, 0xd8, 0xd8, 0x00}},  // 120: x
+    {1, 6, 0, 5, 0xf8, 2, 6, {0x00, 0x00, 0xd8, 0xd8, 0xd8, 0x78, 0x38, 0x70}},  // 121: y
+    {1, 4, 0, 3, 0xe0, 2, 5, {0x00, 0x00, 0xe0, 0x60, 0xc0, 0xc0, 0xe0, 0x00}},  // 122: z
+    {1, 5, 0, 4, 0xf0, 0, 7, {0x30, 0x60, 0x60, 0xe0, 0x60, 0x60, 0x30, 0x00}},  // 123: {
+    {1, 3, 0, 2, 0xc0, 0, 7, {0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0x00}},  // 124: |
+    {1, 5, 0, 4, 0xf0, 0, 7, {0xc0, 0x60, 0x60, 0x70, 0x60, 0x60, 0xc0, 0x00}},  // 125: }
+    {1, 7, 0, 6, 0xfc, 0, 2, {0x6c, 0xd8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}},  // 126: ~
+};
+
+const display_font_t display_font_squeezed = {
+    32, 126, 7, display_font_squeezed_glyphs};
+
+// u8g2_font_amstrad_cpc_extended_8f, encodings 0 to 255
+static const display_font_glyph_t display_font_amstrad_glyphs[] = {
+    {0, 0, 0, 0, 0, 0, 0, {0}},  // 0: none
+    {0, 0, 0, 0, 0, 0, 0, {0}},  // 1: none
+    {0, 0, 0, 0, 0, 0, 0, {0}},  // 2: none
+    {0, 0, 0, 0, 0, 0, 0, {0}},  // 3: none
+    {0, 0, 0, 0, 0, 0, 0, {0}},  // 4: none
+    {0, 0, 0, 0, 0, 0, 0, {0}},  // 5: none
+    {0, 0, 0, 0, 0, 0, 0, {0}},  // 6: none
+    {0, 0, 0, 0, 0, 0, 0, {0}},  // 7: none
+    {0, 0, 0, 0, 0, 0, 0, {0}},  // 8: none
+    {0, 0, 0, 0, 0, 0, 0, {0}},  // 9: none
+    {0, 0, 0, 0, 0, 0, 0, {0}},  // 10: none
+    {0, 0, 0, 0, 0, 0, 0, {0}},  // 11: none
+    {0, 0, 0, 0, 0, 0, 0, {0}},  // 12: none
+    {0, 0, 0, 0, 0, 0, 0, {0}},  // 13: none
+    {0, 0, 0, 0, 0, 0, 0, {0}},  // 14: none
+    {0, 0, 0, 0, 0, 0, 0, {0}},  // 15: none
+    {0, 0, 0, 0, 0, 0, 0, {0}},  // 16: none
+    {0, 0, 0, 0, 0, 0, 0, {0}},  // 17: none
+    {0, 0, 0, 0, 0, 0, 0, {0}},  // 18: none
+    {0, 0, 0, 0, 0, 0, 0, {0}},  // 19: none
+    {0, 0, 0, 0, 0, 0, 0, {0}},  // 20: none
+    {0, 0, 0, 0, 0, 0, 0, {0}},  // 21: none
+    {0, 0, 0, 0, 0, 0, 0, {0}},  // 22: none
+    {0, 0, 0, 0, 0, 0, 0, {0}},  // 23: none
+    {0, 0, 0, 0, 0, 0, 0, {0}},  // 24: none
+    {0, 0, 0, 0, 0, 0, 0, {0}},  // 25: none
+    {0, 0, 0, 0, 0, 0, 0, {0}},  // 26: none
+    {0, 0, 0, 0, 0, 0, 0, {0}},  // 27: none
+    {0, 0, 0, 0, 0, 0, 0, {0}},  // 28: none
+    {0, 0, 0, 0, 0, 0, 0, {0}},  // 29: none
+    {0, 0, 0, 0, 0, 0, 0, {0}},  // 30: none
+    {0, 0, 0, 0, 0, 0, 0, {0}},  // 31: none
+    {1, 8, 0, 8, 0xff, 0, 8, {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}},  // 32: space
+    {1, 8, 0, 8, 0xff, 0, 8, {0x18, 0x18, 0x18, 0x18, 0x18, 0x00, 0x18, 0x00}},  // 33: !
+    {1, 8, 0, 8, 0xff, 0, 8, {0x6c, 0x6c, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x00}},  // 34: "
+    {1, 8, 0, 8, 0xff, 0, 8, {0x6c, 0x6c, 0xfe, 0x7c, 0xfe, 0x6c, 0x6c, 0x00}},  // 35: #
+    {1, 8, 0, 8, 0xff, 0, 8, {0x18, 0x3e, 0x58, 0x3c, 0x1a, 0x7c, 0x18, 0x00}},  // 36: $
+    {1, 8, 0, 8, 0xff, 0, 8, {0x00, 0xc6, 0xcc, 0x18, 0x30, 0x66, 0xc6, 0x00}},  // 37: %
+    {1, 8, 0, 8, 0xff, 0, 8, {0x38, 0x6c, 0x38, 0x76, 0xdc, 0xcc, 0x76, 0x00}},  // 38: &
+    {1, 8, 0, 8, 0xff, 0, 8, {0x18, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00}},  // 39: '
+    {1, 8, 0, 8, 0xff, 0, 8, {0x0c, 0x18, 0x30, 0x30, 0x30, 0x18, 0x0c, 0x00}},  // 40: (
+    {1, 8, 0, 8, 0xff, 0, 8, {0x30, 0x18, 0x0c, 0x0c, 0x0c, 0x18, 0x30, 0x00}},  // 41: )
+    {1, 8, 0, 8, 0xff, 0, 8, {0x00, 0x66, 0x3c, 0xff, 0x3c, 0x66, 0x00, 0x00}},  // 42: *
+    {1, 8, 0, 8, 0xff, 0, 8, {0x00, 0x18, 0x18, 0x7e, 0x18, 0x18, 0x00, 0x00}},  // 43: +
+    {1, 8, 0, 8, 0xff, 0, 8, {0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x30}},  // 44: ,
+    {1, 8, 0, 8, 0xff, 0, 8, {0x00, 0x00, 0x00, 0x7e, 0x00, 0x00, 0x00, 0x00}},  // 45: -
+    {1, 8, 0, 8, 0xff, 0, 8, {0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x00}},  // 46: .
+    {1, 8, 0, 8, 0xff, 0, 8, {0x06, 0x0c, 0x18, 0x30, 0x60, 0xc0, 0x80, 0x00}},  // 47: /
+    {1, 8, 0, 8, 0xff, 0, 8, {0x7c, 0xc6, 0xce, 0xd6, 0xe6, 0xc6, 0x7c, 0x00}},  // 48: 0
+    {1, 8, 0, 8, 0xff, 0, 8, {0x18, 0x38, 0x18, 0x18, 0x18, 0x18, 0x7e, 0x00}},  // 49: 1
+    {1, 8, 0, 8, 0xff, 0, 8, {0x3c, 0x66, 0x06, 0x3c, 0x60, 0x66, 0x7e, 0x00}},  // 50: 2
+    {1, 8, 0, 8, 0xff, 0, 8, {0x3c, 0x46, 0x06, 0x1c, 0x06, 0x66, 0x3c, 0x00}},  // 51: 3
+    {1, 8, 0, 8, 0xff, 0, 8, {0x18, 0x38, 0x58, 0x98, 0xfe, 0x18, 0x3c, 0x00}},  // 52: 4
+    {1, 8, 0, 8, 0xff, 0, 8, {0x7e, 0x62, 0x60, 0x3c, 0x06, 0x66, 0x3c, 0x00}},  // 53: 5
+    {1, 8, 0, 8, 0xff, 0, 8, {0x3c, 0x66, 0x60, 0x7c, 0x66, 0x66, 0x3c, 0x00}},  // 54: 6
+    {1, 8, 0, 8, 0xff, 0, 8, {0x7e, 0x46, 0x0e, 0x0c, 0x18, 0x18, 0x18, 0x00}},  // 55: 7
+    {1, 8, 0, 8, 0xff, 0, 8, {0x3c, 0x66, 0x66, 0x3c, 0x66, 0x66, 0x3c, 0x00}},  // 56: 8
+    {1, 8, 0, 8, 0xff, 0, 8, {0x3c, 0x66, 0x66, 0x3e, 0x06, 0x66, 0x3c, 0x00}},  // 57: 9
+    {1, 8, 0, 8, 0xff, 0, 8, {0x00, 0x00, 0x18, 0x18, 0x00, 0x18, 0x18, 0x00}},  // 58: :
+    {1, 8, 0, 8, 0xff, 0, 8, {0x00, 0x00, 0x18, 0x18, 0x00, 0x18, 0x18, 0x30}},  // 59: ;
+    {1, 8, 0, 8, 0xff, 0, 8, {0x0c, 0x18, 0x30, 0x60, 0x30, 0x18, 0x0c, 0x00}},  // 60: <
+    {1, 8, 0, 8, 0xff, 0, 8, {0x00, 0x00, 0x7e, 0x00, 0x00, 0x7e, 0x00, 0x00}},  // 61: =
+    {1, 8, 0, 8, 0xff, 0, 8, {0x60, 0x30, 0x18, 0x0c, 0x18, 0x30, 0x60, 0x00}},  // 62: >
+    {1, 8, 0, 8, 0xff, 0, 8, {0x3c, 0x66, 0x06, 0x0c, 0x18, 0x00, 0x18, 0x00}},  // 63: ?
+    {1, 8, 0, 8, 0xff, 0, 8, {0x7c, 0xc6, 0xde, 0xde, 0xde, 0xc0, 0x7c, 0x00}},  // 64: @
+    {1, 8, 0, 8, 0xff, 0, 8, {0x18, 0x3c, 0x66, 0x66, 0x7e, 0x66, 0x66, 0x00}},  // 65: A
+    {1, 8, 0, 8, 0xff, 0, 8, {0xfc, 0x66, 0x66, 0x7c, 0x66, 0x66, 0xfc, 0x00}},  // 66: B
+    {1, 8, 0, 8, 0xff, 0, 8, {0x3c, 0x66, 0xc0, 0xc0, 0xc0, 0x66, 0x3c, 0x00}},  // 67: C
+    {1, 8, 0, 8, 0xff, 0, 8, {0xf8, 0x6c, 0x66, 0x66, 0x66, 0x6c, 0xf8, 0x00}},  // 68: D
+    {1, 8, 0, 8, 0xff, 0, 8, {0xfe, 0x62, 0x68, 0x78, 0x68, 0x62, 0xfe, 0x00}},  // 69: E
+    {1, 8, 0, 8, 0xff, 0, 8, {0xfe, 0x62, 0x68, 0x78, 0x68, 0x60, 0xf0, 0x00}},  // 70: F
+    {1, 8, 0, 8, 0xff, 0, 8, {0x3c, 0x66, 0xc0, 0xc0, 0xce, 0xc6, 0x7e, 0x00}},  // 71: G
+    {1, 8, 0, 8, 0xff, 0, 8, {0x66, 0x66, 0x66, 0x7e, 0x66, 0x66, 0x66, 0x00}},  // 72: H
+    {1, 8, 0, 8, 0xff, 0, 8, {0x7e, 0x18, 0x18, 0x18, 0x18, 0x18, 0x7e, 0x00}},  // 73: I
+    {1, 8, 0, 8, 0xff, 0, 8, {0x1e, 0x0c, 0x0c, 0x0c, 0xcc, 0xcc, 0x78, 0x00}},  // 74: J
+    {1, 8, 0, 8, 0xff, 0, 8, {0xe6, 0x66, 0x6c, 0x78, 0x6c, 0x66, 0xe6, 0x00}},  // 75: K
+    {1, 8, 0, 8, 0xff, 0, 8, {0xf0, 0x60, 0x60, 0x60, 0x62, 0x66, 0xfe, 0x00}},  // 76: L
+    {1, 8, 0, 8, 0xff, 0, 8, {0xc6, 0xee, 0xfe, 0xfe, 0xd6, 0xc6, 0xc6, 0x00}},  // 77: M
+    {1, 8, 0, 8, 0xff, 0, 8, {0xc6, 0xe6, 0xf6, 0xde, 0xce, 0xc6, 0xc6, 0x00}},  // 78: N
+    {1, 8, 0, 8, 0xff, 0, 8, {0x38, 0x6c, 0xc6, 0xc6, 0xc6, 0x6c, 0x38, 0x00}},  // 79: O
+    {1, 8, 0, 8, 0xff, 0, 8, {0xfc, 0x66, 0x66, 0x78, 0x60, 0x60, 0xf0, 0x00}},  // 80: P
+    {1, 8, 0, 8, 0xff, 0, 8, {0x38, 0x6c, 0xc6, 0xc6, 0xda, 0xcc, 0x76, 0x00}},  // 81: Q
+    {1, 8, 0, 8, 0xff, 0, 8, {0xfc, 0x66, 0x66, 0x7c, 0x6c, 0x66, 0xe2, 0x00}},  // 82: R
+    {1, 8, 0, 8, 0xff, 0, 8, {0x3c, 0x66, 0x60, 0x3c, 0x06, 0x66, 0x3c, 0x00}},  // 83: S
+    {1, 8, 0, 8, 0xff, 0, 8, {0x7e, 0x5a, 0x18, 0x18, 0x18, 0x18, 0x3c, 0x00}},  // 84: T
+    {1, 8, 0, 8, 0xff, 0, 8, {0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x3c, 0x00}},  // 85: U
+    {1, 8, 0, 8, 0xff, 0, 8, {0x66, 0x66, 0x66, 0x66, 0x66, 0x3c, 0x18, 0x00}},  // 86: V
+    {1, 8, 0, 8, 0xff, 0, 8, {0xc6, 0xc6, 0xc6, 0xd6, 0xfe, 0xee, 0xc6, 0x00}},  // 87: W
+    {1, 8, 0, 8, 0xff, 0, 8, {0xc6, 0x6c, 0x38, 0x38, 0x6c, 0xc6, 0xc6, 0x00}},  // 88: X
+    {1, 8, 0, 8, 0xff, 0, 8, {0x66, 0x66, 0x66, 0x3c, 0x18, 0x18, 0x3c, 0x00}},  // 89: Y
+    {1, 8, 0, 8, 0xff, 0, 8, {0xfe, 0xc6, 0x8c, 0x18, 0x32, 0x66, 0xfe, 0x00}},  // 90: Z
+    {1, 8, 0, 8, 0xff, 0, 8, {0x3c, 0x30, 0x30, 0x30, 0x30, 0x30, 0x3c, 0x00}},  // 91: [
+    {1, 8, 0, 8, 0xff, 0, 8, {0xc0, 0x60, 0x30, 0x18, 0x0c, 0x06, 0x02, 0x00}},  // 92: backslash
+    {1, 8, 0, 8, 0xff, 0, 8, {0x3c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x3c, 0x00}},  // 93: ]
+    {1, 8, 0, 8, 0xff, 0, 8, {0x10, 0x38, 0x6c, 0xc6, 0x00, 0x00, 0x00, 0x00}},  // 94: ^
+    {1, 8, 0, 8, 0xff, 0, 8, {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff}},  // 95: _
+    {1, 8, 0, 8, 0xff, 0, 8, {0x00, 0x30, 0x18, 0x0c, 0x00, 0x00, 0x00, 0x00}},  // 96: `
+    {1, 8, 0, 8, 0xff, 0, 8, {0x00, 0x00, 0x78, 0x0c, 0x7c, 0xcc, 0x76, 0x00}},  // 97: a
+    {1, 8, 0, 8, 0xff, 0, 8, {0xe0, 0xe0, 0x7c, 0x66, 0x66, 0x66, 0xbc, 0x00}},  // 98: b
+    {1, 8, 0, 8, 0xff, 0, 8, {0x00, 0x00, 0x3c, 0x66, 0x60, 0x66, 0x3c, 0x00}},  // 99: c
+    {1, 8, 0, 8, 0xff, 0, 8, {0x1c, 0x0c, 0x7c, 0xcc, 0xcc, 0xcc, 0x76, 0x00}},  // 100: d
+    {1, 8, 0, 8, 0xff, 0, 8, {0x00, 0x00, 0x3c, 0x66, 0x7e, 0x60, 0x3c, 0x00}},  // 101: e
+    {1, 8, 0, 8, 0xff, 0, 8, {0x1c, 0x36, 0x30, 0x78, 0x30, 0x30, 0x78, 0x00}},  // 102: f
+    {1, 8, 0, 8, 0xff, 0, 8, {0x00, 0x00, 0x3e, 0x66, 0x66, 0x3e, 0x06, 0x7c}},  // 103: g
+    {1, 8, 0, 8, 0xff, 0, 8, {0xe0, 0x60, 0x6c, 0x76, 0x66, 0x66, 0xe6, 0x00}},  // 104: h
+    {1, 8, 0, 8, 0xff, 0, 8, {0x18, 0x00, 0x38, 0x18, 0x18, 0x18, 0x3c, 0x00}},  // 105: i
+    {1, 8, 0, 8, 0xff, 0, 8, {0x02, 0x00, 0x0e, 0x06, 0x06, 0x66, 0x66, 0x3c}},  // 106: j
+    {1, 8, 0, 8, 0xff, 0, 8, {0xe0, 0x60, 0x66, 0x6c, 0x78, 0x6c, 0xe6, 0x00}},  // 107: k
+    {1, 8, 0, 8, 0xff, 0, 8, {0x38, 0x18, 0x18, 0x18, 0x18, 0x18, 0x3c, 0x00}},  // 108: l
+    {1, 8, 0, 8, 0xff, 0, 8, {0x00, 0x00, 0x6c, 0xfe, 0xd6, 0xd6, 0xc6, 0x00}},  // 109: m
+    {1, 8, 0, 8, 0xff, 0, 8, {0x00, 0x00, 0xd8, 0x66, 0x66, 0x66, 0x66, 0x00}},  // 110: n
+    {1, 8, 0, 8, 0xff, 0, 8, {0x00, 0x00, 0x3c, 0x66, 0x66, 0x66, 0x3c, 0x00}},  // 111: o
+    {1, 8, 0, 8, 0xff, 0, 8, {0x00, 0x00, 0xdc, 0x66, 0x66, 0x7c, 0x60, 0xf0}},  // 112: p
+    {1, 8, 0, 8, 0xff, 0, 8, {0x00, 0x00, 0x76, 0xcc, 0xcc, 0x7c, 0x0c, 0x1e}},  // 113: q
+    {1, 8, 0, 8, 0xff, 0, 8, {0x00, 0x00, 0xd8, 0x6c, 0x60, 0x60, 0xf0, 0x00}},  // 114: r
+    {1, 8, 0, 8, 0xff, 0, 8, {0x00, 0x00, 0x3c, 0x60, 0x3c, 0x06, 0x7c, 0x00}},  // 115: s
+    {1, 8, 0, 8, 0xff, 0, 8, {0x30, 0x30, 0x7c, 0x30, 0x30, 0x36, 0x1c, 0x00}},  // 116: t
+    {1, 8, 0, 8, 0xff, 0, 8, {0x00, 0x00, 0x66, 0x66, 0x66, 0x66, 0x3e, 0x00}},  // 117: u
+    {1, 8, 0, 8, 0xff, 0, 8, {0x00, 0x00, 0x66, 0x66, 0x66, 0x3c, 0x18, 0x00}},  // 118: v
+    {1, 8, 0, 8, 0xff, 0, 8, {0x00, 0x00, 0xc6, 0xd6, 0xd6, 0xfe, 0x6c, 0x00}},  // 119: w
+    {1, 8, 0, 8, 0xff, 0, 8, {0x00, 0x00, 0xc6, 0x6c, 0x38, 0x6c, 0xc6, 0x00}},  // 120: x
+    {1, 8, 0, 8, 0xff, 0, 8, {0x00, 0x00, 0x66, 0x66, 0x66, 0x3e, 0x06, 0x7c}},  // 121: y
+    {1, 8, 0, 8, 0xff, 0, 8, {0x00, 0x00, 0x7e, 0x4c, 0x18, 0x30, 0x7e, 0x00}},  // 122: z
+    {1, 8, 0, 8, 0xff, 0, 8, {0x70, 0x18, 0x18, 0x0e, 0x18, 0x18, 0x70, 0x00}},  // 123: {
+    {1, 8, 0, 8, 0xff, 0, 8, {0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00}},  // 124: |
+    {1, 8, 0, 8, 0xff, 0, 8, {0x0e, 0x18, 0x18, 0x70, 0x18, 0x18, 0x0e, 0x00}},  // 125: }
+    {1, 8, 0, 8, 0xff, 0, 8, {0x76, 0xd8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}},  // 126: ~
+    {0, 0, 0, 0, 0, 0, 0, {0}},  // 127: none
+    {1, 8, 0, 8, 0xff, 0, 8, {0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18}},  // 128: -
+    {1, 8, 0, 8, 0xff, 0, 8, {0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00}},  // 129: -
+    {1, 8, 0, 8, 0xff, 0, 8, {0x18, 0x18, 0x18, 0x1f, 0x1f, 0x00, 0x00, 0x00}},  // 130: -
+    {1, 8, 0, 8, 0xff, 0, 8, {0x00, 0x00, 0x00, 0x1f, 0x1f, 0x18, 0x18, 0x18}},  // 131: -
+    {1, 8, 0, 8, 0xff, 0, 8, {0x00, 0x00, 0x00, 0xf8, 0xf8, 0x18, 0x18, 0x18}},  // 132: -
+    {1, 8, 0, 8, 0xff, 0, 8, {0x18, 0x18, 0x18, 0xf8, 0xf8, 0x00, 0x00, 0x00}},  // 133: -
+    {1, 8, 0, 8, 0xff, 0, 8, {0x18, 0x18, 0x18, 0xff, 0xff, 0x00, 0x00, 0x00}},  // 134: -
+    {1, 8, 0, 8, 0xff, 0, 8, {0x18, 0x18, 0x18, 0x1f, 0x1f, 0x18, 0x18, 0x18}},  // 135: -
+    {1, 8, 0, 8, 0xff, 0, 8, {0x00, 0x00, 0x00, 0xff, 0xff, 0x18, 0x18, 0x18}},  // 136: -
+    {1, 8, 0, 8, 0xff, 0, 8, {0x18, 0x18, 0x18, 0xf8, 0xf8, 0x18, 0x18, 0x18}},  // 137: -
+    {1, 8, 0, 8, 0xff, 0, 8, {0x18, 0x18, 0x18, 0xff, 0xff, 0x18, 0x18, 0x18}},  // 138: -
+    {1, 8, 0, 8, 0xff, 0, 8, {0x00, 0x10, 0x30, 0x7e, 0x30, 0x10, 0x00, 0x00}},  // 139: -
+    {1, 8, 0, 8, 0xff, 0, 8, {0x00, 0x10, 0x38, 0x7c, 0x10, 0x10, 0x00, 0x00}},  // 140: -
+    {1, 8, 0, 8, 0xff, 0, 8, {0x00, 0x08, 0x0c, 0x7e, 0x0c, 0x08, 0x00, 0x00}},  // 141: -
+    {1, 8, 0, 8, 0xff, 0, 8, {0x00, 0x10, 0x10, 0x7c, 0x38, 0x10, 0x00, 0x00}},  // 142: -
+    {1, 8, 0, 8, 0xff, 0, 8, {0x00, 0x00, 0x00, 0x00, 0x0f, 0x0f, 0x0f, 0x0f}},  // 143: -
+    {1, 8, 0, 8, 0xff, 0, 8, {0x00, 0x00, 0x00, 0x00, 0xf0, 0xf0, 0xf0, 0xf0}},  // 144: -
+    {1, 8, 0, 8, 0xff, 0, 8, {0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff}},  // 145: -
+    {1, 8, 0, 8, 0xff, 0, 8, {0x0f, 0x0f, 0x0f, 0x0f, 0x00, 0x00, 0x00, 0x00}},  // 146: -
+    {1, 8, 0, 8, 0xff, 0, 8, {0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f}},  // 147: -
+    {1, 8, 0, 8, 0xff, 0, 8, {0x0f, 0x0f, 0x0f, 0x0f, 0xf0, 0xf0, 0xf0, 0xf0}},  // 148: -
+    {1, 8, 0, 8, 0xff, 0, 8, {0x0f, 0x0f, 0x0f, 0x0f, 0xff, 0xff, 0xff, 0xff}},  // 149: -
+    {1, 8, 0, 8, 0xff, 0, 8, {0xf0, 0xf0, 0xf0, 0xf0, 0x00, 0x00, 0x00, 0x00}},  // 150: -
+    {1, 8, 0, 8, 0xff, 0, 8, {0xf0, 0xf0, 0xf0, 0xf0, 0x0f, 0x0f, 0x0f, 0x0f}},  // 151: -
+    {1, 8, 0, 8, 0xff, 0, 8, {0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0}},  // 152: -
+    {1, 8, 0, 8, 0xff, 0, 8, {0xf0, 0xf0, 0xf0, 0xf0, 0xff, 0xff, 0xff, 0xff}},  // 153: -
+    {1, 8, 0, 8, 0xff, 0, 8, {0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00}},  // 154: -
+    {1, 8, 0, 8, 0xff, 0, 8, {0xff, 0xff, 0xff, 0xff, 0x0f, 0x0f, 0x0f, 0x0f}},  // 155: -
+    {1, 8, 0, 8, 0xff, 0, 8, {0xff, 0xff, 0xff, 0xff, 0xf0, 0xf0, 0xf0, 0xf0}},  // 156: -
+    {1, 8, 0, 8, 0xff, 0, 8, {0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff}},  // 157: -
+    {1, 8, 0, 8, 0xff, 0, 8, {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff}},  // 158: -
+    {1, 8, 0, 8, 0xff, 0, 8, {0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff}},  // 159: -
+    {0, 0, 0, 0, 0, 0, 0, {0}},  // 160: none
+    {1, 8, 0, 8, 0xff, 0, 8, {0x18, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00}},  // 161: -
+    {1, 8, 0, 8, 0xff, 0, 8, {0x00, 0x10, 0x7c, 0xd6, 0xd0, 0xd6, 0x7c, 0x10}},  // 162: -
+    {1, 8, 0, 8, 0xff, 0, 8, {0x3c, 0x66, 0x60, 0xf8, 0x60, 0x66, 0xfe, 0x00}},  // 163: -
+    {1, 8, 0, 8, 0xff, 0, 8, {0x00, 0x42, 0x3c, 0x66, 0x66, 0x3c, 0x42, 0x00}},  // 164: -
+    {1, 8, 0, 8, 0xff, 0, 8, {0x66, 0x3c, 0x7e, 0x18, 0x7e, 0x18, 0x3c, 0x00}},  // 165: -
+    {1, 8, 0, 8, 0xff, 0, 8, {0x18, 0x18, 0x18, 0x00, 0x18, 0x18, 0x18, 0x00}},  // 166: -
+    {1, 8, 0, 8, 0xff, 0, 8, {0x1e, 0x30, 0x38, 0x6c, 0x38, 0x30, 0xf0, 0x00}},  // 167: -
+    {1, 8, 0, 8, 0xff, 0, 8, {0x66, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}},  // 168: -
+    {1, 8, 0, 8, 0xff, 0, 8, {0x38, 0x44, 0xba, 0xa2, 0xba, 0x44, 0x38, 0x00}},  // 169: -
+    {1, 8, 0, 8, 0xff, 0, 8, {0x70, 0x18, 0x78, 0xd8, 0x6c, 0x00, 0xfc, 0x00}},  // 170: -
+    {1, 8, 0, 8, 0xff, 0, 8, {0x00, 0x36, 0x6c, 0xd8, 0x6c, 0x36, 0x00, 0x00}},  // 171: -
+    {1, 8, 0, 8, 0xff, 0, 8, {0x00, 0x00, 0x00, 0x7e, 0x02, 0x00, 0x00, 0x00}},  // 172: -
+    {1, 8, 0, 8, 0xff, 0, 8, {0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00}},  // 173: -
+    {1, 8, 0, 8, 0xff, 0, 8, {0x38, 0x44, 0xba, 0xb2, 0xaa, 0x44, 0x38, 0x00}},  // 174: -
+    {1, 8, 0, 8, 0xff, 0, 8, {0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}},  // 175: -
+    {1, 8, 0, 8, 0xff, 0, 8, {0x38, 0x6c, 0x44, 0x6c, 0x38, 0x00, 0x00, 0x00}},  // 176: -
+    {1, 8, 0, 8, 0xff, 0, 8, {0x00, 0x18, 0x18, 0x7e, 0x18, 0x18, 0x7e, 0x00}},  // 177: -
+    {1, 8, 0, 8, 0xff, 0, 8, {0x78, 0x0c, 0x38, 0x60, 0x7c, 0x00, 0x00, 0x00}},  // 178: -
+    {1, 8, 0, 8, 0xff, 0, 8, {0x78, 0x0c, 0x38, 0x0c, 0x78, 0x00, 0x00, 0x00}},  // 179: -
+    {1, 8, 0, 8, 0xff, 0, 8, {0x18, 0x18, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00}},  // 180: -
+    {1, 8, 0, 8, 0xff, 0, 8, {0x00, 0x00, 0x00, 0x66, 0x66, 0x66, 0x7c, 0x60}},  // 181: -
+    {1, 8, 0, 8, 0xff, 0, 8, {0x7e, 0xf4, 0x74, 0x74, 0x34, 0x34, 0x34, 0x00}},  // 182: -
+    {1, 8, 0, 8, 0xff, 0, 8, {0x00, 0x00, 0x00, 0x18, 0x18, 0x00, 0x00, 0x00}},  // 183: -
+    {1, 8, 0, 8, 0xff, 0, 8, {0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x38, 0x00}},  // 184: -
+    {1, 8, 0, 8, 0xff, 0, 8, {0x38, 0x18, 0x18, 0x18, 0x3c, 0x00, 0x00, 0x00}},  // 185: -
+    {1, 8, 0, 8, 0xff, 0, 8, {0x38, 0x6c, 0x44, 0x6c, 0x38, 0x00, 0x7c, 0x00}},  // 186: -
+    {1, 8, 0, 8, 0xff, 0, 8, {0x00, 0xd8, 0x6c, 0x36, 0x6c, 0xd8, 0x00, 0x00}},  // 187: -
+    {1, 8, 0, 8, 0xff, 0, 8, {0x40, 0xc0, 0x44, 0x4c, 0x54, 0x1e, 0x04, 0x00}},  // 188: -
+    {1, 8, 0, 8, 0xff, 0, 8, {0x40, 0xc0, 0x4c, 0x52, 0x44, 0x08, 0x1e, 0x00}},  // 189: -
+    {1, 8, 0, 8, 0xff, 0, 8, {0xe0, 0x10, 0x62, 0x16, 0xea, 0x0f, 0x02, 0x00}},  // 190: -
+    {1, 8, 0, 8, 0xff, 0, 8, {0x18, 0x00, 0x18, 0x30, 0x66, 0x66, 0x3c, 0x00}},  // 191: -
+    {1, 8, 0, 8, 0xff, 0, 8, {0x30, 0x00, 0x3c, 0x66, 0x7e, 0x66, 0x66, 0x00}},  // 192: -
+    {1, 8, 0, 8, 0xff, 0, 8, {0x0c, 0x00, 0x3c, 0x66, 0x7e, 0x66, 0x66, 0x00}},  // 193: -
+    {1, 8, 0, 8, 0xff, 0, 8, {0x18, 0x00, 0x3c, 0x66, 0x7e, 0x66, 0x66, 0x00}},  // 194: -
+    {1, 8, 0, 8, 0xff, 0, 8, {0x3c, 0x00, 0x3c, 0x66, 0x7e, 0x66, 0x66, 0x00}},  // 195: -
+    {1, 8, 0, 8, 0xff, 0, 8, {0x66, 0x00, 0x3c, 0x66, 0x7e, 0x66, 0x66, 0x00}},  // 196: -
+    {1, 8, 0, 8, 0xff, 0, 8, {0x18, 0x24, 0x3c, 0x66, 0x7e, 0x66, 0x66, 0x00}},  // 197: -
+    {1, 8, 0, 8, 0xff, 0, 8, {0x1e, 0x3a, 0x58, 0xde, 0xf8, 0xda, 0xde, 0x00}},  // 198: -
+    {1, 8, 0, 8, 0xff, 0, 8, {0x3c, 0x66, 0xc0, 0xc0, 0x66, 0x3c, 0x18, 0x78}},  // 199: -
+    {1, 8, 0, 8, 0xff, 0, 8, {0x60, 0x00, 0xfe, 0x60, 0x7c, 0x60, 0xfe, 0x00}},  // 200: -
+    {1, 8, 0, 8, 0xff, 0, 8, {0x18, 0x00, 0xfe, 0x60, 0x7c, 0x60, 0xfe, 0x00}},  // 201: -
+    {1, 8, 0, 8, 0xff, 0, 8, {0x3c, 0x00, 0xfe, 0x60, 0x7c, 0x60, 0xfe, 0x00}},  // 202: -
+    {1, 8, 0, 8, 0xff, 0, 8, {0x6c, 0x00, 0xfe, 0x60, 0x7c, 0x60, 0xfe, 0x00}},  // 203: -
+    {1, 8, 0, 8, 0xff, 0, 8, {0x30, 0x00, 0x7e, 0x18, 0x18, 0x18, 0x7e, 0x00}},  // 204: -
+    {1, 8, 0, 8, 0xff, 0, 8, {0x0c, 0x00, 0x7e, 0x18, 0x18, 0x18, 0x7e, 0x00}},  // 205: -
+    {1, 8, 0, 8, 0xff, 0, 8, {0x3c, 0x00, 0x7e, 0x18, 0x18, 0x18, 0x7e, 0x00}},  // 206: -
+    {1, 8, 0, 8, 0xff, 0, 8, {0x66, 0x00, 0x7e, 0x18, 0x18, 0x18, 0x7e, 0x00}},  // 207: -
+    {1, 8, 0, 8, 0xff, 0, 8, {0xf8, 0x6c, 0x66, 0xf6, 0x66, 0x6c, 0xf8, 0x00}},  // 208: -
+    {1, 8, 0, 8, 0xff, 0, 8, {0x32, 0x4c, 0x00, 0x66, 0x76, 0x6e, 0x66, 0x00}},  // 209: -
+    {1, 8, 0, 8, 0xff, 0, 8, {0x30, 0x00, 0x7c, 0xc6, 0xc6, 0xc6, 0x7c, 0x00}},  // 210: -
+    {1, 8, 0, 8, 0xff, 0, 8, {0x0c, 0x00, 0x7c, 0xc6, 0xc6, 0xc6, 0x7c, 0x00}},  // 211: -
+    {1, 8, 0, 8, 0xff, 0, 8, {0x38, 0x00, 0x7c, 0xc6, 0xc6, 0xc6, 0x7c, 0x00}},  // 212: -
+    {1, 8, 0, 8, 0xff, 0, 8, {0x7c, 0x00, 0x7c, 0xc6, 0xc6, 0xc6, 0x7c, 0x00}},  // 213: -
+    {1, 8, 0, 8, 0xff, 0, 8, {0x6c, 0x00, 0x7c, 0xc6, 0xc6, 0xc6, 0x7c, 0x00}},  // 214: -
+    {1, 8, 0, 8, 0xff, 0, 8, {0x00, 0xc6, 0x6c, 0x38, 0x38, 0x6c, 0xc6, 0x00}},  // 215: -
+    {1, 8, 0, 8, 0xff, 0, 8, {0x3b, 0x6c, 0xde, 0xd6, 0xf6, 0x6c, 0xb8, 0x00}},  // 216: -
+    {1, 8, 0, 8, 0xff, 0, 8, {0x30, 0x00, 0x66, 0x66, 0x66, 0x66, 0x3c, 0x00}},  // 217: -
+    {1, 8, 0, 8, 0xff, 0, 8, {0x0c, 0x00, 0x66, 0x66, 0x66, 0x66, 0x3c, 0x00}},  // 218: -
+    {1, 8, 0, 8, 0xff, 0, 8, {0x3c, 0x00, 0x66, 0x66, 0x66, 0x66, 0x3c, 0x00}},  // 219: -
+    {1, 8, 0, 8, 0xff, 0, 8, {0x66, 0x00, 0x66, 0x66, 0x66, 0x66, 0x3c, 0x00}},  // 220: -
+    {1, 8, 0, 8, 0xff, 0, 8, {0x30, 0x00, 0x66, 0x66, 0x3c, 0x18, 0x3c, 0x00}},  // 221: -
+    {1, 8, 0, 8, 0xff, 0, 8, {0xc0, 0xf8, 0xc4, 0xc4, 0xc4, 0xf8, 0xc0, 0x00}},  // 222: -
+    {1, 8, 0, 8, 0xff, 0, 8, {0x78, 0xc6, 0xc6, 0xfc, 0xc6, 0xc6, 0xf8, 0x00}},  // 223: -
+    {1, 8, 0, 8, 0xff, 0, 8, {0x60, 0x00, 0x78, 0x0c, 0x7c, 0xcc, 0x76, 0x00}},  // 224: -
+    {1, 8, 0, 8, 0xff, 0, 8, {0x18, 0x00, 0x78, 0x0c, 0x7c, 0xcc, 0x76, 0x00}},  // 225: -
+    {1, 8, 0, 8, 0xff, 0, 8, {0x38, 0x00, 0x78, 0x0c, 0x7c, 0xcc, 0x76, 0x00}},  // 226: -
+    {1, 8, 0, 8, 0xff, 0, 8, {0x7c, 0x00, 0x78, 0x0c, 0x7c, 0xcc, 0x76, 0x00}},  // 227: -
+    {1, 8, 0, 8, 0xff, 0, 8, {0x6c, 0x00, 0x78, 0x0c, 0x7c, 0xcc, 0x76, 0x00}},  // 228: -
+    {1, 8, 0, 8, 0xff, 0, 8, {0x30, 0x48, 0x78, 0x0c, 0x7c, 0xcc, 0x76, 0x00}},  // 229: -
+    {1, 8, 0, 8, 0xff, 0, 8, {0x00, 0x00, 0x7c, 0x12, 0x7e, 0xd8, 0x76, 0x00}},  // 230: -
+    {1, 8, 0, 8, 0xff, 0, 8, {0x00, 0x00, 0x3c, 0x62, 0x60, 0x3e, 0x08, 0x18}},  // 231: -
+    {1, 8, 0, 8, 0xff, 0, 8, {0x30, 0x00, 0x3c, 0x66, 0x7e, 0x60, 0x3c, 0x00}},  // 232: -
+    {1, 8, 0, 8, 0xff, 0, 8, {0x0c, 0x00, 0x3c, 0x66, 0x7e, 0x60, 0x3c, 0x00}},  // 233: -
+    {1, 8, 0, 8, 0xff, 0, 8, {0x3c, 0x00, 0x3c, 0x66, 0x7e, 0x60, 0x3c, 0x00}},  // 234: -
+    {1, 8, 0, 8, 0xff, 0, 8, {0x66, 0x00, 0x3c, 0x66, 0x7e, 0x60, 0x3c, 0x00}},  // 235: -
+    {1, 8, 0, 8, 0xff, 0, 8, {0x30, 0x18, 0x00, 0x38, 0x18, 0x18, 0x3c, 0x00}},  // 236: -
+    {1, 8, 0, 8, 0xff, 0, 8, {0x0c, 0x18, 0x00, 0x38, 0x18, 0x18, 0x3c, 0x00}},  // 237: -
+    {1, 8, 0, 8, 0xff, 0, 8, {0x18, 0x24, 0x00, 0x38, 0x18, 0x18, 0x3c, 0x00}},  // 238: -
+    {1, 8, 0, 8, 0xff, 0, 8, {0x00, 0x66, 0x00, 0x38, 0x18, 0x18, 0x3c, 0x00}},  // 239: -
+    {1, 8, 0, 8, 0xff, 0, 8, {0x76, 0x18, 0x6c, 0x1c, 0x66, 0x66, 0x3c, 0x00}},  // 240: -
+    {1, 8, 0, 8, 0xff, 0, 8, {0x32, 0x4c, 0x00, 0xdc, 0x66, 0x66, 0x66, 0x00}},  // 241: -
+    {1, 8, 0, 8, 0xff, 0, 8, {0x30, 0x18, 0x00, 0x3c, 0x66, 0x66, 0x3c, 0x00}},  // 242: -
+    {1, 8, 0, 8, 0xff, 0, 8, {0x0c, 0x18, 0x00, 0x3c, 0x66, 0x66, 0x3c, 0x00}},  // 243: -
+    {1, 8, 0, 8, 0xff, 0, 8, {0x18, 0x24, 0x00, 0x3c, 0x66, 0x66, 0x3c, 0x00}},  // 244: -
+    {1, 8, 0, 8, 0xff, 0, 8, {0x32, 0x4c, 0x00, 0x3c, 0x66, 0x66, 0x3c, 0x00}},  // 245: -
+    {1, 8, 0, 8, 0xff, 0, 8, {0x00, 0x66, 0x00, 0x3c, 0x66, 0x66, 0x3c, 0x00}},  // 246: -
+    {1, 8, 0, 8, 0xff, 0, 8, {0x18, 0x18, 0x00, 0x7e, 0x00, 0x18, 0x18, 0x00}},  // 247: -
+    {1, 8, 0, 8, 0xff, 0, 8, {0x00, 0x00, 0x03, 0x3c, 0x6e, 0x76, 0x3c, 0xc0}},  // 248: -
+    {1, 8, 0, 8, 0xff, 0, 8, {0x30, 0x18, 0x00, 0x66, 0x66, 0x66, 0x3e, 0x00}},  // 249: -
+    {1, 8, 0, 8, 0xff, 0, 8, {0x0c, 0x18, 0x00, 0x66, 0x66, 0x66, 0x3e, 0x00}},  // 250: -
+    {1, 8, 0, 8, 0xff, 0, 8, {0x18, 0x24, 0x00, 0x66, 0x66, 0x66, 0x3e, 0x00}},  // 251: -
+    {1, 8, 0, 8, 0xff, 0, 8, {0x00, 0x66, 0x00, 0x66, 0x66, 0x66, 0x3e, 0x00}},  // 252: -
+    {1, 8, 0, 8, 0xff, 0, 8, {0x0c, 0x18, 0x00, 0x66, 0x66, 0x3e, 0x06, 0x7c}},  // 253: -
+    {1, 8, 0, 8, 0xff, 0, 8, {0x00, 0x40, 0x78, 0x44, 0x44, 0x78, 0x40, 0x00}},  // 254: -
+    {1, 8, 0, 8, 0xff, 0, 8, {0x00, 0x66, 0x00, 0x66, 0x66, 0x3e, 0x06, 0x7c}},  // 255: -
+};
+
+const display_font_t display_font_amstrad = {
+    0, 255, 8, display_font_amstrad_glyphs};
@@ -12,7 +12,7 @@
 _Static_assert(DISPLAY_BUFFER_SIZE <= UINT32_MAX,
                "Buffer size exceeds allowed limits");
 
-static uint8_t qrcode_url[DISPLAY_QR_BUFFER_LEN_MAX] = {0};
+static display_qr_t qr_url = {0};
 static char current_ssid[128] = {0};
 static char current_url1[128] = {0};
 static char current_url2[128] = {0};
@@ -40,9 +40,9 @@ static void display_mngr_draw_centered_text(const char *text, uint8_t y) {
     return;
   }
 
-  u8g2_uint_t width = u8g2_GetStrWidth(display_get_u8g2_ref(), text);
-  u8g2_uint_t x = (width < DISPLAY_WIDTH) ? (DISPLAY_WIDTH - width) / 2 : 0;
-  u8g2_DrawStr(display_get_u8g2_ref(), x, y, text);
+  uint16_t width = display_text_width(&display_font_squeezed, text);
+  uint16_t x = (width < DISPLAY_WIDTH) ? (DISPLAY_WIDTH - width) / 2 : 0;
+  display_draw_text(&display_font_squeezed, x, y, text);
 }
 
 static void display_mngr_format_ssid_line(char *ssid_str, size_t ssid_str_size,
@@ -58,7 +58,8 @@ static void display_mngr_format_ssid_line(char *ssid_str, size_t ssid_str_size,
       snprintf(ssid_str, ssid_str_size, "SSID: %s%s", current_ssid, suffix);
     }
 
-    if (u8g2_GetStrWidth(display_get_u8g2_ref(), ssid_str) <= DISPLAY_WIDTH ||
+    if (display_text_width(&display_font_squeezed, ssid_str) <=
+            DISPLAY_WIDTH ||
         visible_ssid_len == 0) {
       return;
     }
@@ -80,7 +81,6 @@ static void display_mngr_draw_connection_info(uint8_t wifi_status) {
     }
   }
 
-  u8g2_SetFont(display_get_u8g2_ref(), u8g2_font_squeezed_b7_tr);
   display_mngr_format_ssid_line(ssid_str, sizeof(ssid_str), signal_suffix);
   display_mngr_draw_centered_text(ssid_str, DISPLAY_MNGR_CONNECTION_INFO_Y);
 }
@@ -91,7 +91,7 @@ static void draw_connection_scr(uint8_t wifi_status, const char *url1,
   u8g2_ClearBuffer(display_get_u8g2_ref());
 
   if (wifi_status != DISPLAY_MNGR_WIFI_STATUS_OFFLINE) {
-    display_draw_qr(qrcode_url, DISPLAY_WIDTH, DISPLAY_HEIGHT, 0, 0,
+    display_draw_qr(qr_url.code, DISPLAY_WIDTH, DISPLAY_HEIGHT, 0, 0,
                     DISPLAY_QR_BORDER, DISPLAY_MNGR_QR_SCALE);
   }
   display_mngr_clear_connection_info_line();
@@ -101,7 +101,6 @@ static void draw_connection_scr(uint8_t wifi_status, const char *url1,
   if (mac_str != NULL) {
     char mac_line[64] = {0};
     snprintf(mac_line, sizeof(mac_line), "MAC: %s", mac_str);
-    u8g2_SetFont(display_get_u8g2_ref(), u8g2_font_squeezed_b7_tr);
     display_mngr_draw_centered_text(mac_line, 8);
   }
 
@@ -114,26 +113,20 @@ static void draw_connection_scr(uint8_t wifi_status, const char *url1,
     char url_str[72] = {0};
     snprintf(url_str, sizeof(url_str), "%s or %s", url1 ? url1 : "",
              url2 ? url2 : "");
-    u8g2_SetFont(display_get_u8g2_ref(), u8g2_font_squeezed_b7_tr);
     display_mngr_draw_centered_text(url_str, 19);
   }
 
   if (wifi_status == DISPLAY_MNGR_WIFI_STATUS_OFFLINE) {
-    u8g2_SetFont(display_get_u8g2_ref(), u8g2_font_squeezed_b7_tr);
     display_mngr_draw_centered_text(DISPLAY_MNGR_SELECT_RESET_MESSAGE,
                                     DISPLAY_HEIGHT - 17);
   }
 
   display_draw_product_info();
-  u8g2_SetFont(display_get_u8g2_ref(), u8g2_font_squeezed_b7_tr);
   display_mngr_draw_centered_text(DISPLAY_MANAGER_BYPASS_MESSAGE,
                                   DISPLAY_HEIGHT - 9);
 }
 
 static void display_mngr_draw_status(uint8_t status, const char *details) {
-  // Use 8x8 font
-  u8g2_SetFont(display_get_u8g2_ref(), u8g2_font_amstrad_cpc_extended_8f);
-
   // Status
   char status_str[40] = {0};
   switch (status) {
@@ -168,9 +161,10 @@ static void display_mngr_draw_status(uint8_t status, const char *details) {
       break;
   }
 
-  u8g2_DrawStr(display_get_u8g2_ref(),
-               LEFT_PADDING_FOR_CENTER(status_str, DISPLAY_TILES_WIDTH) * 8,
-               DISPLAY_HEIGHT - 24, status_str);
+  // 8x8 font
+  display_draw_text(&display_font_amstrad,
+                    LEFT_PADDING_FOR_CENTER(status_str, DISPLAY_TILES_WIDTH) * 8,
+                    DISPLAY_HEIGHT - 24, status_str);
 }
 
 // Change the status in the buffer
@@ -245,7 +239,7 @@ void display_mngr_start(const char *ssid, const char *url1, const char *url2) {
   current_status_has_details = false;
   current_wifi_status = 0;
   current_status = 0;
-  display_create_qr(qrcode_url, url1);
+  display_create_qr(&qr_url, url1);
 
   // Set the flag to NOT-RESET the computer
   SEND_COMMAND_TO_DISPLAY(DISPLAY_COMMAND_NOP);
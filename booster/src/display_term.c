@@ -14,14 +14,47 @@ static uint8_t max_row = 0;
 // Static assert to ensure buffer size fits within uint32_t
 _Static_assert(DISPLAY_BUFFER_SIZE <= UINT32_MAX, "Buffer size exceeds allowed limits");
 
+// Address in the framebuffer of the first line of a char cell
+static inline uint8_t *display_term_cell(const uint8_t col, const uint8_t row) {
+    // The screen rows are a ring in the framebuffer, see display_scrollup()
+    uint8_t buffer_row = display_get_buffer_row(row);
+    return u8g2_GetBufferPtr(display_get_u8g2_ref()) + buffer_row * DISPLAY_ROW_BYTES + col;
+}
+
 // Draw graphics into the buffer
 void display_term_char(const uint8_t col, const uint8_t row, const char c) {
-    u8g2_DrawGlyph(display_get_u8g2_ref(), col * 8, (DISPLAY_TERM_FIRST_ROW_OFFSET + row) * 8, c);
+    display_term_chars(col, row, &c, 1);
+}
+
+// Draw a run of chars of the same row. The cells are overwritten, so there is
+// no need to erase them first.
+void display_term_chars(const uint8_t col, const uint8_t row, const char *chars, uint8_t len) {
+    if (col >= max_col) {
+        return;
+    }
+    if (len > max_col - col) {
+        len = max_col - col;
+    }
+    // The terminal font has the 256 encodings, and the lines of each glyph
+    // are a full 8x8 cell, with the baseline under the last line
+    const display_font_glyph_t *glyphs = display_font_amstrad.glyphs;
+    uint8_t *cell = display_term_cell(col, row);
+    for (int line = 0; line < DISPLAY_TERM_GLYPH_LINES; line++) {
+        uint8_t *dst = cell + line * DISPLAY_TERM_LINE_BYTES;
+        for (uint8_t i = 0; i < len; i++) {
+            dst[i] = glyphs[(uint8_t)chars[i]].lines[line];
+        }
+    }
+    display_mark_dirty_rows(row, 1);
 }
 
 // Draw a solid block at the cursor position
 void display_term_cursor(const uint8_t col, const uint8_t row) {
-    u8g2_DrawBox(display_get_u8g2_ref(), col * 8, row * 8, 8, 8);
+    uint8_t *cell = display_term_cell(col, row);
+    for (int line = 0; line < DISPLAY_TERM_GLYPH_LINES; line++) {
+        cell[line * DISPLAY_TERM_LINE_BYTES] = 0xFF;
+    }
+    display_mark_dirty_rows(row, 1);
 }
 
 // The main function should be as follows:
@@ -50,13 +83,14 @@ void display_term_start(const uint8_t num_col, const uint8_t num_row)
 
 void display_term_refresh()
 {
-    // Refresh the display
-    display_refresh();
+    // Publish only the rows drawn since the last refresh
+    display_refresh_dirty();
 }
 
 void display_term_clear()
 {
     // Clear the buffer
+    display_reset_scroll();
     u8g2_ClearBuffer(display_get_u8g2_ref());
-    u8g2_SetFont(display_get_u8g2_ref(), u8g2_font_amstrad_cpc_extended_8f);
+    display_mark_dirty_rows(0, DISPLAY_CHAR_ROWS);
 }
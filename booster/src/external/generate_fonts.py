@@ -0,0 +1,206 @@
+import re
+import argparse
+
+# Decodes the u8g2 fonts used by the status screens into glyph bitmaps, so
+# the firmware blits them with display_draw_text() instead of running the
+# u8g2 font decoder. See booster/src/include/display_fonts.h
+FONTS = [
+    # (u8g2 font, C name, first encoding, last encoding)
+    ("u8g2_font_squeezed_b7_tr", "display_font_squeezed", 32, 126),
+    ("u8g2_font_amstrad_cpc_extended_8f", "display_font_amstrad", 0, 255),
+]
+
+# Must match DISPLAY_FONT_LINES in display_fonts.h
+FONT_LINES = 8
+
+FONT_ARRAY_PATTERN = re.compile(
+    r"const uint8_t (\w+)\[\d+\][^=]*=\s*((?:\s*\"(?:[^\"\\]|\\.)*\")+)\s*;"
+)
+STRING_PATTERN = re.compile(r"\"((?:[^\"\\]|\\.)*)\"")
+ESCAPES = {"n": 10, "t": 9, "r": 13, "a": 7, "b": 8, "f": 12, "v": 11}
+
+
+def unescape(literal):
+    data = bytearray()
+    i = 0
+    while i < len(literal):
+        c = literal[i]
+        if c != "\\":
+            data.append(ord(c))
+            i += 1
+            continue
+        i += 1
+        c = literal[i]
+        if c in "01234567":
+            digits = re.match(r"[0-7]{1,3}", literal[i:]).group(0)
+            data.append(int(digits, 8))
+            i += len(digits)
+        elif c == "x":
+            digits = re.match(r"[0-9a-fA-F]+", literal[i + 1 :]).group(0)
+            data.append(int(digits, 16) & 0xFF)
+            i += 1 + len(digits)
+        else:
+            data.append(ESCAPES.get(c, ord(c)))
+            i += 1
+    return bytes(data)
+
+
+def read_fonts(source_path):
+    with open(source_path, "r") as f:
+        source = f.read()
+    fonts = {}
+    for match in FONT_ARRAY_PATTERN.finditer(source):
+        literals = STRING_PATTERN.findall(match.group(2))
+        fonts[match.group(1)] = unescape("".join(literals))
+    return fonts
+
+
+class BitReader:
+    def __init__(self, data, pos):
+        self.data = data
+        self.pos = pos
+        self.bit = 0
+
+    def unsigned(self, cnt):
+        val = self.data[self.pos] >> self.bit
+        end = self.bit + cnt
+        if end >= 8:
+            self.pos += 1
+            val |= self.data[self.pos] << (8 - self.bit)
+            end -= 8
+        self.bit = end
+        return val & ((1 << cnt) - 1)
+
+    def signed(self, cnt):
+        return self.unsigned(cnt) - (1 << (cnt - 1))
+
+
+def font_info(font):
+    return {
+        "bits_per_0": font[2],
+        "bits_per_1": font[3],
+        "bits_per_char_width": font[4],
+        "bits_per_char_height": font[5],
+        "bits_per_char_x": font[6],
+        "bits_per_char_y": font[7],
+        "bits_per_delta_x": font[8],
+        "y_offset": font[12] - 256 if font[12] > 127 else font[12],
+    }
+
+
+def glyph_data(font, encoding):
+    # Same walk as u8g2_font_get_glyph_data(), without the a/A shortcuts
+    pos = 23
+    while font[pos + 1] != 0:
+        if font[pos] == encoding:
+            return pos + 2
+        pos += font[pos + 1]
+    return None
+
+
+def decode_glyph(info, font, pos):
+    reader = BitReader(font, pos)
+    width = reader.unsigned(info["bits_per_char_width"])
+    height = reader.unsigned(info["bits_per_char_height"])
+    x = reader.signed(info["bits_per_char_x"])
+    y = reader.signed(info["bits_per_char_y"])
+    advance = reader.signed(info["bits_per_delta_x"])
+    pixels = []
+    if width > 0:
+        while len(pixels) < width * height:
+            zeros = reader.unsigned(info["bits_per_0"])
+            ones = reader.unsigned(info["bits_per_1"])
+            while True:
+                pixels += [0] * zeros + [1] * ones
+                if reader.unsigned(1) == 0:
+                    break
+    rows = [pixels[r * width : (r + 1) * width] for r in range(height)]
+    return width, height, x, y, advance, rows
+
+
+def convert_font(font, first, last):
+    info = font_info(font)
+    # The cell ends at the lowest line of the font below the baseline
+    ascent = FONT_LINES + info["y_offset"]
+    glyphs = []
+    for encoding in range(first, last + 1):
+        pos = glyph_data(font, encoding)
+        if pos is None:
+            glyphs.append(None)
+            continue
+        width, height, x, y, advance, rows = decode_glyph(info, font, pos)
+        top = ascent - (height + y)
+        if width > 0 and (x < 0 or x + width > 8):
+            raise ValueError(f"glyph {encoding} is wider than a byte")
+        if width > 0 and (top < 0 or top + height > FONT_LINES):
+            raise ValueError(f"glyph {encoding} does not fit the cell")
+        lines = [0] * FONT_LINES
+        for r, row in enumerate(rows):
+            for c, pixel in enumerate(row):
+                if pixel:
+                    lines[top + r] |= 0x80 >> (x + c)
+        mask = ((0xFF << (8 - width)) & 0xFF) >> x if width > 0 else 0
+        glyphs.append(
+            {
+                "advance": advance,
+                "x_offset": x,
+                "width": width,
+                "mask": mask,
+                "top": top if width > 0 else 0,
+                "height": height if width > 0 else 0,
+                "lines": lines,
+            }
+        )
+    return ascent, glyphs
+
+
+def emit_font(out, u8g2_name, name, first, last, ascent, glyphs):
+    out.append(f"// {u8g2_name}, encodings {first} to {last}")
+    out.append(f"static const display_font_glyph_t {name}_glyphs[] = {{")
+    for encoding, glyph in zip(range(first, last + 1), glyphs):
+        if glyph is None:
+            out.append(f"    {{0, 0, 0, 0, 0, 0, 0, {{0}}}},  // {encoding}: none")
+            continue
+        lines = ", ".join(f"0x{line:02x}" for line in glyph["lines"])
+        label = chr(encoding) if 32 < encoding < 127 else "-"
+        if encoding == 32:
+            label = "space"
+        if label == "\\":
+            label = "backslash"
+        out.append(
+            f"    {{1, {glyph['advance']}, {glyph['x_offset']}, "
+            f"{glyph['width']}, 0x{glyph['mask']:02x}, {glyph['top']}, "
+            f"{glyph['height']}, {{{lines}}}}},  // {encoding}: {label}"
+        )
+    out.append("};")
+    out.append("")
+    out.append(f"const display_font_t {name} = {{")
+    out.append(f"    {first}, {last}, {ascent}, {name}_glyphs}};")
+    out.append("")
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description="Pre-decode the u8g2 fonts of the status screens."
+    )
+    parser.add_argument("fonts_path", type=str, help="u8g2 custom_fonts.c")
+    parser.add_argument("output_path", type=str, help="Generated C file")
+    args = parser.parse_args()
+
+    fonts = read_fonts(args.fonts_path)
+    out = [
+        "// Generated by external/generate_fonts.py from u8g2/custom_fonts.c.",
+        "// Do not edit.",
+        "",
+        '#include "display_fonts.h"',
+        "",
+    ]
+    for u8g2_name, name, first, last in FONTS:
+        ascent, glyphs = convert_font(fonts[u8g2_name], first, last)
+        emit_font(out, u8g2_name, name, first, last, ascent, glyphs)
+    with open(args.output_path, "w") as f:
+        f.write("\n".join(out))
+
+
+if __name__ == "__main__":
+    main()
@@ -113,6 +113,9 @@ sub minify_text_file {
     if ($path =~ /\.css\z/i) {
         return minify_css($content);
     }
+    if ($path =~ /\.js\z/i) {
+        return minify_script($content);
+    }
 
     return $content;
 }
@@ -160,7 +163,7 @@ for my $source_file (@source_files) {
     $input_bytes += $input_size;
     ++$processed_files;
 
-    if ($source_file =~ /\.(?:shtml|html|inc|css)\z/i) {
+    if ($source_file =~ /\.(?:shtml|html|inc|css|js)\z/i) {
         my $minified = minify_text_file($source_file, read_file($source_file));
         write_file($dest_file, $minified);
     } else {
@@ -95,10 +95,14 @@ int fabric_init() {
       "bytes\n",
       (unsigned int)&_config_flash_start, total_config_flash_length);
   // Erase the configuration and lookup tables previously used
+  uint32_t erase_us = time_us_32();
   uint32_t ints = save_and_disable_interrupts();
   flash_range_erase((unsigned int)&_config_flash_start - XIP_BASE,
                     total_config_flash_length);
   restore_interrupts(ints);
+  metrics_inc(METRICS_FLASH_ERASES);
+  metrics_observe(METRICS_HISTOGRAM_FLASH_ERASE_MS,
+                  (time_us_32() - erase_us) / 1000);
   DPRINTF("Configuration and lookup tables erased\n");
 
   // First, check if there is a Wifi configuration file in the microSD card.
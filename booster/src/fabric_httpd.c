@@ -9,7 +9,7 @@
 #include "fabric_httpd.h"
 
 #define WIFI_PASS_BUFSIZE 64
-static char *ssid = NULL;
+static char ssid[MAX_SSID_LENGTH] = {0};
 static char pass[WIFI_PASS_BUFSIZE];
 static int auth = -1;
 static void *current_connection;
@@ -81,16 +81,47 @@ const char *cgi_test(int iIndex, int iNumParams, char *pcParam[],
   return "/test.shtml";
 }
 
+// The networks are linked by BSSID, 12 hex digits: the scan ages and compacts
+// the table between the page and the click, so the row index can change.
+static bool fabric_httpd_parse_bssid(const char *text,
+                                     uint8_t bssid[NETWORK_MAC_SIZE]) {
+  if (strlen(text) != NETWORK_MAC_SIZE * 2) {
+    return false;
+  }
+  for (int i = 0; i < NETWORK_MAC_SIZE * 2; i++) {
+    if (!isxdigit((unsigned char)text[i])) {
+      return false;
+    }
+  }
+  for (int i = 0; i < NETWORK_MAC_SIZE; i++) {
+    char byte[3] = {text[i * 2], text[i * 2 + 1], '\0'};
+    bssid[i] = (uint8_t)strtoul(byte, NULL, 16);
+  }
+  return true;
+}
+
 static const char *cgi_network_select(int iIndex, int iNumParams,
                                       char *pcParam[], char *pcValue[]) {
   DPRINTF("cgi_network_select called with index %d\n", iIndex);
   for (size_t i = 0; i < iNumParams; i++) {
-    /* check if parameter is "id" */
-    if (strcmp(pcParam[i], "id") == 0) {
+    /* check if parameter is "bssid" */
+    if (strcmp(pcParam[i], "bssid") == 0) {
       DPRINTF("Network selected: %s\n", pcValue[i]);
+      ssid[0] = '\0';
+      auth = -1;
+      uint8_t bssid[NETWORK_MAC_SIZE];
       wifi_scan_data_t *wifi_nets = network_getFoundNetworks();
-      ssid = wifi_nets->networks[atoi(pcValue[i])].ssid;
-      auth = wifi_nets->networks[atoi(pcValue[i])].auth_mode;
+      if (wifi_nets == NULL || !fabric_httpd_parse_bssid(pcValue[i], bssid)) {
+        continue;
+      }
+      for (uint16_t n = 0; n < wifi_nets->count && n < MAX_NETWORKS; n++) {
+        if (memcmp(wifi_nets->networks[n].bssid, bssid, NETWORK_MAC_SIZE) ==
+            0) {
+          snprintf(ssid, sizeof(ssid), "%s", wifi_nets->networks[n].ssid);
+          auth = wifi_nets->networks[n].auth_mode;
+          break;
+        }
+      }
       DPRINTF("Network name: %s. Auth: %i\n", ssid, auth);
     }
   }
@@ -193,29 +224,32 @@ u16_t ssi_handler(int iIndex, char *pcInsert, int iInsertLen
       // ...
       wifi_scan_data_t *wifi_nets = network_getFoundNetworks();
       DPRINTF("Current tag part: %d\n", current_tag_part);
-      if ((wifi_nets != NULL) && (wifi_nets->count > 0)) {
+      // The table can shrink between two parts of the tag
+      if ((wifi_nets != NULL) && (current_tag_part < wifi_nets->count)) {
         // Concatenate the network information in a single string
+        const wifi_network_info_t *net = &wifi_nets->networks[current_tag_part];
         char buffer[256];
-        snprintf(buffer, 256, "%s (%d dBm)\n",
-                 wifi_nets->networks[current_tag_part].ssid,
-                 wifi_nets->networks[current_tag_part].rssi);
-        printed = snprintf(
-            pcInsert, iInsertLen,
-            "<div><a href='/cgi_network_select.cgi?id=%d'>%s</a></div>\n",
-            current_tag_part, buffer);
+        snprintf(buffer, 256, "%s (%d dBm)\n", net->ssid, net->rssi);
+        printed = snprintf(pcInsert, iInsertLen,
+                           "<div><a href='/cgi_network_select.cgi?bssid="
+                           "%02x%02x%02x%02x%02x%02x'>%s</a></div>\n",
+                           net->bssid[0], net->bssid[1], net->bssid[2],
+                           net->bssid[3], net->bssid[4], net->bssid[5], buffer);
         DPRINTF("Printed: %d\n", printed);
 
         if (current_tag_part < (wifi_nets->count - 1)) {
           *next_tag_part = current_tag_part + 1;
         }
-      } else {
+      } else if (current_tag_part == 0) {
         printed = snprintf(pcInsert, iInsertLen, "NO NETWORKS FOUND");
+      } else {
+        printed = 0;
       }
       break;
     }
     case 2: /* WIFISSID */
     {
-      if (ssid != NULL) {
+      if (ssid[0] != '\0') {
         printed = snprintf(pcInsert, iInsertLen, "%s", ssid);
       } else {
         printed = snprintf(pcInsert, iInsertLen, "No network selected");
@@ -270,6 +304,10 @@ err_t httpd_post_begin(void *connection, const char *uri,
   LWIP_UNUSED_ARG(content_len);
   LWIP_UNUSED_ARG(post_auto_wnd);
   DPRINTF("POST request for URI: %s\n", uri);
+  if (bench_post_begin(connection, uri, response_uri, response_uri_len)) {
+    *post_auto_wnd = 1;
+    return ERR_OK;
+  }
   if (!memcmp(uri, "/ap_pass.cgi", 11)) {
     DPRINTF("POST request for ap_pass.cgi\n");
     if (current_connection != connection) {
@@ -288,6 +326,9 @@ err_t httpd_post_begin(void *connection, const char *uri,
 }
 
 err_t httpd_post_receive_data(void *connection, struct pbuf *p) {
+  if (bench_post_receive(connection, p)) {
+    return ERR_OK;
+  }
   if (current_connection == connection) {
     DPRINTF("POST data received\n");
     u16_t token_pass = pbuf_memfind(p, "pass=", 5, 0);
@@ -325,6 +366,9 @@ err_t httpd_post_receive_data(void *connection, struct pbuf *p) {
 
 void httpd_post_finished(void *connection, char *response_uri,
                          u16_t response_uri_len) {
+  if (bench_post_finished(connection, response_uri, response_uri_len)) {
+    return;
+  }
   snprintf(response_uri, response_uri_len, "/ap_step2.shtml");
   if (current_connection == connection) {
     if (valid_connection == connection) {
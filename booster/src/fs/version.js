@@ -0,0 +1,30 @@
+// Update banner of the manager pages. The page is served with the last known
+// result of the version check, and the banner polls /version.shtml while a
+// check is still pending.
+function versionBanner(v) {
+  return {
+    show: true,
+    v: v,
+    requestInFlight: false,
+
+    init() {
+      if (this.v.checking) setTimeout(() => this.poll(), 3000);
+    },
+
+    poll() {
+      if (this.requestInFlight) return;
+      this.requestInFlight = true;
+      fetch("/version.shtml")
+        .then((response) => response.json())
+        .then((result) => {
+          this.v = result;
+        })
+        .catch(() => {})
+        .finally(() => {
+          // Also after a failed request, or the banner would never poll again
+          this.requestInFlight = false;
+          if (this.v.checking) setTimeout(() => this.poll(), 3000);
+        });
+    },
+  };
+}
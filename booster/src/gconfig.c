@@ -6,13 +6,17 @@ static SettingsConfigEntry defaultEntries[] = {
      "http://atarist.sidecartridge.com/apps.json"},
     {PARAM_BOOT_FEATURE, SETTINGS_TYPE_STRING, "FABRIC"},
     {PARAM_HOSTNAME, SETTINGS_TYPE_STRING, "sidecart"},
+    {PARAM_MIRROR_HOSTS, SETTINGS_TYPE_STRING, ""},
     {PARAM_SAFE_CONFIG_REBOOT, SETTINGS_TYPE_BOOL, "true"},
     {PARAM_SD_BAUD_RATE_KB, SETTINGS_TYPE_INT, "12500"},
+    {PARAM_VERSION_CACHE, SETTINGS_TYPE_STRING, ""},
+    {PARAM_VERSION_CACHE_TTL, SETTINGS_TYPE_INT, "0"},
     {PARAM_WIFI_AUTH, SETTINGS_TYPE_INT, "0"},
     {PARAM_WIFI_CONNECT_TIMEOUT, SETTINGS_TYPE_INT, "30"},
     {PARAM_WIFI_COUNTRY, SETTINGS_TYPE_STRING, "XX"},
     {PARAM_WIFI_DHCP, SETTINGS_TYPE_BOOL, "true"},
     {PARAM_WIFI_DNS, SETTINGS_TYPE_STRING, "8.8.8.8"},
+    {PARAM_WIFI_FAST_CONNECT, SETTINGS_TYPE_STRING, ""},
     {PARAM_WIFI_GATEWAY, SETTINGS_TYPE_STRING, ""},
     {PARAM_WIFI_IP, SETTINGS_TYPE_STRING, ""},
     {PARAM_WIFI_MODE, SETTINGS_TYPE_INT, "0"},
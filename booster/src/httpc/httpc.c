@@ -6,6 +6,66 @@
 
 #include "httpc.h"
 
+#if BOOSTER_DOWNLOAD_HTTPS == 1
+// TLS sessions of the last hosts, to resume the handshake instead of running
+// the full key exchange again. Only touched from the lwIP context.
+typedef struct {
+  char host[HTTPC_TLS_SESSION_HOST_SIZE];
+  struct altcp_tls_session *session;
+  uint32_t last_used;
+} httpc_tls_session_entry_t;
+
+static struct altcp_tls_config *tls_config = NULL;
+static httpc_tls_session_entry_t tls_sessions[HTTPC_TLS_SESSION_CACHE_SIZE];
+static uint32_t tls_sessions_clock = 0;
+
+struct altcp_tls_config *http_client_tls_config(void) {
+  if (tls_config == NULL) {
+    tls_config = altcp_tls_create_config_client(NULL, 0);
+  }
+  return tls_config;
+}
+
+// Find the entry of a host. If it is not cached, return the least recently
+// used entry when evict is set, NULL otherwise.
+static httpc_tls_session_entry_t *tls_session_find(const char *host,
+                                                   bool evict) {
+  httpc_tls_session_entry_t *oldest = &tls_sessions[0];
+  for (int i = 0; i < HTTPC_TLS_SESSION_CACHE_SIZE; i++) {
+    if (tls_sessions[i].session != NULL &&
+        strcmp(tls_sessions[i].host, host) == 0) {
+      return &tls_sessions[i];
+    }
+    if (tls_sessions[i].last_used < oldest->last_used) {
+      oldest = &tls_sessions[i];
+    }
+  }
+  return evict ? oldest : NULL;
+}
+
+static void tls_session_save(HTTPC_REQUEST_T *req, struct altcp_pcb *conn) {
+  if (strlen(req->hostname) >= HTTPC_TLS_SESSION_HOST_SIZE) {
+    return;
+  }
+  httpc_tls_session_entry_t *entry = tls_session_find(req->hostname, true);
+  // A session can only be read into a fresh structure
+  if (entry->session != NULL) {
+    altcp_tls_free_session(entry->session);
+  }
+  entry->session = altcp_tls_init_session();
+  if (entry->session == NULL) {
+    return;
+  }
+  if (altcp_tls_get_session(conn, entry->session) != ERR_OK) {
+    altcp_tls_free_session(entry->session);
+    entry->session = NULL;
+    return;
+  }
+  snprintf(entry->host, sizeof(entry->host), "%s", req->hostname);
+  entry->last_used = ++tls_sessions_clock;
+}
+#endif
+
 // Print headers to stdout
 err_t http_client_header_print_fn(__unused httpc_state_t *connection,
                                   __unused void *arg, struct pbuf *hdr,
@@ -39,6 +99,17 @@ static err_t internal_header_fn(httpc_state_t *connection, void *arg,
   HTTPC_REQUEST_T *req = (HTTPC_REQUEST_T *)arg;
   HTTP_DEBUG("header %p pbuf %p len %u content_len %u\n", arg, hdr, hdr_len,
              content_len);
+  // Connection, handshake and server time until the response headers
+  const char *handshake = "";
+#if BOOSTER_DOWNLOAD_HTTPS == 1
+  if (req->tls_config) {
+    handshake = req->tls_session_offered ? " (TLS session offered)"
+                                         : " (TLS full handshake)";
+  }
+#endif
+  DPRINTF("Headers from %s after %lu ms%s\n", req->hostname,
+          (unsigned long)((time_us_32() - req->start_us) / 1000), handshake);
+  (void)handshake;  // Unused in release builds
   if (req->headers_fn) {
     return req->headers_fn(connection, req->callback_arg, hdr, hdr_len,
                            content_len);
@@ -50,6 +121,13 @@ static err_t internal_recv_fn(void *arg, struct altcp_pcb *conn, struct pbuf *p,
                               err_t err) {
   assert(arg);
   HTTPC_REQUEST_T *req = (HTTPC_REQUEST_T *)arg;
+#if BOOSTER_DOWNLOAD_HTTPS == 1
+  // The handshake is complete once the body arrives
+  if (req->tls_config && !req->tls_session_saved && p != NULL) {
+    req->tls_session_saved = true;
+    tls_session_save(req, conn);
+  }
+#endif
   if (req->recv_fn) {
     return req->recv_fn(req->callback_arg, conn, p, err);
   }
@@ -78,9 +156,17 @@ static struct altcp_pcb *altcp_tls_alloc_sni(void *arg, u8_t ip_type) {
   struct altcp_pcb *pcb = altcp_tls_alloc(req->tls_config, ip_type);
   if (!pcb) {
     HTTP_ERROR("Failed to allocate PCB\n");
-    sie return NULL;
+    return NULL;
   }
   mbedtls_ssl_set_hostname(altcp_tls_context(pcb), req->hostname);
+  // Offer the last session of the host. The server falls back to the full
+  // handshake if it does not remember it anymore.
+  httpc_tls_session_entry_t *entry = tls_session_find(req->hostname, false);
+  req->tls_session_offered =
+      (entry != NULL) && (altcp_tls_set_session(pcb, entry->session) == ERR_OK);
+  if (req->tls_session_offered) {
+    entry->last_used = ++tls_sessions_clock;
+  }
   return pcb;
 }
 #endif
@@ -107,7 +193,14 @@ int http_client_request_async(async_context_t *context, HTTPC_REQUEST_T *req) {
 #endif
 
   req->complete = false;
-  req->headers_fn = http_client_header_print_fn;
+  req->start_us = time_us_32();
+#if BOOSTER_DOWNLOAD_HTTPS == 1
+  req->tls_session_offered = false;
+  req->tls_session_saved = false;
+#endif
+  if (!req->headers_fn) {
+    req->headers_fn = http_client_header_print_fn;
+  }
   req->settings.headers_done_fn = req->headers_fn ? internal_header_fn : NULL;
   req->settings.result_fn = internal_result_fn;
   async_context_acquire_lock_blocking(context);
@@ -54,6 +54,10 @@
  
  #define PICOHTTPS_MBEDTLS_DEBUG_LEVEL               4
 
+ // Hosts whose TLS session is kept to resume the handshake of the next request
+ #define HTTPC_TLS_SESSION_CACHE_SIZE 2
+ #define HTTPC_TLS_SESSION_HOST_SIZE 64
+
  #define PICOHTTPS_CA_ROOT_CERT                          \
 {                                                       \
     0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07,     \
@@ -105,7 +109,19 @@
       * TLS allocator, used internall for setting TLS server name indication
       */
      altcp_allocator_t tls_allocator;
+     /*!
+      * Set when a cached TLS session of the host was offered to the server
+      */
+     bool tls_session_offered;
+     /*!
+      * Set when the TLS session has been saved in the cache for the next request
+      */
+     bool tls_session_saved;
  #endif
+     /*!
+      * Time the request was started, to measure the connection setup
+      */
+     uint32_t start_us;
      /*!
       * LwIP HTTP client settings
       */
@@ -123,6 +139,18 @@
  
  struct async_context;
  
+ #if BOOSTER_DOWNLOAD_HTTPS == 1
+ /*! \brief Get the TLS configuration shared by all the client requests
+  *
+  * Created on the first call and never freed: building a configuration seeds
+  * the random generator, which is too slow to repeat for every request. The
+  * requests must not free it.
+  *
+  * @return The shared configuration, or NULL if there is no memory
+  */
+ struct altcp_tls_config *http_client_tls_config(void);
+ #endif
+
  /*! \brief Perform a http request asynchronously
   *  \ingroup pico_lwip
   *
@@ -19,16 +19,20 @@
 #include "debug.h"
 #include "gconfig.h"
 #include "httpc/httpc.h"
+#include "jsontok.h"
 #include "lwip/altcp_tls.h"
 #include "lwip/apps/httpd.h"
 #include "md5/md5.h"
 #include "memfunc.h"
+#include "metrics.h"
+#include "mirror.h"
 #include "network.h"
 #include "pico/async_context.h"
 #include "pico/multicore.h"
 #include "pico/stdlib.h"
 #include "reset.h"
 #include "sdcard.h"
+#include "trace.h"
 
 // Macro for maximum allowed size
 #define MAXIMUM_APP_UF2_SIZE 1048576  // Example: 1 MB
@@ -46,6 +50,7 @@
 #define APPMNGR_MAX_INSTALLED_APPS (FLASH_SECTOR_SIZE / LOOKUP_ENTRY_SIZE)
 #define APPMNGR_INSTALLED_APP_NAME_LENGTH 64
 #define APPMNGR_INSTALLED_APP_VERSION_LENGTH 16
+#define APPMNGR_JSON_MAX_TOKENS 128  // Tokens of the largest app JSON
 
 typedef struct {
   char protocol[16];
@@ -202,4 +207,11 @@ void appmngr_deinit();
 // app UUID exists in the lookup table; missing entries are added.
 void appmngr_sync_lookup_table();
 
+// First half of appmngr_sync_lookup_table: loads the lookup table into table
+// (FLASH_SECTOR_SIZE bytes) and adds the missing apps in RAM only. Touches the
+// SD card but never writes to flash, so it can run on core 1. Returns true if
+// the table changed and must be saved with appmngr_save_lookup_table.
+bool appmngr_scan_lookup_table(uint8_t *table, uint16_t *table_len);
+int8_t appmngr_save_lookup_table(const uint8_t *table, uint16_t table_len);
+
 #endif  // APPMNGR_H
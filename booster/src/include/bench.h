@@ -0,0 +1,89 @@
+/**
+ * File: bench.h
+ * Author: Diego Parrilla Santamaría
+ * Date: October 2026
+ * Copyright: 2026 - GOODDATA LABS SL
+ * Description: Header file for the network throughput benchmarks
+ */
+
+#ifndef BENCH_H
+#define BENCH_H
+
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "debug.h"
+#include "lwip/apps/fs.h"
+#include "lwip/apps/httpd.h"
+#include "lwip/stats.h"
+#include "metrics.h"
+#include "pico/stdlib.h"
+#include "sdcard.h"
+#include "trace.h"
+
+#define BENCH_DOWNLOAD_URI "/bench/download"
+#define BENCH_UPLOAD_URI "/bench/upload"
+#define BENCH_RESULT_URI "/bench/result"
+#define BENCH_SD_FILENAME "/bench.tmp"  // Sink of the SD card upload mode
+
+#define BENCH_DEFAULT_BYTES (1024 * 1024)
+#define BENCH_MAX_BYTES (64 * 1024 * 1024)
+
+typedef enum {
+  BENCH_MODE_NONE,
+  BENCH_MODE_DOWNLOAD,   // Generated data streamed from RAM
+  BENCH_MODE_UPLOAD,     // Received data discarded
+  BENCH_MODE_UPLOAD_SD,  // Received data written to the SD card
+} bench_mode_t;
+
+typedef struct {
+  bench_mode_t mode;
+  bool running;
+  uint32_t bytes;
+  uint32_t elapsed_us;
+  int32_t retransmits;       // TCP segments retransmitted, -1 if no stats
+  int32_t pbuf_pool_errors;  // Failed pbuf pool allocations, -1 if no stats
+  uint32_t sd_errors;        // Failed SD card writes
+} bench_result_t;
+
+/**
+ * @brief CGI handler of BENCH_DOWNLOAD_URI.
+ *
+ * Reads the size of the download from the bytes=N parameter and serves the
+ * generated file. The data never touches the SD card or the flash, so the
+ * result only depends on the WiFi link and the lwIP tuning.
+ */
+const char *bench_cgi_download(int iIndex, int iNumParams, char *pcParam[],
+                               char *pcValue[]);
+
+/**
+ * @brief Start an upload benchmark if the POST is for BENCH_UPLOAD_URI.
+ *
+ * With sd=1 in the query string the received bytes are also written to
+ * BENCH_SD_FILENAME, to tell the SD card write speed from the network speed.
+ *
+ * @return true if the POST belongs to the benchmark.
+ */
+bool bench_post_begin(void *connection, const char *uri, char *response_uri,
+                      u16_t response_uri_len);
+
+/**
+ * @brief Consume the data of an upload benchmark. Frees the pbuf.
+ *
+ * @return true if the connection belongs to the benchmark.
+ */
+bool bench_post_receive(void *connection, struct pbuf *p);
+
+/**
+ * @brief Finish an upload benchmark and answer with BENCH_RESULT_URI.
+ *
+ * @return true if the connection belongs to the benchmark.
+ */
+bool bench_post_finished(void *connection, char *response_uri,
+                         u16_t response_uri_len);
+
+const bench_result_t *bench_get_result(void);
+
+#endif  // BENCH_H
@@ -0,0 +1,96 @@
+/**
+ * File: bootprof.h
+ * Author: Diego Parrilla Santamaría
+ * Date: October 2026
+ * Copyright: 2026 - GOODDATA LABS SL
+ * Description: Header file for the boot phases timing profiler
+ */
+
+#ifndef BOOTPROF_H
+#define BOOTPROF_H
+
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stdio.h>
+
+#include "debug.h"
+#include "pico/stdlib.h"
+
+// Boot phases, in the order they run. Each mark records the end of a phase.
+// Keep the names in bootprof.c in sync: they identify the phases across
+// builds.
+typedef enum {
+  BOOTPROF_PHASE_MAIN,           // Runtime init until main() is entered
+  BOOTPROF_PHASE_GCONFIG,        // Global configuration loaded
+  BOOTPROF_PHASE_FIRMWARE_COPY,  // Terminal firmware copied to RAM
+  BOOTPROF_PHASE_TERM_INIT,      // Terminal emulator initialized
+  BOOTPROF_PHASE_ROMEMUL_INIT,   // ROM emulator started
+  BOOTPROF_PHASE_BOOT_FEATURE,   // Boot feature saved
+  BOOTPROF_PHASE_APPMNGR_INIT,   // App manager initialized
+  BOOTPROF_PHASE_WIFI_INIT,      // WiFi initialized in STA mode
+  BOOTPROF_PHASE_SDCARD_MOUNT,   // SD card mounted and inspected (core 1)
+  BOOTPROF_PHASE_LOOKUP_SYNC,    // Apps lookup table scanned (core 1)
+  BOOTPROF_PHASE_WIFI_CONNECT,   // Associated, with all the retries
+  BOOTPROF_PHASE_VERSION_CHECK,  // Latest version checked (background)
+  BOOTPROF_PHASE_SDCARD_WAIT,    // Waiting for core 1, lookup table saved
+  BOOTPROF_PHASE_CATALOG_LOAD,   // Cached catalog loaded
+  BOOTPROF_PHASE_HTTPD_START,    // HTTP server started
+  BOOTPROF_PHASE_READY,          // Manager main loop entered
+  BOOTPROF_PHASE_COUNT
+} bootprof_phase_t;
+
+/**
+ * @brief Record the start of a boot phase.
+ *
+ * Only needed for phases that do not start where the previous one ends, like
+ * the ones running on core 1 in parallel with the WiFi association.
+ *
+ * @param phase The phase that is about to start.
+ */
+void bootprof_begin(bootprof_phase_t phase);
+
+/**
+ * @brief Record the end of a boot phase.
+ *
+ * Stores the raw timer value, in microseconds since power-on, in a RAM array.
+ * Cheap enough to be called anywhere in the boot sequence. Phases never
+ * marked are reported as skipped.
+ *
+ * @param phase The phase that has just finished.
+ */
+void bootprof_mark(bootprof_phase_t phase);
+
+/**
+ * @brief Get the time a phase finished, in microseconds since power-on.
+ *
+ * @return uint32_t The timestamp, or 0 if the phase was skipped.
+ */
+uint32_t bootprof_get_end_us(bootprof_phase_t phase);
+
+/**
+ * @brief Get the duration of a phase.
+ *
+ * Measured from bootprof_begin() if it was called for the phase. Otherwise
+ * from the end of the last phase marked before it, so skipped phases do not
+ * distort the phases around them.
+ *
+ * @return uint32_t The duration in microseconds, or 0 if skipped.
+ */
+uint32_t bootprof_get_duration_us(bootprof_phase_t phase);
+
+/**
+ * @brief Get the stable name of a phase, used in the JSON output.
+ */
+const char *bootprof_get_name(bootprof_phase_t phase);
+
+/**
+ * @brief Get the time from power-on to the last phase marked.
+ */
+uint32_t bootprof_get_total_us(void);
+
+/**
+ * @brief Print the boot timeline to the debug output.
+ */
+void bootprof_print(void);
+
+#endif  // BOOTPROF_H
@@ -0,0 +1,187 @@
+/**
+ * File: catalog.h
+ * Author: Diego Parrilla Santamaría
+ * Date: October 2026
+ * Copyright: 2026 - GOODDATA LABS SL
+ * Description: Header file for the device-side apps catalog cache
+ */
+
+#ifndef CATALOG_H
+#define CATALOG_H
+
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "appmngr.h"
+#include "cjson/cJSON.h"
+#include "constants.h"
+#include "debug.h"
+#include "gconfig.h"
+#include "httpc/httpc.h"
+#include "jsonarena.h"
+#include "lwip/altcp_tls.h"
+#include "network.h"
+#include "pico/async_context.h"
+#include "pico/stdlib.h"
+
+// Files in the apps folder. "apps.json" is already skipped by the installed
+// apps scanners, so the raw catalog can live next to the UUID.json files.
+#define CATALOG_RAW_FILENAME "apps.json"
+#define CATALOG_TMP_FILENAME "apps.tmp"
+#define CATALOG_INDEX_FILENAME "apps.idx"
+
+#define CATALOG_INDEX_MAGIC 0x58444943  // "CIDX"
+#define CATALOG_INDEX_VERSION 2
+
+// Sizing of the compact index
+#define CATALOG_MAX_APPS 48
+#define CATALOG_MAX_TAGS 32
+#define CATALOG_MAX_DEVICES 16
+#define CATALOG_LABEL_LENGTH 24
+#define CATALOG_ETAG_LENGTH 64
+#define CATALOG_LAST_MODIFIED_LENGTH 40
+#define CATALOG_MAX_JSON_SIZE 32768  // Largest raw catalog accepted
+
+// Background refresh scheduling
+#define CATALOG_FIRST_FETCH_DELAY_MS (5 * 1000)
+#define CATALOG_REFRESH_INTERVAL_MS (15 * 60 * 1000)
+#define CATALOG_RETRY_INTERVAL_MS (60 * 1000)
+#define CATALOG_FETCH_TIMEOUT_MS (20 * 1000)
+
+typedef enum {
+  CATALOG_STATUS_EMPTY,        // No usable cache on the SD card
+  CATALOG_STATUS_READY,        // Index loaded and matches the catalog URL
+  CATALOG_STATUS_FETCHING,     // Conditional GET in progress
+  CATALOG_STATUS_DOWNLOADED,   // Body received, index pending rebuild
+  CATALOG_STATUS_NOT_MODIFIED  // Server answered 304, cache still valid
+} catalog_status_t;
+
+typedef enum {
+  CATALOG_SOURCE_NONE,
+  CATALOG_SOURCE_WARM,  // Index loaded from the SD card
+  CATALOG_SOURCE_COLD   // Index rebuilt from a fresh download
+} catalog_source_t;
+
+// On-disk header of the compact index. Followed by app_count entries and the
+// unformatted JSON object of each app, addressed by the entry offsets.
+typedef struct {
+  uint32_t magic;
+  uint16_t version;
+  uint16_t app_count;
+  uint8_t tag_count;
+  uint8_t device_count;
+  uint16_t total_count;  // Apps in the raw catalog, cached or not
+  uint32_t url_hash;
+  uint32_t blob_offset;
+  uint32_t blob_size;
+  char etag[CATALOG_ETAG_LENGTH];
+  char last_modified[CATALOG_LAST_MODIFIED_LENGTH];
+  char tags[CATALOG_MAX_TAGS][CATALOG_LABEL_LENGTH];
+  char devices[CATALOG_MAX_DEVICES][CATALOG_LABEL_LENGTH];
+} catalog_header_t;
+
+typedef struct {
+  char uuid[37];
+  char name[APPMNGR_INSTALLED_APP_NAME_LENGTH];
+  char version[APPMNGR_INSTALLED_APP_VERSION_LENGTH];
+  uint8_t reserved;
+  uint32_t tag_mask;     // Bit n set if the app has header.tags[n]
+  uint32_t device_mask;  // Bit n set if the app has header.devices[n]
+  uint32_t offset;       // Offset of the JSON object from blob_offset
+  uint32_t length;       // Length of the JSON object
+} catalog_entry_t;
+
+// Timing of the last catalog load, cold versus warm
+typedef struct {
+  catalog_source_t source;
+  uint32_t load_us;   // Time to have a usable index in RAM
+  uint32_t fetch_us;  // Network time of the last conditional GET
+  uint32_t build_us;  // Time to rebuild the index from the raw catalog
+  uint32_t fetches;
+  uint32_t not_modified;
+  bool oversize;  // Last catalog served exceeded CATALOG_MAX_JSON_SIZE
+} catalog_stats_t;
+
+/**
+ * @brief Load the cached catalog index from the SD card.
+ *
+ * Reads the compact index of the apps folder into RAM, if present and built
+ * from the current PARAM_APPS_CATALOG_URL, and schedules the first background
+ * refresh. Must be called once the SD card is mounted.
+ */
+void catalog_init(void);
+
+/**
+ * @brief Drive the background refresh of the catalog.
+ *
+ * Called from the manager main loop. Starts the conditional GET when the
+ * refresh timer expires, polls it, and rebuilds the index when a new catalog
+ * has been downloaded. Never blocks.
+ *
+ * @param network_ready True if the network is up and no other download or
+ * launch is running.
+ */
+void catalog_loop(bool network_ready);
+
+/**
+ * @brief Request an immediate refresh of the catalog.
+ *
+ * Drops the cached validators if the catalog URL changed since the index was
+ * built.
+ */
+void catalog_request_refresh(void);
+
+catalog_status_t catalog_get_status(void);
+const catalog_header_t *catalog_get_header(void);
+const catalog_stats_t *catalog_get_stats(void);
+
+/**
+ * @brief Number of apps in the cached index, or 0 if there is no cache.
+ */
+uint16_t catalog_get_count(void);
+
+/**
+ * @brief Check if the cached index misses apps of the catalog.
+ *
+ * True if the catalog has more than CATALOG_MAX_APPS apps, or if the server
+ * now serves a catalog larger than CATALOG_MAX_JSON_SIZE and the cache is an
+ * older one. The browser should then read the full catalog from the server.
+ */
+bool catalog_is_truncated(void);
+
+/**
+ * @brief Get an entry of the cached index.
+ *
+ * @param index Position of the app in the catalog.
+ * @return const catalog_entry_t* The entry, or NULL if out of range.
+ */
+const catalog_entry_t *catalog_get_entry(uint16_t index);
+
+/**
+ * @brief Check if an entry passes the tag and device filters.
+ *
+ * A zero mask disables the corresponding filter.
+ */
+bool catalog_entry_matches(const catalog_entry_t *entry, uint32_t tag_mask,
+                           uint32_t device_mask);
+
+/**
+ * @brief Read a chunk of the JSON object of a cached app.
+ *
+ * Keeps the index file open between calls so the HTTP server can stream the
+ * catalog in small SSI parts. Call catalog_close_reader() when done.
+ *
+ * @param index Position of the app in the catalog.
+ * @param offset Offset inside the JSON object of the app.
+ * @param buf Destination buffer.
+ * @param len Maximum number of bytes to read.
+ * @return int Bytes read, 0 at the end of the object, negative on error.
+ */
+int catalog_read_app_chunk(uint16_t index, uint32_t offset, char *buf,
+                           uint32_t len);
+
+void catalog_close_reader(void);
+
+#endif  // CATALOG_H
@@ -17,8 +17,10 @@
 
 #include "constants.h"
 #include "debug.h"
+#include "display_fonts.h"
 #include "hardware/dma.h"
 #include "memfunc.h"
+#include "metrics.h"
 #include "network.h"
 #include "qrcodegen.h"
 
@@ -43,6 +45,14 @@
 // 0x1000) // increment 4K bytes to create the translation table
 #define DISPLAY_HIGHRES_INVERT \
   0  // If 1, the highres display will be inverted, otherwise it will be normal
+// If 1, keep a copy of the framebuffer with the pixels doubled horizontally,
+// so the computer copies the highres and medium res screens with no lookups
+#define DISPLAY_HIGHRES_EXPANDED 1
+// If 1, publish with each frame the spans of words that changed, so the
+// computer copies only those. Needs a shadow copy of the framebuffer.
+#ifndef DISPLAY_DELTA_UPDATES
+#define DISPLAY_DELTA_UPDATES 1
+#endif
 #define DISPLAY_BYPASS_MESSAGE "Press any SHIFT key to boot from GEMDOS."
 #define DISPLAY_TARGET_COMPUTER_NAME "Atari ST"
 #endif
@@ -57,6 +67,8 @@
 // Buffer for the QR code generation. Using 4K to avoid strange crash due memory
 // overflow of default buffer
 #define DISPLAY_QR_BUFFER_LEN_MAX 4096
+// Longest text kept to check if a QR code must be encoded again
+#define DISPLAY_QR_TEXT_MAX 256
 
 // Display buffer offset
 #define DISPLAY_BUFFER_OFFSET 0x8000
@@ -64,9 +76,57 @@
 // Commands offset. BUFFER_OFFSET + ADDRESS_OFFSET
 #define DISPLAY_COMMAND_ADDRESS_OFFSET 8000
 
+// Frame generation, a word incremented by every refresh that changed rows.
+// BUFFER_OFFSET + FRAME_GEN_OFFSET
+#define DISPLAY_FRAME_GEN_OFFSET (DISPLAY_COMMAND_ADDRESS_OFFSET + 4)
+
+// Character rows changed by the last refresh, a longword with bit 0 for the
+// top row. If the computer missed a generation it must copy all the rows.
+// BUFFER_OFFSET + DIRTY_ROWS_OFFSET
+#define DISPLAY_DIRTY_ROWS_OFFSET (DISPLAY_COMMAND_ADDRESS_OFFSET + 8)
+
+// Row of the framebuffer shown at the top of the screen, a word. The rows are
+// a ring: scrolling moves the top row instead of the pixels, and the computer
+// rotates the rows while it copies them. BUFFER_OFFSET + TOP_ROW_OFFSET
+#define DISPLAY_TOP_ROW_OFFSET (DISPLAY_COMMAND_ADDRESS_OFFSET + 6)
+
+// The top row and the dirty rows of a frame go to one of two slots, by the
+// parity of its generation, before the generation is published. A frame never
+// overwrites the slot of the previous one, so if the computer reads the same
+// generation before and after the slot, the slot belongs to that frame.
+// BUFFER_OFFSET + TOP_ROW_OFFSET or DIRTY_ROWS_OFFSET + FRAME_SLOT_SIZE
+#define DISPLAY_FRAME_SLOT_SIZE 8
+
+// Rows of 8 pixel lines tracked by the dirty bitmap
+#define DISPLAY_CHAR_ROWS (DISPLAY_HEIGHT / 8)
+#define DISPLAY_ALL_ROWS ((uint32_t)((1ul << DISPLAY_CHAR_ROWS) - 1))
+#define DISPLAY_ROW_BYTES (DISPLAY_BUFFER_SIZE / DISPLAY_CHAR_ROWS)
+
 // Highres translate table offset: BUFFER_OFFSET + TRANSTABLE_OFFSET
 #define DISPLAY_HIGHRES_TRANSTABLE_OFFSET 0x1000
 
+// Framebuffer with the pixels doubled horizontally, 640x200 and in the same
+// ring of rows. Each word is written as the computer reads it, no swap needed.
+// From the start of the ROM, not the framebuffer: ends before BUFFER_OFFSET
+#define DISPLAY_HIGHRES_EXPANDED_ROM_OFFSET 0x2000
+#define DISPLAY_EXPANDED_ROW_BYTES (DISPLAY_ROW_BYTES * 2)
+
+// Word not 0 if the expanded framebuffer is kept up to date.
+// BUFFER_OFFSET + EXPANDED_FLAG_OFFSET
+#define DISPLAY_EXPANDED_FLAG_OFFSET (DISPLAY_COMMAND_ADDRESS_OFFSET + 12)
+
+// Spans of words changed by the last frame: a word with the number of spans,
+// or DISPLAY_DELTA_NONE to copy the dirty rows, followed by two words per
+// span, the first word in screen order and the words in the span - 1. A span
+// never crosses a line of pixels. Frames with odd generation use the second
+// area, so the spans of the next frame never overwrite the ones being read.
+// From the framebuffer: BUFFER_OFFSET + DELTA_FB_OFFSET, ROM offset 0xA000
+#define DISPLAY_DELTA_FB_OFFSET 0x2000
+#define DISPLAY_DELTA_AREA_SIZE 0x1000
+#define DISPLAY_DELTA_MAX_SPANS 1023
+#define DISPLAY_DELTA_NONE 0xFFFF
+#define DISPLAY_LINE_WORDS (DISPLAY_WIDTH / 16)
+
 // Commands sent to the active loop in the display terminal application
 #define DISPLAY_COMMAND_NOP 0x0       // Do nothing, clean the command buffer
 #define DISPLAY_COMMAND_RESET 0x1     // Reset the computer
@@ -94,19 +154,34 @@
 #define LEFT_PADDING_FOR_CENTER(STR, WIDTH) \
   (((WIDTH) > strlen(STR)) ? (((WIDTH) - (size_t)strlen(STR)) / 2) : 0)
 
+// A QR code and the text encoded in it. The text is only encoded again when
+// it changes.
+typedef struct {
+  char text[DISPLAY_QR_TEXT_MAX];
+  uint8_t code[DISPLAY_QR_BUFFER_LEN_MAX];
+} display_qr_t;
+
 void display_draw_qr(const uint8_t qrcode[], uint16_t display_size_x,
                      uint16_t display_size_y, uint16_t pos_x, uint16_t pos_y,
                      int border, int scale);
-void display_create_qr(uint8_t qrcode[], const char* text);
+void display_create_qr(display_qr_t* qr, const char* text);
 void display_setup_u8g2();
 void display_refresh();
+void display_refresh_dirty();
+void display_mark_dirty_rows(uint8_t first_row, uint8_t num_rows);
 void display_draw_product_info();
+uint16_t display_draw_text(const display_font_t* font, uint16_t x, uint16_t y,
+                           const char* str);
+uint16_t display_text_width(const display_font_t* font, const char* str);
 void display_generate_mask_table(uint32_t memory_address);
 u8g2_t* display_get_u8g2_ref();
-void display_scrollup(uint16_t blank_bytes);
+void display_scrollup(uint8_t rows);
+void display_reset_scroll();
+uint8_t display_get_buffer_row(uint8_t row);
 
 uint32_t get_display_address();
 uint32_t get_display_command_address();
 uint32_t get_displays_highres_transtable_address();
+uint32_t get_displays_highres_expanded_address();
 
 #endif  // DISPLAY_H
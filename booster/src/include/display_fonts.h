@@ -0,0 +1,44 @@
+/**
+ * File: display_fonts.h
+ * Author: Diego Parrilla Santamaría
+ * Date: October 2026
+ * Copyright: 2026 - GOODDATA LABS SL
+ * Description: Fonts of the status screens, pre-decoded from the u8g2 fonts
+ * at build time by external/generate_fonts.py into display_fonts.c
+ */
+
+#ifndef DISPLAY_FONTS_H
+#define DISPLAY_FONTS_H
+
+#include <inttypes.h>
+
+// Lines of the cell of a glyph. The cell ends at the lowest line of the font
+#define DISPLAY_FONT_LINES 8
+
+// A glyph in the framebuffer format: a byte per line, leftmost pixel in bit 7.
+// The pixels of the bounding box (mask, lines top to top + height - 1) not
+// set in lines are background, cleared when drawn as u8g2 does in solid mode.
+typedef struct {
+  uint8_t present;   // 0 if the font has no glyph for the encoding
+  int8_t advance;    // Pixels to the next glyph
+  int8_t x_offset;   // First column of the bounding box
+  uint8_t width;     // Columns of the bounding box
+  uint8_t mask;      // Columns of the bounding box, as a line
+  uint8_t top;       // First line of the bounding box in the cell
+  uint8_t height;    // Lines of the bounding box
+  uint8_t lines[DISPLAY_FONT_LINES];
+} display_font_glyph_t;
+
+typedef struct {
+  uint8_t first;   // Encoding of the first glyph
+  uint8_t last;    // Encoding of the last glyph
+  uint8_t ascent;  // Lines of the cell above the baseline
+  const display_font_glyph_t *glyphs;
+} display_font_t;
+
+// u8g2_font_squeezed_b7_tr, printable ASCII
+extern const display_font_t display_font_squeezed;
+// u8g2_font_amstrad_cpc_extended_8f, all the encodings
+extern const display_font_t display_font_amstrad;
+
+#endif  // DISPLAY_FONTS_H
@@ -32,7 +32,12 @@
 #define DISPLAY_TERM_FIRST_ROW_OFFSET 1
 #endif
 
+// The terminal font is a fixed 8x8 cell, byte aligned in the framebuffer
+#define DISPLAY_TERM_GLYPH_LINES DISPLAY_FONT_LINES
+#define DISPLAY_TERM_LINE_BYTES (DISPLAY_WIDTH / 8)
+
 void display_term_char(const uint8_t col, const uint8_t row, const char c);
+void display_term_chars(const uint8_t col, const uint8_t row, const char *chars, uint8_t len);
 void display_term_cursor(const uint8_t col, const uint8_t row);
 void display_term_start(const uint8_t num_col, const uint8_t num_row);
 void display_term_refresh();
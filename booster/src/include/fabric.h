@@ -22,6 +22,7 @@
 #include "fabric_httpd.h"
 #include "gconfig.h"
 #include "lwip/apps/httpd.h"
+#include "metrics.h"
 #include "network.h"
 #include "pico/multicore.h"
 #include "pico/stdlib.h"
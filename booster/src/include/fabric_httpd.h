@@ -9,6 +9,7 @@
 #ifndef FABRIC_HTTPD_H
 #define FABRIC_HTTPD_H
 
+#include "bench.h"
 #include "debug.h"
 #include "constants.h"
 #include "network.h"
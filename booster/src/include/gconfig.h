@@ -17,13 +17,17 @@
 #define PARAM_APPS_CATALOG_URL "APPS_CATALOG_URL"
 #define PARAM_BOOT_FEATURE "BOOT_FEATURE"
 #define PARAM_HOSTNAME "HOSTNAME"
+#define PARAM_MIRROR_HOSTS "MIRROR_HOSTS"
 #define PARAM_SAFE_CONFIG_REBOOT "SAFE_CONFIG_REBOOT"
 #define PARAM_SD_BAUD_RATE_KB "SD_BAUD_RATE_KB"
+#define PARAM_VERSION_CACHE "VERSION_CACHE"
+#define PARAM_VERSION_CACHE_TTL "VERSION_CACHE_TTL"
 #define PARAM_WIFI_AUTH "WIFI_AUTH"
 #define PARAM_WIFI_CONNECT_TIMEOUT "WIFI_CONNECT_TIMEOUT"
 #define PARAM_WIFI_COUNTRY "WIFI_COUNTRY"
 #define PARAM_WIFI_DHCP "WIFI_DHCP"
 #define PARAM_WIFI_DNS "WIFI_DNS"
+#define PARAM_WIFI_FAST_CONNECT "WIFI_FAST_CONNECT"
 #define PARAM_WIFI_IP "WIFI_IP"
 #define PARAM_WIFI_MODE "WIFI_MODE"
 #define PARAM_WIFI_NETMASK "WIFI_NETMASK"
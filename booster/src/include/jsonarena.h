@@ -0,0 +1,65 @@
+/**
+ * File: jsonarena.h
+ * Author: Diego Parrilla Santamaría
+ * Date: October 2026
+ * Copyright: 2026 - GOODDATA LABS SL
+ * Description: Header file for the bump allocator used by cJSON
+ */
+
+#ifndef JSONARENA_H
+#define JSONARENA_H
+
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "cjson/cJSON.h"
+#include "debug.h"
+
+// The lwIP callbacks run from an IRQ that can preempt a parse in the main
+// loop, so each context carves from its own arena.
+typedef enum {
+  JSONARENA_CONTEXT_TASK = 0,  // Main loop: the catalog rebuild
+  JSONARENA_CONTEXT_IRQ,       // lwIP callbacks: cgi_saveparams
+  JSONARENA_CONTEXT_COUNT
+} jsonarena_context_t;
+
+// A setting posted to saveparams takes about 340 bytes of arena: four
+// nodes and six strings. 4 KB fits 12 settings, and the pages post 10 at
+// most. The catalog does not fit and its rebuild spills to the heap: 6.5 KB
+// at the peak for the 6 KB appsremote/apps.json, 65 KB for a 32 KB catalog.
+#define JSONARENA_TASK_SIZE 8192
+#define JSONARENA_IRQ_SIZE 4096
+#define JSONARENA_ALIGNMENT 8  // Alignment of every allocation
+
+typedef struct {
+  uint32_t used;            // Bytes in use since the last reset
+  uint32_t high_water;      // Largest value of used since boot
+  uint32_t live;            // Arena blocks not freed yet
+  uint32_t resets;          // Resets that rewound the arena
+  uint32_t overflows;       // Allocations served by the heap
+  uint32_t overflow_bytes;  // Bytes of those allocations
+  uint32_t leaks;           // Resets refused because blocks were still live
+} jsonarena_stats_t;
+
+/**
+ * @brief Install the arena as the cJSON allocator.
+ *
+ * Every cJSON node and string is carved from the static buffer of the
+ * context, instead of the heap shared with lwIP and FatFS. When the arena is
+ * full the allocation falls back to malloc.
+ */
+void jsonarena_init(void);
+
+/**
+ * @brief Rewind the arena of the calling context at the end of a request or a
+ * parse.
+ *
+ * Must be called after the cJSON trees built since the last reset have been
+ * deleted. If any arena block is still live the arena is not rewound.
+ */
+void jsonarena_reset(void);
+
+const jsonarena_stats_t *jsonarena_get_stats(jsonarena_context_t context);
+
+#endif  // JSONARENA_H
@@ -0,0 +1,92 @@
+/**
+ * File: jsontok.h
+ * Author: Diego Parrilla Santamaría
+ * Date: October 2026
+ * Copyright: 2026 - GOODDATA LABS SL
+ * Description: Header file for the heap-free JSON tokenizer
+ */
+
+#ifndef JSONTOK_H
+#define JSONTOK_H
+
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+// Error codes returned by jsontok_parse
+#define JSONTOK_ERROR_NOMEM -1  // Not enough tokens for the document
+#define JSONTOK_ERROR_INVAL -2  // Invalid character in the document
+#define JSONTOK_ERROR_PART -3   // Document is truncated
+
+typedef enum {
+  JSONTOK_UNDEFINED = 0,
+  JSONTOK_OBJECT,
+  JSONTOK_ARRAY,
+  JSONTOK_STRING,
+  JSONTOK_PRIMITIVE  // Number, true, false or null
+} jsontok_type_t;
+
+// A token points into the source document, nothing is copied. For strings
+// start and end exclude the quotes. size is the number of keys of an object,
+// the number of elements of an array, or 1 for a key with its value.
+typedef struct {
+  jsontok_type_t type;
+  int16_t start;
+  int16_t end;
+  int16_t size;
+  int16_t parent;
+} jsontok_t;
+
+/**
+ * @brief Tokenize a JSON document into a caller-provided token array.
+ *
+ * The document is scanned once without allocating memory. Tokens are stored
+ * in document order, so the children of a token always follow it.
+ *
+ * @param js JSON document, does not need to be NUL terminated.
+ * @param len Length of the document in bytes. Must fit in an int16_t.
+ * @param tokens Array where the tokens are stored.
+ * @param num_tokens Number of entries of the tokens array.
+ * @return int Number of tokens used, or a negative JSONTOK_ERROR_* code.
+ */
+int jsontok_parse(const char *js, size_t len, jsontok_t *tokens,
+                  unsigned int num_tokens);
+
+/**
+ * @brief Get the index of the token following a token and all its children.
+ */
+int jsontok_skip(const jsontok_t *tokens, int count, int index);
+
+/**
+ * @brief Find the value of a key in an object token.
+ *
+ * Keys are compared ignoring the ASCII case, like cJSON_GetObjectItem().
+ *
+ * @param js JSON document tokenized.
+ * @param tokens Tokens of the document.
+ * @param count Number of tokens returned by jsontok_parse.
+ * @param object Index of the object token to search.
+ * @param key Key to look for. Must not contain escape sequences.
+ * @return int Index of the value token, or -1 if not found.
+ */
+int jsontok_find(const char *js, const jsontok_t *tokens, int count,
+                 int object, const char *key);
+
+/**
+ * @brief Copy a string token into a buffer, resolving the escape sequences.
+ *
+ * The output is always NUL terminated and truncated to fit, like snprintf.
+ *
+ * @return size_t Length of the copied string.
+ */
+size_t jsontok_copy_string(const char *js, const jsontok_t *token, char *out,
+                           size_t out_len);
+
+/**
+ * @brief Check if a token is a string.
+ */
+static inline bool jsontok_is_string(const jsontok_t *tokens, int index) {
+  return (index >= 0) && (tokens[index].type == JSONTOK_STRING);
+}
+
+#endif  // JSONTOK_H
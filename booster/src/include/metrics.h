@@ -0,0 +1,115 @@
+/**
+ * File: metrics.h
+ * Author: Diego Parrilla Santamaría
+ * Date: October 2026
+ * Copyright: 2026 - GOODDATA LABS SL
+ * Description: Header file for the runtime metrics registry
+ */
+
+#ifndef METRICS_H
+#define METRICS_H
+
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stdio.h>
+
+#include "debug.h"
+#include "lwip/apps/fs.h"
+#include "pico/stdlib.h"
+
+#define METRICS_URI "/metrics"
+#define METRICS_TEXT_SIZE 4096     // Prometheus text of all the metrics
+#define METRICS_MAX_BUCKETS 8      // Buckets of a histogram, without +Inf
+#define METRICS_PREFIX "booster_"  // Namespace of the exported names
+
+// The registry is fixed at compile time. To add a metric, add its id here and
+// its name and help text to the tables in metrics.c, in the same order.
+
+// Monotonic counters, exported with the _total suffix
+typedef enum {
+  METRICS_PROTOCOL_COMMANDS,         // Commands received from the computer
+  METRICS_PROTOCOL_CHECKSUM_ERRORS,  // Commands dropped by the checksum
+  METRICS_FLASH_ERASES,              // Calls to flash_range_erase()
+  METRICS_SD_ERRORS,                 // Failed writes to the SD card
+  METRICS_DOWNLOADS,                 // Downloads of apps and firmware
+  METRICS_DOWNLOAD_FAILURES,         // Downloads that did not complete
+  METRICS_DOWNLOAD_BYTES,            // Bytes received by the downloads
+  METRICS_WIFI_CONNECTS,             // Association attempts
+  METRICS_WIFI_LINK_LOSSES,          // Link up to any other state
+  METRICS_HTTPD_FILE_OPENS,          // Files opened by the HTTP server
+  METRICS_DISPLAY_FRAMES,            // Frames published to the computer
+  METRICS_DISPLAY_COPY_BYTES,        // Framebuffer bytes copied by the computer
+  METRICS_COUNTER_COUNT
+} metrics_counter_t;
+
+// Last value set, exported as is
+typedef enum {
+  METRICS_GAUGE_WIFI_RSSI,      // dBm of the last RSSI read
+  METRICS_GAUGE_DOWNLOAD_KBPS,  // Throughput of the last download
+  METRICS_GAUGE_COUNT
+} metrics_gauge_t;
+
+// Observations counted in fixed buckets
+typedef enum {
+  METRICS_HISTOGRAM_DOWNLOAD_MS,     // Duration of the downloads
+  METRICS_HISTOGRAM_FLASH_ERASE_MS,  // Duration of the flash erases
+  METRICS_HISTOGRAM_COUNT
+} metrics_histogram_t;
+
+/**
+ * @brief Add to a counter.
+ *
+ * Lock-free and safe to call from IRQ handlers on both cores: each core only
+ * writes its own copy of the counter, with the interrupts masked for the
+ * few instructions of the update. Runs from RAM, so it can be called while
+ * the flash is being written.
+ */
+void metrics_add(metrics_counter_t counter, uint32_t value);
+
+static inline void metrics_inc(metrics_counter_t counter) {
+  metrics_add(counter, 1);
+}
+
+/**
+ * @brief Set a gauge. A single 32-bit store, safe from any context.
+ */
+void metrics_set(metrics_gauge_t gauge, int32_t value);
+
+/**
+ * @brief Count a value in its histogram bucket. Same guarantees as
+ * metrics_add().
+ */
+void metrics_observe(metrics_histogram_t histogram, uint32_t value);
+
+/**
+ * @brief Read a counter, summing the copies of both cores.
+ */
+uint32_t metrics_get_counter(metrics_counter_t counter);
+
+/**
+ * @brief Write all the metrics in the Prometheus text format.
+ *
+ * The values of each metric are read one by one, not as a snapshot of the
+ * whole registry.
+ *
+ * @return The length of the text, truncated to buffer_len - 1.
+ */
+int metrics_render(char *buffer, size_t buffer_len);
+
+/**
+ * @brief Open METRICS_URI as a custom file of the HTTP server.
+ *
+ * Renders the metrics with their HTTP headers into a static buffer, so the
+ * body does not change while it is being sent. There is a single buffer: a
+ * scrape opened while another one is being sent gets a 503 instead.
+ *
+ * @return true if the name is METRICS_URI.
+ */
+bool metrics_open_file(struct fs_file *file, const char *name);
+
+/**
+ * @brief Release the buffer if the file is the one of METRICS_URI.
+ */
+void metrics_close_file(struct fs_file *file);
+
+#endif  // METRICS_H
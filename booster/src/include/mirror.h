@@ -0,0 +1,76 @@
+/**
+ * File: mirror.h
+ * Author: Diego Parrilla Santamaría
+ * Date: October 2026
+ * Copyright: 2026 - GOODDATA LABS SL
+ * Description: Header file for the LAN mirrors of the app binaries
+ */
+
+#ifndef MIRROR_H
+#define MIRROR_H
+
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "debug.h"
+#include "gconfig.h"
+#include "pico/cyw43_arch.h"
+#include "pico/stdlib.h"
+
+#define MIRROR_MAX_HOSTS 4
+#define MIRROR_HOST_SIZE 64
+#define MIRROR_ORIGIN -1  // Route to the host of the original URL
+
+// A failed mirror is skipped for MIN seconds, doubling up to MAX
+#define MIRROR_RETRY_MIN_S 30
+#define MIRROR_RETRY_MAX_S 600
+
+typedef struct {
+  char host[MIRROR_HOST_SIZE];
+  uint16_t port;          // 0 for the default port
+  uint8_t failures;       // Consecutive failures
+  absolute_time_t retry;  // Skipped until then after a failure
+  uint32_t requests;      // Requests routed to the mirror
+  uint32_t errors;        // Requests failed
+} mirror_host_t;
+
+typedef struct {
+  int8_t mirror;                    // Index of the mirror, or MIRROR_ORIGIN
+  char hostname[MIRROR_HOST_SIZE];  // Empty for MIRROR_ORIGIN
+  uint16_t port;                    // 0 for the default port
+} mirror_route_t;
+
+/**
+ * @brief Choose the host of the next request.
+ *
+ * Walks the PARAM_MIRROR_HOSTS list ("host[:port],host[:port]...") in order
+ * and picks the first mirror that is not waiting after a failure. The request
+ * keeps the path of the original URL and is sent over plain HTTP: a mirror
+ * must serve the same paths as the origin.
+ *
+ * @param route Filled with the chosen mirror, or MIRROR_ORIGIN if the list is
+ * empty or every mirror is failing.
+ * @return true if the request must go to a mirror.
+ */
+bool mirror_route(mirror_route_t *route);
+
+/**
+ * @brief Record the result of a request routed with mirror_route().
+ *
+ * A failure holds the mirror back with an exponential backoff, so the next
+ * request goes to the next mirror of the list or to the origin. A success
+ * clears it. Requests to the origin are ignored.
+ */
+void mirror_report(const mirror_route_t *route, bool ok);
+
+/**
+ * @brief Copy the mirrors parsed from the setting, with their health.
+ *
+ * @param hosts Filled with the mirrors.
+ * @return The number of mirrors copied.
+ */
+uint8_t mirror_get_hosts(mirror_host_t hosts[MIRROR_MAX_HOSTS]);
+
+#endif  // MIRROR_H
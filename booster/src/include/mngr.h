@@ -16,6 +16,8 @@
 
 #include "appmngr.h"
 #include "blink.h"
+#include "bootprof.h"
+#include "catalog.h"
 #include "cjson/cJSON.h"
 #include "constants.h"
 #include "debug.h"
@@ -23,6 +25,7 @@
 #include "display_mngr.h"
 #include "gconfig.h"
 #include "httpc/httpc.h"
+#include "jsonarena.h"
 #include "lwip/altcp_tls.h"
 #include "lwip/apps/httpd.h"
 #include "mngr_httpd.h"
@@ -30,6 +33,7 @@
 #include "pico/async_context.h"
 #include "pico/multicore.h"
 #include "pico/stdlib.h"
+#include "pico/sync.h"
 #include "reset.h"
 #include "sdcard.h"
 #include "select.h"
@@ -9,8 +9,10 @@
 #ifndef MNGR_HTTPD_H
 #define MNGR_HTTPD_H
 
+#include "bench.h"
 #include "debug.h"
 #include "constants.h"
+#include "netstats.h"
 #include "network.h"
 #include "mngr.h"
 #include "appmngr.h"
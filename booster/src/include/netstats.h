@@ -0,0 +1,68 @@
+/**
+ * File: netstats.h
+ * Author: Diego Parrilla Santamaría
+ * Date: October 2026
+ * Copyright: 2026 - GOODDATA LABS SL
+ * Description: Header file for the lwIP memory and protocol counters
+ */
+
+#ifndef NETSTATS_H
+#define NETSTATS_H
+
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stdio.h>
+
+#include "debug.h"
+#include "lwip/memp.h"
+#include "lwip/stats.h"
+
+typedef struct {
+  const char *name;  // Pool name in lwIP, or "HEAP"
+  uint32_t avail;    // Elements in the pool, or bytes in the heap
+  uint32_t used;     // In use now
+  uint32_t max;      // High-water mark since boot
+  uint32_t err;      // Allocations failed because the pool was empty
+} netstats_pool_t;
+
+typedef struct {
+  uint32_t xmit;    // Packets sent
+  uint32_t recv;    // Packets received
+  uint32_t rexmit;  // Segments retransmitted (TCP only)
+  uint32_t drop;    // Packets dropped
+  uint32_t memerr;  // Out of memory errors
+  uint32_t err;     // Checksum, length and protocol errors
+} netstats_proto_t;
+
+/**
+ * @brief Number of lwIP memory pools (MEMP_MAX).
+ */
+uint8_t netstats_get_pool_count(void);
+
+/**
+ * @brief Read the counters of a memory pool.
+ *
+ * The pools are sized in lwipopts.h: PBUF_POOL_SIZE, MEMP_NUM_TCP_SEG,
+ * MEMP_NUM_PBUF... A high-water mark well below avail means the pool is
+ * oversized; any err means it ran out.
+ *
+ * @return false if the index is out of range or the stats are disabled.
+ */
+bool netstats_get_pool(uint8_t index, netstats_pool_t *pool);
+
+/**
+ * @brief Read the counters of the lwIP heap (MEM_SIZE).
+ */
+void netstats_get_heap(netstats_pool_t *heap);
+
+/**
+ * @brief Read the TCP counters. lwIP does not count out-of-order segments.
+ */
+void netstats_get_tcp(netstats_proto_t *tcp);
+
+/**
+ * @brief Read the counters of the WiFi interface.
+ */
+void netstats_get_link(netstats_proto_t *link);
+
+#endif  // NETSTATS_H
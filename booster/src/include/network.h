@@ -12,6 +12,7 @@
 #include "constants.h"
 #include "debug.h"
 #include "gconfig.h"
+#include "metrics.h"
 #include "settings.h"
 
 #ifdef BLINK_H
@@ -19,6 +20,7 @@
 #endif
 
 #ifdef CYW43_WL_GPIO_LED_PIN
+#include "lwip/dhcp.h"
 #include "lwip/dns.h"
 #include "lwip/ip4_addr.h"
 #include "lwip/netif.h"
@@ -45,6 +47,9 @@
 
 #define NETWORK_POLLING_INTERVAL 100  // 100 ms
 #define NETWORK_CONNECT_TIMEOUT 30    // 30 seconds
+#define NETWORK_FAST_CONNECT_TIMEOUT 6  // Directed join + INIT-REBOOT, seconds
+#define NETWORK_CONNECT_POLL_MS 50      // Link status polling while joining
+#define NETWORK_CONNECT_BLINK_MS 500    // LED toggle while joining
 
 #define NETWORK_POWER_MGMT_DISABLED 0xa11140
 #define NETWORK_POWER_MGMT_MAX_OPTIONS 5
@@ -54,6 +59,9 @@
 #define NETWORK_MAC_SIZE 6
 
 #define MAX_NETWORKS 100
+// BSSID hash slots of the scan table. Power of 2, larger than MAX_NETWORKS
+#define NETWORK_SCAN_INDEX_SIZE 128
+#define NETWORK_SCAN_MAX_AGE 3  // Scans an access point can be missing
 #define MAX_SSID_LENGTH \
   36  // SSID can have up to 32 characters + null terminator + padding
 #define MAX_BSSID_LENGTH 20
@@ -105,12 +113,14 @@ typedef enum {
 } wifi_mode_t;
 
 typedef struct {
-  char ssid[MAX_SSID_LENGTH];    // SSID can have up to 32 characters + null
-                                 // terminator
-  char bssid[MAX_BSSID_LENGTH];  // BSSID in the format xx:xx:xx:xx:xx:xx + null
-                                 // terminator
-  uint16_t auth_mode;            // MSB is not used, the data is in the LSB
-  int16_t rssi;                  // Received Signal Strength Indicator
+  char ssid[MAX_SSID_LENGTH];       // SSID can have up to 32 characters + null
+                                    // terminator
+  uint8_t bssid[NETWORK_MAC_SIZE];  // Binary BSSID, the key of the scan table
+  uint16_t auth_mode;               // MSB is not used, the data is in the LSB
+  int16_t rssi;                     // Received Signal Strength Indicator
+  uint16_t channel;                 // Channel of the last beacon received
+  uint16_t last_seen;               // Scan generation of the last beacon
+  uint32_t ssid_hash;               // Groups the access points of a network
 } wifi_network_info_t;
 
 typedef struct {
@@ -119,6 +129,40 @@ typedef struct {
   uint16_t count;  // The number of networks found/stored
 } wifi_scan_data_t;
 
+// One network of the ranked scan list: the strongest access point of an SSID
+typedef struct {
+  uint8_t index;     // Position in wifi_scan_data_t.networks
+  uint8_t ap_count;  // Access points seen with the same SSID
+} wifi_network_rank_t;
+
+// Last successful association. Saved in flash to skip the scan and the DHCP
+// discovery on the next boot.
+typedef struct {
+  bool valid;
+  uint8_t bssid[NETWORK_MAC_SIZE];  // Access point the device joined
+  uint32_t channel;                 // Its channel, or CYW43_CHANNEL_NONE
+  uint32_t configHash;  // SSID, password and auth mode it was made with
+  uint32_t ip;          // DHCP lease, as stored by lwIP. Zero with a static IP.
+  uint32_t netmask;
+  uint32_t gateway;
+  uint32_t dns;
+  uint32_t leaseSeconds;  // Lease time granted by the DHCP server
+} network_fast_connect_t;
+
+typedef enum {
+  NETWORK_CONNECT_PATH_NONE,  // Not connected yet
+  NETWORK_CONNECT_PATH_FAST,  // Cached access point and lease
+  NETWORK_CONNECT_PATH_FULL   // Scan, associate and DHCP discovery
+} network_connect_path_t;
+
+typedef struct {
+  network_connect_path_t path;  // Path that connected
+  bool fastTried;               // A cached association was available
+  uint32_t fastUs;              // Time spent in the fast path
+  uint32_t fullUs;              // Time spent in the full path, all retries
+  uint32_t connectedAtUs;       // Boot-to-connected time
+} network_connect_stats_t;
+
 // Function to handle callback when trying to connect
 typedef void (*NetworkPollingCallback)(void);
 
@@ -179,6 +223,22 @@ void network_safePoll();
  */
 int network_scan(absolute_time_t* wifi_scan_time, int wifi_scan_interval);
 
+/**
+ * @brief Select passive scans for the next network_scan() calls.
+ *
+ * A passive scan only listens for beacons, so it does not send probe requests
+ * that compete with the traffic of the current connection. It takes longer
+ * to find every access point than an active scan.
+ *
+ * @param passive True for passive scans, false for active scans (default).
+ */
+void network_setScanPassive(bool passive);
+
+/**
+ * @brief Get the number of scans started since boot.
+ */
+uint32_t network_getScanCount(void);
+
 /**
  * @brief Indicates whether a WiFi network scan is currently active.
  *
@@ -197,15 +257,51 @@ int network_scanIsActive();
  */
 wifi_scan_data_t* network_getFoundNetworks();
 
+/**
+ * @brief Rank the found networks by signal strength.
+ *
+ * Groups the access points by SSID, keeps the strongest one of each group and
+ * sorts the groups from the strongest to the weakest signal.
+ *
+ * @param ranked Array that receives the ranked networks.
+ * @param max_ranked Size of the array.
+ * @return Number of networks ranked.
+ */
+uint16_t network_rankNetworks(wifi_network_rank_t* ranked, uint16_t max_ranked);
+
+/**
+ * @brief Get the number of times the scan table was compacted.
+ *
+ * Aging moves the networks in the table. A ranking is only valid while this
+ * counter does not change.
+ */
+uint32_t network_getScanEpoch(void);
+
 /**
  * @brief Attempts connecting to a WiFi network in station mode.
  *
- * Implements connection logic including error handling and retries.
+ * Implements connection logic including error handling and retries. If the
+ * last association is cached and the WiFi settings did not change, it first
+ * joins the same access point directly and asks the DHCP server to confirm
+ * the same lease. If that fails it falls back to the full connection.
  *
  * @return Status code indicating connection success or failure.
  */
 wifi_sta_conn_process_status_t network_wifiStaConnect();
 
+/**
+ * @brief Save the association made in this boot for the next one.
+ *
+ * Writes the flash only if the access point or the lease changed. Call it
+ * when it is safe to write the flash, that is, with core 1 out of the way.
+ */
+void network_saveFastConnect(void);
+
+/**
+ * @brief Get the path and the timing of the last connection.
+ */
+const network_connect_stats_t *network_getConnectStats(void);
+
 /**
  * @brief Obtains the current WiFi connection status.
  *
@@ -12,6 +12,7 @@
 #include "debug.h"
 #include "constants.h"
 #include "memfunc.h"
+#include "trace.h"
 
 #include <inttypes.h>
 #include <stdbool.h>
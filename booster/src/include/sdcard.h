@@ -27,6 +27,17 @@ typedef enum {
 #define NUM_BYTES_PER_SECTOR 512
 #define SDCARD_MEGABYTE 1048576
 
+/**
+ * @brief Initialize the SD card driver.
+ *
+ * Sets up the SPI and DMA of the SD card and applies the configured bus
+ * speed. The DMA interrupt is enabled on the calling core, which must be the
+ * core that stays running. Calling it again once initialized does nothing.
+ *
+ * @return sdcard_status_t SDCARD_INIT_OK, or SDCARD_INIT_ERROR on failure.
+ */
+sdcard_status_t sdcard_initDriver();
+
 /**
  * @brief Mount filesystem using FatFS library.
  *
@@ -18,6 +18,7 @@
 #include "display_term.h"
 #include "hardware/dma.h"
 #include "memfunc.h"
+#include "metrics.h"
 #include "reset.h"
 #include "time.h"
 #include "tprotocol.h"
@@ -50,8 +51,19 @@
 #define APP_TERMINAL 0x00  // The terminal app
 
 // App terminal commands
-#define APP_TERMINAL_START 0x00      // Enter terminal command
-#define APP_TERMINAL_KEYSTROKE 0x01  // Keystroke command
+#define APP_TERMINAL_START 0x00       // Enter terminal command
+#define APP_TERMINAL_KEYSTROKE 0x01   // Keystroke command
+#define APP_TERMINAL_KEYSTROKES 0x02  // Batch of keystrokes command
+
+// Keys in a batch, one in each payload longword after the random token
+#define TERM_KEYSTROKES_BATCH 4
+
+// Scan codes of the keys without a char in the keystroke command
+#define TERM_SCAN_CODE_HOME 0x47   // Clr/Home
+#define TERM_SCAN_CODE_UP 0x48     // Cursor up
+#define TERM_SCAN_CODE_LEFT 0x4B   // Cursor left
+#define TERM_SCAN_CODE_RIGHT 0x4D  // Cursor right
+#define TERM_SCAN_CODE_DOWN 0x50   // Cursor down
 
 #ifdef DISPLAY_ATARIST
 // Terminal size for Atari ST
@@ -1,50 +1,68 @@
 const uint16_t term_firmware[] = {
-    0xABCD, 0xEF42, 0x0000, 0x0000, 0x08FA, 0x001E, 0x0000, 0x0000, 0x61D5, 0x5C94, 0x0000, 0x058C, 0x5445, 0x524D, 0x0000, 0x3F3C,
-    0x0002, 0x4E4E, 0x548F, 0x2440, 0x45EA, 0xF000, 0x264A, 0x2C3C, 0x0000, 0x0564, 0x43F9, 0x00FA, 0x0046, 0xE44E, 0x5346, 0x24D9,
-    0x51CE, 0xFFFC, 0x4ED3, 0x2C40, 0x0038, 0x0008, 0x0484, 0x3F3C, 0x0004, 0x4E4E, 0x548F, 0xB07C, 0x0002, 0x6700, 0x0130, 0x3F3C,
-    0x0025, 0x4E4E, 0x548F, 0x204E, 0x227C, 0x00FA, 0x8000, 0x203C, 0x0000, 0x0F9F, 0x3219, 0xE159, 0x3401, 0x4842, 0x3401, 0x20C2,
-    0x20C2, 0x51C8, 0xFFF0, 0x2C39, 0x00FA, 0x9F40, 0xBCBC, 0x0000, 0x0003, 0x6664, 0x3F3C, 0x000B, 0x4E41, 0x548F, 0x4A80, 0x6700,
-    0x0054, 0x3F3C, 0x0008, 0x4E41, 0x548F, 0xB03C, 0x001B, 0x6700, 0x0026, 0x2600, 0x3E3C, 0x0003, 0x48E7, 0x7F00, 0x7204, 0x303C,
-    0x0001, 0x6100, 0x02F4, 0x4CDF, 0x00FE, 0x4A40, 0x6704, 0x51CF, 0xFFE8, 0x6000, 0x0020, 0x3E3C, 0x0003, 0x48E7, 0x7F00, 0x7200,
-    0x303C, 0x0000, 0x6100, 0x02D2, 0x4CDF, 0x00FE, 0x4A40, 0x6704, 0x51CF, 0xFFE8, 0x6000, 0x0092, 0xBCBC, 0x0000, 0x0001, 0x6700,
-    0x01EA, 0xBCBC, 0x0000, 0x0002, 0x6700, 0x01FE, 0x3F3C, 0xFFFF, 0x3F3C, 0x000B, 0x4E4D, 0x588F, 0x0800, 0x0001, 0x6600, 0x01EA,
-    0x0800, 0x0000, 0x6600, 0x01E2, 0x3F3C, 0x000B, 0x4E41, 0x548F, 0x4A80, 0x6700, 0x0054, 0x3F3C, 0x0008, 0x4E41, 0x548F, 0xB03C,
-    0x001B, 0x6700, 0x0026, 0x2600, 0x3E3C, 0x0003, 0x48E7, 0x7F00, 0x7204, 0x303C, 0x0001, 0x6100, 0x0260, 0x4CDF, 0x00FE, 0x4A40,
-    0x6704, 0x51CF, 0xFFE8, 0x6000, 0x0020, 0x3E3C, 0x0003, 0x48E7, 0x7F00, 0x7200, 0x303C, 0x0000, 0x6100, 0x023E, 0x4CDF, 0x00FE,
-    0x4A40, 0x6704, 0x51CF, 0xFFE8, 0x6000, 0xFED4, 0x3F3C, 0x0025, 0x4E4E, 0x548F, 0x224E, 0x244E, 0x45EA, 0x0050, 0x207C, 0x00FA,
-    0x8000, 0x267C, 0x00FA, 0x1000, 0x203C, 0x0000, 0x00C7, 0x223C, 0x0000, 0x0013, 0x3418, 0xE15A, 0x3602, 0xC67C, 0xFF00, 0xEE4B,
-    0x3833, 0x3000, 0x4844, 0xC47C, 0x00FF, 0xD442, 0x3833, 0x2000, 0x22C4, 0x24C4, 0x51C9, 0xFFDE, 0x43E9, 0x0050, 0x45EA, 0x0050,
-    0x51C8, 0xFFCC, 0x2C39, 0x00FA, 0x9F40, 0xBCBC, 0x0000, 0x0003, 0x6664, 0x3F3C, 0x000B, 0x4E41, 0x548F, 0x4A80, 0x6700, 0x0054,
-    0x3F3C, 0x0008, 0x4E41, 0x548F, 0xB03C, 0x001B, 0x6700, 0x0026, 0x2600, 0x3E3C, 0x0003, 0x48E7, 0x7F00, 0x7204, 0x303C, 0x0001,
-    0x6100, 0x0196, 0x4CDF, 0x00FE, 0x4A40, 0x6704, 0x51CF, 0xFFE8, 0x6000, 0x0020, 0x3E3C, 0x0003, 0x48E7, 0x7F00, 0x7200, 0x303C,
-    0x0000, 0x6100, 0x0174, 0x4CDF, 0x00FE, 0x4A40, 0x6704, 0x51CF, 0xFFE8, 0x6000, 0x0092, 0xBCBC, 0x0000, 0x0001, 0x6700, 0x008C,
-    0xBCBC, 0x0000, 0x0002, 0x6700, 0x00A0, 0x3F3C, 0xFFFF, 0x3F3C, 0x000B, 0x4E4D, 0x588F, 0x0800, 0x0001, 0x6600, 0x008C, 0x0800,
-    0x0000, 0x6600, 0x0084, 0x3F3C, 0x000B, 0x4E41, 0x548F, 0x4A80, 0x6700, 0x0054, 0x3F3C, 0x0008, 0x4E41, 0x548F, 0xB03C, 0x001B,
-    0x6700, 0x0026, 0x2600, 0x3E3C, 0x0003, 0x48E7, 0x7F00, 0x7204, 0x303C, 0x0001, 0x6100, 0x0102, 0x4CDF, 0x00FE, 0x4A40, 0x6704,
-    0x51CF, 0xFFE8, 0x6000, 0x0020, 0x3E3C, 0x0003, 0x48E7, 0x7F00, 0x7200, 0x303C, 0x0000, 0x6100, 0x00E0, 0x4CDF, 0x00FE, 0x4A40,
-    0x6704, 0x51CF, 0xFFE8, 0x6000, 0xFEA4, 0x2C3C, 0x000F, 0xFFFF, 0x5386, 0x66FC, 0x42B8, 0x0420, 0x42B8, 0x043A, 0x42B8, 0x051A,
-    0x2078, 0x0004, 0x4ED0, 0x4E71, 0x4E75, 0x2038, 0x05A0, 0x6700, 0x001A, 0x2040, 0x2018, 0x6700, 0x0012, 0xB0BC, 0x5F4D, 0x4348,
-    0x6704, 0x5848, 0x60EE, 0x2818, 0x6002, 0x4284, 0x2F04, 0x263C, 0x0000, 0x0000, 0x3E3C, 0x0003, 0x48E7, 0x7F00, 0x7208, 0x303C,
-    0x0001, 0x6100, 0x0074, 0x4CDF, 0x00FE, 0x4A40, 0x6704, 0x51CF, 0xFFE8, 0x4A40, 0x6604, 0x201F, 0x4E75, 0x281F, 0x60CE, 0x3F3C,
-    0x0030, 0x4E41, 0x548F, 0xC0BC, 0x0000, 0xFFFF, 0x0C78, 0x00FC, 0x0004, 0x6608, 0x3239, 0x00FC, 0x0002, 0x6006, 0x3239, 0x00E0,
-    0x0002, 0xC2BC, 0x0000, 0xFFFF, 0x4841, 0x8081, 0x263C, 0x0000, 0x0001, 0x2800, 0x3E3C, 0x0003, 0x48E7, 0x7F00, 0x7208, 0x303C,
-    0x0001, 0x6100, 0x0014, 0x4CDF, 0x00FE, 0x4A40, 0x6704, 0x51CF, 0xFFE8, 0x4A40, 0x66A8, 0x4E75, 0x2439, 0x00FA, 0xF004, 0x5841,
-    0x43F9, 0x00FA, 0xF000, 0x207C, 0x00FB, 0x0000, 0xD1FC, 0x0000, 0x8000, 0x3E3C, 0xABCD, 0x4A30, 0x7000, 0x4287, 0xDE40, 0x4A30,
-    0x0000, 0xDE41, 0x4A30, 0x1000, 0x4A41, 0x6700, 0x0088, 0xDE42, 0x4A30, 0x2000, 0xB27C, 0x0002, 0x6700, 0x007A, 0x4842, 0xDE42,
-    0x4A30, 0x2000, 0xB27C, 0x0004, 0x6700, 0x006A, 0xDE43, 0x4A30, 0x3000, 0xB27C, 0x0006, 0x6700, 0x005C, 0x4843, 0xDE43, 0x4A30,
-    0x3000, 0xB27C, 0x0008, 0x6700, 0x004C, 0xDE44, 0x4A30, 0x4000, 0xB27C, 0x000A, 0x6700, 0x003E, 0x4844, 0xDE44, 0x4A30, 0x4000,
-    0xB27C, 0x000C, 0x672E, 0xDE45, 0x4A30, 0x5000, 0xB27C, 0x000E, 0x6722, 0x4845, 0xDE45, 0x4A30, 0x5000, 0xB27C, 0x0010, 0x6714,
-    0xDE46, 0x4A30, 0x6000, 0xB27C, 0x0012, 0x6708, 0x4846, 0xDE46, 0x4A30, 0x6000, 0x4A30, 0x7000, 0x4842, 0x2E3C, 0x0000, 0xFFFF,
-    0x7000, 0xB491, 0x6706, 0x5387, 0x66F8, 0x5380, 0x4E75, 0x2439, 0x00FA, 0xF004, 0xCCBC, 0x0000, 0xFFFF, 0x7210, 0xD286, 0x5281,
-    0xE289, 0xE389, 0x43F9, 0x00FA, 0xF000, 0x207C, 0x00FB, 0x0000, 0xD1FC, 0x0000, 0x8000, 0x3E3C, 0xABCD, 0x4A30, 0x7000, 0x4287,
-    0xDE40, 0x4A30, 0x0000, 0xDE41, 0x4A30, 0x1000, 0xDE42, 0x4A30, 0x2000, 0x4842, 0xDE42, 0x4A30, 0x2000, 0xDE43, 0x4A30, 0x3000,
-    0x4843, 0xDE43, 0x4A30, 0x3000, 0xDE44, 0x4A30, 0x4000, 0x4844, 0xDE44, 0x4A30, 0x4000, 0xDE45, 0x4A30, 0x5000, 0x4845, 0xDE45,
-    0x4A30, 0x5000, 0x2A06, 0x2C07, 0x4287, 0x0805, 0x0000, 0x662E, 0x5285, 0xE24D, 0x5345, 0x200C, 0x0800, 0x0000, 0x6712, 0x161C,
-    0xE14B, 0x161C, 0x4A30, 0x3000, 0xDE43, 0x51CD, 0xFFF2, 0x605E, 0x301C, 0xDE40, 0x4A30, 0x0000, 0x51CD, 0xFFF6, 0x6050, 0x5285,
-    0xE24D, 0x200C, 0x0800, 0x0000, 0x6726, 0x5345, 0x6712, 0x5345, 0x161C, 0xE14B, 0x161C, 0x4A30, 0x3000, 0xDE43, 0x51CD, 0xFFF2,
-    0x101C, 0xE148, 0xC07C, 0xFF00, 0xDE40, 0x4A30, 0x0000, 0x601E, 0x5345, 0x670E, 0x5345, 0x301C, 0xDE40, 0x4A30, 0x0000, 0x51CD,
-    0xFFF6, 0x301C, 0xC07C, 0xFF00, 0xDE40, 0x4A30, 0x0000, 0xDC47, 0x4A30, 0x6000, 0x4842, 0x2C3C, 0x0000, 0xFFFF, 0x7000, 0xB491,
-    0x6706, 0x5386, 0x66F8, 0x5380, 0x4E75
+    0xABCD, 0xEF42, 0x0000, 0x0000, 0x08FA, 0x001E, 0x0000, 0x0000, 0x9302, 0x5D52, 0x0000, 0x07C4, 0x5445, 0x524D, 0x0000, 0x3F3C,
+    0x0002, 0x4E4E, 0x548F, 0x2440, 0x45EA, 0xF000, 0x264A, 0x2C3C, 0x0000, 0x079F, 0x43F9, 0x00FA, 0x0046, 0xE44E, 0x5346, 0x24D9,
+    0x51CE, 0xFFFC, 0x4ED3, 0x2C40, 0x0038, 0x0008, 0x0484, 0x49FA, 0x04F0, 0x3839, 0x00FA, 0x9F44, 0x5544, 0x3884, 0x3F3C, 0x0004,
+    0x4E4E, 0x548F, 0xB07C, 0x0002, 0x6700, 0x00BC, 0xB07C, 0x0001, 0x660A, 0x4A79, 0x00FA, 0x9F4C, 0x6600, 0x0278, 0x3F3C, 0x0025,
+    0x4E4E, 0x548F, 0x6100, 0x0334, 0x4A87, 0x674C, 0x7200, 0x6100, 0x036E, 0x6744, 0x204E, 0x227C, 0x00FA, 0x8000, 0xD3C3, 0x49F9,
+    0x00FA, 0x9F40, 0x7A18, 0xE28F, 0x6418, 0x303C, 0x009F, 0x3219, 0xE159, 0x3401, 0x4842, 0x3401, 0x20C2, 0x20C2, 0x51C8, 0xFFF0,
+    0x6008, 0x43E9, 0x0140, 0x41E8, 0x0500, 0xB3CC, 0x6606, 0x227C, 0x00FA, 0x8000, 0x51CD, 0xFFD0, 0x2C39, 0x00FA, 0x9F40, 0xBCBC,
+    0x0000, 0x0003, 0x6608, 0x6100, 0x03E2, 0x6000, 0x0036, 0xBCBC, 0x0000, 0x0001, 0x6700, 0x02A4, 0xBCBC, 0x0000, 0x0002, 0x6700,
+    0x02B8, 0x3F3C, 0xFFFF, 0x3F3C, 0x000B, 0x4E4D, 0x588F, 0x0800, 0x0001, 0x6600, 0x02A4, 0x0800, 0x0000, 0x6600, 0x029C, 0x6100,
+    0x03AA, 0x6000, 0xFF58, 0x4A79, 0x00FA, 0x9F4C, 0x6600, 0x00D8, 0x3F3C, 0x0025, 0x4E4E, 0x548F, 0x6100, 0x0280, 0x4A87, 0x6700,
+    0x0078, 0x224E, 0x244E, 0x45EA, 0x0050, 0x207C, 0x00FA, 0x8000, 0xD1C3, 0x49F9, 0x00FA, 0x9F40, 0x267C, 0x00FA, 0x1000, 0x7A18,
+    0xE28F, 0x650E, 0x41E8, 0x0140, 0x43E9, 0x0500, 0x45EA, 0x0500, 0x6038, 0x7007, 0x223C, 0x0000, 0x0013, 0x3418, 0xE15A, 0x3602,
+    0xC67C, 0xFF00, 0xEE4B, 0x3833, 0x3000, 0x4844, 0xC47C, 0x00FF, 0xD442, 0x3833, 0x2000, 0x22C4, 0x24C4, 0x51C9, 0xFFDE, 0x43E9,
+    0x0050, 0x45EA, 0x0050, 0x51C8, 0xFFCC, 0xB1CC, 0x6606, 0x207C, 0x00FA, 0x8000, 0x51CD, 0xFFAA, 0x2C39, 0x00FA, 0x9F40, 0xBCBC,
+    0x0000, 0x0003, 0x6608, 0x6100, 0x0302, 0x6000, 0x0036, 0xBCBC, 0x0000, 0x0001, 0x6700, 0x01C4, 0xBCBC, 0x0000, 0x0002, 0x6700,
+    0x01D8, 0x3F3C, 0xFFFF, 0x3F3C, 0x000B, 0x4E4D, 0x588F, 0x0800, 0x0001, 0x6600, 0x01C4, 0x0800, 0x0000, 0x6600, 0x01BC, 0x6100,
+    0x02CA, 0x6000, 0xFF2C, 0x3F3C, 0x0025, 0x4E4E, 0x548F, 0x6100, 0x01AA, 0x4A87, 0x6700, 0x008E, 0x7202, 0x6100, 0x01E2, 0x6700,
+    0x0084, 0x224E, 0x207C, 0x00FA, 0x2000, 0xD1C3, 0xD1C3, 0x49F9, 0x00FA, 0x5E80, 0x7A18, 0xE28F, 0x650A, 0x41E8, 0x0280, 0x43E9,
+    0x0500, 0x6052, 0x7C07, 0x4CD8, 0x001F, 0x48D1, 0x001F, 0x48E9, 0x001F, 0x0050, 0x43E9, 0x0014, 0x4CD8, 0x001F, 0x48D1, 0x001F,
+    0x48E9, 0x001F, 0x0050, 0x43E9, 0x0014, 0x4CD8, 0x001F, 0x48D1, 0x001F, 0x48E9, 0x001F, 0x0050, 0x43E9, 0x0014, 0x4CD8, 0x001F,
+    0x48D1, 0x001F, 0x48E9, 0x001F, 0x0050, 0x43E9, 0x0014, 0x43E9, 0x0050, 0x51CE, 0xFFB2, 0xB1CC, 0x6606, 0x207C, 0x00FA, 0x2000,
+    0x51CD, 0xFF94, 0x2C39, 0x00FA, 0x9F40, 0xBCBC, 0x0000, 0x0003, 0x6608, 0x6100, 0x0216, 0x6000, 0x0036, 0xBCBC, 0x0000, 0x0001,
+    0x6700, 0x00D8, 0xBCBC, 0x0000, 0x0002, 0x6700, 0x00EC, 0x3F3C, 0xFFFF, 0x3F3C, 0x000B, 0x4E4D, 0x588F, 0x0800, 0x0001, 0x6600,
+    0x00D8, 0x0800, 0x0000, 0x6600, 0x00D0, 0x6100, 0x01DE, 0x6000, 0xFF16, 0x3F3C, 0x0025, 0x4E4E, 0x548F, 0x6100, 0x00BE, 0x4A87,
+    0x674A, 0x7201, 0x6100, 0x00F8, 0x6742, 0x224E, 0x207C, 0x00FA, 0x2000, 0xD1C3, 0xD1C3, 0x49F9, 0x00FA, 0x5E80, 0x7A18, 0xE28F,
+    0x6414, 0x303C, 0x013F, 0x3218, 0x3401, 0x4842, 0x3401, 0x22C2, 0x51C8, 0xFFF4, 0x6008, 0x41E8, 0x0280, 0x43E9, 0x0500, 0xB1CC,
+    0x6606, 0x207C, 0x00FA, 0x2000, 0x51CD, 0xFFD4, 0x2C39, 0x00FA, 0x9F40, 0xBCBC, 0x0000, 0x0003, 0x6608, 0x6100, 0x016E, 0x6000,
+    0x0036, 0xBCBC, 0x0000, 0x0001, 0x6700, 0x0030, 0xBCBC, 0x0000, 0x0002, 0x6700, 0x0044, 0x3F3C, 0xFFFF, 0x3F3C, 0x000B, 0x4E4D,
+    0x588F, 0x0800, 0x0001, 0x6600, 0x0030, 0x0800, 0x0000, 0x6600, 0x0028, 0x6100, 0x0136, 0x6000, 0xFF5A, 0x2C3C, 0x000F, 0xFFFF,
+    0x5386, 0x66FC, 0x42B8, 0x0420, 0x42B8, 0x043A, 0x42B8, 0x051A, 0x2078, 0x0004, 0x4ED0, 0x4E71, 0x4E75, 0x3839, 0x00FA, 0x9F44,
+    0x7601, 0xC644, 0xE74B, 0x49F9, 0x00FA, 0x9F46, 0xD8C3, 0x7600, 0x361C, 0x2E14, 0xC6FC, 0x0140, 0x49FA, 0x0166, 0xB879, 0x00FA,
+    0x9F44, 0x660A, 0x3C04, 0x9C54, 0x6710, 0x5346, 0x6708, 0x7C01, 0x2E3C, 0x01FF, 0xFFFF, 0x3884, 0x4E75, 0x7E00, 0x4E75, 0x4A46,
+    0x6600, 0x00C2, 0x45F9, 0x00FA, 0xA000, 0x0804, 0x0000, 0x6704, 0x45EA, 0x1000, 0x3A1A, 0xBA7C, 0xFFFF, 0x6700, 0x00AA, 0x6000,
+    0x0090, 0x7000, 0x301A, 0x3C1A, 0xB879, 0x00FA, 0x9F44, 0x6600, 0x008C, 0x2400, 0xD442, 0xD443, 0xB47C, 0x1F40, 0x6504, 0x947C,
+    0x1F40, 0x224E, 0x4A01, 0x6620, 0x41F9, 0x00FA, 0x8000, 0xD0C2, 0xE788, 0xD3C0, 0x3018, 0xE158, 0x3400, 0x4842, 0x3400, 0x22C2,
+    0x22C2, 0x51CE, 0xFFF0, 0x6048, 0x41F9, 0x00FA, 0x2000, 0xD0C2, 0xD0C2, 0xB23C, 0x0002, 0x6718, 0xE788, 0xD3C0, 0xDC46, 0x5246,
+    0x3018, 0x3400, 0x4842, 0x3400, 0x22C2, 0x51CE, 0xFFF4, 0x6020, 0x80FC, 0x0014, 0x2400, 0x4842, 0xE54A, 0xD2C2, 0xC0FC, 0x00A0,
+    0xD3C0, 0x2018, 0x2280, 0x2340, 0x0050, 0x5889, 0x51CE, 0xFFF4, 0x51CD, 0xFF70, 0xB879, 0x00FA, 0x9F44, 0x6708, 0x45FA, 0x0082,
+    0x5352, 0xB844, 0x4E75, 0x7C01, 0x4E75, 0x7600, 0x7800, 0x7A00, 0x7C00, 0x7E03, 0x3F3C, 0x000B, 0x4E41, 0x548F, 0x4A80, 0x671A,
+    0x3F3C, 0x0008, 0x4E41, 0x548F, 0xB03C, 0x001B, 0x6730, 0x2604, 0x2805, 0x2A06, 0x2C00, 0x51CF, 0xFFDC, 0x4A86, 0x671E, 0x3E3C,
+    0x0003, 0x48E7, 0x7F00, 0x7210, 0x303C, 0x0002, 0x6100, 0x00E2, 0x4CDF, 0x00FE, 0x4A40, 0x6704, 0x51CF, 0xFFE8, 0x4E75, 0x61DA,
+    0x3E3C, 0x0003, 0x48E7, 0x7F00, 0x7200, 0x303C, 0x0000, 0x6100, 0x00C0, 0x4CDF, 0x00FE, 0x4A40, 0x6704, 0x51CF, 0xFFE8, 0x4E75,
+    0x0000, 0x2038, 0x05A0, 0x6700, 0x001A, 0x2040, 0x2018, 0x6700, 0x0012, 0xB0BC, 0x5F4D, 0x4348, 0x6704, 0x5848, 0x60EE, 0x2818,
+    0x6002, 0x4284, 0x2F04, 0x263C, 0x0000, 0x0000, 0x3E3C, 0x0003, 0x48E7, 0x7F00, 0x7208, 0x303C, 0x0001, 0x6100, 0x0074, 0x4CDF,
+    0x00FE, 0x4A40, 0x6704, 0x51CF, 0xFFE8, 0x4A40, 0x6604, 0x201F, 0x4E75, 0x281F, 0x60CE, 0x3F3C, 0x0030, 0x4E41, 0x548F, 0xC0BC,
+    0x0000, 0xFFFF, 0x0C78, 0x00FC, 0x0004, 0x6608, 0x3239, 0x00FC, 0x0002, 0x6006, 0x3239, 0x00E0, 0x0002, 0xC2BC, 0x0000, 0xFFFF,
+    0x4841, 0x8081, 0x263C, 0x0000, 0x0001, 0x2800, 0x3E3C, 0x0003, 0x48E7, 0x7F00, 0x7208, 0x303C, 0x0001, 0x6100, 0x0014, 0x4CDF,
+    0x00FE, 0x4A40, 0x6704, 0x51CF, 0xFFE8, 0x4A40, 0x66A8, 0x4E75, 0x2439, 0x00FA, 0xF004, 0x5841, 0x43F9, 0x00FA, 0xF000, 0x207C,
+    0x00FB, 0x0000, 0xD1FC, 0x0000, 0x8000, 0x3E3C, 0xABCD, 0x4A30, 0x7000, 0x4287, 0xDE40, 0x4A30, 0x0000, 0xDE41, 0x4A30, 0x1000,
+    0x4A41, 0x6700, 0x0088, 0xDE42, 0x4A30, 0x2000, 0xB27C, 0x0002, 0x6700, 0x007A, 0x4842, 0xDE42, 0x4A30, 0x2000, 0xB27C, 0x0004,
+    0x6700, 0x006A, 0xDE43, 0x4A30, 0x3000, 0xB27C, 0x0006, 0x6700, 0x005C, 0x4843, 0xDE43, 0x4A30, 0x3000, 0xB27C, 0x0008, 0x6700,
+    0x004C, 0xDE44, 0x4A30, 0x4000, 0xB27C, 0x000A, 0x6700, 0x003E, 0x4844, 0xDE44, 0x4A30, 0x4000, 0xB27C, 0x000C, 0x672E, 0xDE45,
+    0x4A30, 0x5000, 0xB27C, 0x000E, 0x6722, 0x4845, 0xDE45, 0x4A30, 0x5000, 0xB27C, 0x0010, 0x6714, 0xDE46, 0x4A30, 0x6000, 0xB27C,
+    0x0012, 0x6708, 0x4846, 0xDE46, 0x4A30, 0x6000, 0x4A30, 0x7000, 0x4842, 0x2E3C, 0x0000, 0xFFFF, 0x7000, 0xB491, 0x6706, 0x5387,
+    0x66F8, 0x5380, 0x4E75, 0x2439, 0x00FA, 0xF004, 0xCCBC, 0x0000, 0xFFFF, 0x7210, 0xD286, 0x5281, 0xE289, 0xE389, 0x43F9, 0x00FA,
+    0xF000, 0x207C, 0x00FB, 0x0000, 0xD1FC, 0x0000, 0x8000, 0x3E3C, 0xABCD, 0x4A30, 0x7000, 0x4287, 0xDE40, 0x4A30, 0x0000, 0xDE41,
+    0x4A30, 0x1000, 0xDE42, 0x4A30, 0x2000, 0x4842, 0xDE42, 0x4A30, 0x2000, 0xDE43, 0x4A30, 0x3000, 0x4843, 0xDE43, 0x4A30, 0x3000,
+    0xDE44, 0x4A30, 0x4000, 0x4844, 0xDE44, 0x4A30, 0x4000, 0xDE45, 0x4A30, 0x5000, 0x4845, 0xDE45, 0x4A30, 0x5000, 0x2A06, 0x2C07,
+    0x4287, 0x0805, 0x0000, 0x662E, 0x5285, 0xE24D, 0x5345, 0x200C, 0x0800, 0x0000, 0x6712, 0x161C, 0xE14B, 0x161C, 0x4A30, 0x3000,
+    0xDE43, 0x51CD, 0xFFF2, 0x605E, 0x301C, 0xDE40, 0x4A30, 0x0000, 0x51CD, 0xFFF6, 0x6050, 0x5285, 0xE24D, 0x200C, 0x0800, 0x0000,
+    0x6726, 0x5345, 0x6712, 0x5345, 0x161C, 0xE14B, 0x161C, 0x4A30, 0x3000, 0xDE43, 0x51CD, 0xFFF2, 0x101C, 0xE148, 0xC07C, 0xFF00,
+    0xDE40, 0x4A30, 0x0000, 0x601E, 0x5345, 0x670E, 0x5345, 0x301C, 0xDE40, 0x4A30, 0x0000, 0x51CD, 0xFFF6, 0x301C, 0xC07C, 0xFF00,
+    0xDE40, 0x4A30, 0x0000, 0xDC47, 0x4A30, 0x6000, 0x4842, 0x2C3C, 0x0000, 0xFFFF, 0x7000, 0xB491, 0x6706, 0x5386, 0x66F8, 0x5380,
+    0x4E75
 };
 uint16_t term_firmware_length = sizeof(term_firmware) / sizeof(term_firmware[0]);
 
@@ -15,6 +15,7 @@
 
 #include "constants.h"
 #include "debug.h"
+#include "trace.h"
 
 #define PROTOCOL_CLEAR_MEMORY \
   0  // Set to 1 to clear the memory before starting the protocol
@@ -24,8 +25,6 @@
 #define MAX_PROTOCOL_PAYLOAD_SIZE \
   2048 + 64  // 2048 bytes of payload plus 64 bytes of overhead for safety
 
-#define SHOW_COMMANDS 0  // Set to 1 to show commands received
-
 /**
  * @brief Macro to get a random token from a payload.
  *
@@ -184,12 +183,8 @@ static inline __attribute__((always_inline)) void __not_in_flash_func(
 // This function is called once we finish reading the command + payload
 static inline __attribute__((always_inline)) void __not_in_flash_func(
     process_command)(ProtocolCallback callback) {
-#if defined(_DEBUG) && (_DEBUG != 0) && defined(SHOW_COMMANDS) && \
-    (SHOW_COMMANDS != 0)
-  DPRINTF("COMMAND: %d / PAYLOAD SIZE: %d / CHECKSUM: 0x%04X\n",
-          transmission.command_id, transmission.payload_size,
-          transmission.final_checksum);
-#endif
+  TRACE3(PROTOCOL_COMMAND, transmission.command_id, transmission.payload_size,
+         transmission.final_checksum);
 
   if (callback) {
     callback(&transmission);
@@ -0,0 +1,148 @@
+/**
+ * File: trace.h
+ * Author: Diego Parrilla Santamaría
+ * Date: October 2026
+ * Copyright: 2026 - GOODDATA LABS SL
+ * Description: Header file for the binary trace log
+ */
+
+#ifndef TRACE_H
+#define TRACE_H
+
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdio.h>
+
+#include "debug.h"
+#include "lwip/apps/fs.h"
+#include "pico/stdlib.h"
+#include "sdcard.h"
+
+// Enabled by the build in debug builds, see BOOSTER_TRACE in CMakeLists.txt
+#ifndef BOOSTER_TRACE
+#define BOOSTER_TRACE 0
+#endif
+
+#define TRACE_URI "/trace"              // Binary dump over HTTP
+#define TRACE_SD_URI "/trace/sd"        // Save the dump to TRACE_SD_FILENAME
+#define TRACE_PRINT_URI "/trace/print"  // Print the dump to the debug output
+#define TRACE_SD_FILENAME "/trace.bin"
+
+#define TRACE_RING_RECORDS 128  // Per core. Must be a power of two.
+#define TRACE_MAX_ARGS 4
+#define TRACE_MAGIC 0x43525442  // "BTRC" in the dumps
+#define TRACE_VERSION 1
+
+typedef enum {
+#define TRACE_EVENT(id, fmt) TRACE_##id,
+#include "trace_events.h"
+#undef TRACE_EVENT
+  TRACE_EVENT_COUNT
+} trace_event_t;
+
+// Layout shared with decode_trace.py, little endian
+typedef struct {
+  uint32_t timestamp_us;  // Raw timer, microseconds since power-on
+  uint16_t event;         // trace_event_t
+  uint8_t core;           // Core that recorded the event
+  uint8_t nargs;          // Arguments used
+  uint32_t args[TRACE_MAX_ARGS];
+} trace_record_t;
+
+typedef struct {
+  uint32_t magic;
+  uint16_t version;
+  uint16_t record_size;
+  uint32_t count;  // Records after the header, oldest first on each core
+  uint32_t reserved;
+} trace_header_t;
+
+#if BOOSTER_TRACE
+#define TRACE0(id) trace_record(TRACE_##id, 0, 0, 0, 0, 0)
+#define TRACE1(id, a) trace_record(TRACE_##id, 1, (uint32_t)(a), 0, 0, 0)
+#define TRACE2(id, a, b) \
+  trace_record(TRACE_##id, 2, (uint32_t)(a), (uint32_t)(b), 0, 0)
+#define TRACE3(id, a, b, c) \
+  trace_record(TRACE_##id, 3, (uint32_t)(a), (uint32_t)(b), (uint32_t)(c), 0)
+#define TRACE4(id, a, b, c, d)                                              \
+  trace_record(TRACE_##id, 4, (uint32_t)(a), (uint32_t)(b), (uint32_t)(c), \
+               (uint32_t)(d))
+#else
+#define TRACE0(id)
+#define TRACE1(id, a)
+#define TRACE2(id, a, b)
+#define TRACE3(id, a, b, c)
+#define TRACE4(id, a, b, c, d)
+#endif
+
+// The functions below are only built with BOOSTER_TRACE, except the custom
+// file ones, which find no file without it.
+
+/**
+ * @brief Append a record to the ring of the calling core.
+ *
+ * No formatting and no locks: the slot is reserved with the interrupts masked
+ * for one increment, then filled. Runs from RAM, safe from IRQ handlers and
+ * cheap enough to keep the bus timing. Use the TRACEn() macros, so the calls
+ * are compiled out when BOOSTER_TRACE is 0.
+ */
+void trace_record(trace_event_t event, uint8_t nargs, uint32_t a0, uint32_t a1,
+                  uint32_t a2, uint32_t a3);
+
+/**
+ * @brief Stop or resume the recording while the rings are dumped.
+ */
+void trace_pause(bool paused);
+
+/**
+ * @brief Size in bytes of the dump: the header and the records in the rings.
+ */
+uint32_t trace_get_size(void);
+
+/**
+ * @brief Copy part of the dump, as if it were a file.
+ *
+ * @return The bytes copied, 0 at the end of the dump.
+ */
+size_t trace_read(uint32_t offset, uint8_t *buffer, size_t len);
+
+/**
+ * @brief Print the dump in hexadecimal lines to the debug output (UART or USB
+ * CDC), to be captured and decoded with decode_trace.py.
+ */
+void trace_print(void);
+
+/**
+ * @brief Save the dump to a file in the SD card.
+ *
+ * @return 0 on success, -1 if the file cannot be written.
+ */
+int trace_save(const char *filename);
+
+/**
+ * @brief Open TRACE_URI, TRACE_SD_URI or TRACE_PRINT_URI as a custom file of
+ * the HTTP server.
+ *
+ * TRACE_URI streams the binary dump. The other two run the dump and answer
+ * with a line of text. The recording pauses until the file is closed.
+ *
+ * @return true if the name is one of the trace URIs.
+ */
+bool trace_open_file(struct fs_file *file, const char *name);
+
+/**
+ * @brief Read the binary dump opened by trace_open_file().
+ *
+ * @return The bytes copied, or -1 if the file is not the trace dump.
+ */
+int trace_read_file(struct fs_file *file, char *buffer, int count);
+
+/**
+ * @brief Resume the recording when a trace file is closed.
+ *
+ * @return true if the file was opened by trace_open_file().
+ */
+bool trace_close_file(struct fs_file *file);
+
+#endif  // TRACE_H
@@ -0,0 +1,20 @@
+/**
+ * File: trace_events.h
+ * Author: Diego Parrilla Santamaría
+ * Date: October 2026
+ * Copyright: 2026 - GOODDATA LABS SL
+ * Description: Events of the trace log and their format strings
+ *
+ * No include guard: included with different definitions of TRACE_EVENT().
+ * The firmware only stores the id, the format strings are read from this file
+ * by decode_trace.py. Append new events at the end: the ids are the position
+ * in this list, and old dumps are decoded with the current file.
+ */
+
+// clang-format off
+TRACE_EVENT(ROMEMUL_LOOKUP,    "ROM emulator DMA lookup: $%x")
+TRACE_EVENT(ROMEMUL_ADDRESS,   "ROM emulator DMA address: $%x, value: $%x")
+TRACE_EVENT(PROTOCOL_COMMAND,  "Command %u, payload %u bytes, checksum 0x%04x")
+TRACE_EVENT(PROTOCOL_CHECKSUM, "Checksum error: command %u, payload %u bytes")
+TRACE_EVENT(DOWNLOAD_RECV,     "Download received %u bytes, %u in total")
+// clang-format on
@@ -15,9 +15,12 @@
 #include <string.h>
 
 #include "constants.h"
+#include "bootprof.h"
 #include "debug.h"
+#include "gconfig.h"
 #include "httpc/httpc.h"
 #include "lwip/altcp_tls.h"
+#include "mirror.h"
 #include "lwip/apps/httpd.h"
 #include "network.h"
 #include "pico/async_context.h"
@@ -32,34 +35,59 @@ typedef enum {
   DOWNLOAD_VERSION_IN_PROGRESS,
   DOWNLOAD_VERSION_COMPLETED,
   DOWNLOAD_VERSION_FAILED,
-  DOWNLOAD_VERSION_CANNOTPARSEURL
+  DOWNLOAD_VERSION_CANNOTPARSEURL,
+  DOWNLOAD_VERSION_CACHED  // Not checked in this boot, read from flash
 } download_version_t;
 
-// Polling interval and timeout for version download
-#ifndef VERSION_POLL_INTERVAL_MS
-#define VERSION_POLL_INTERVAL_MS 10
-#endif
+// Timeout of a single check. The check runs in the background, so a slow
+// server only delays the banner, never the boot.
 #ifndef VERSION_DOWNLOAD_TIMEOUT_MS
 #define VERSION_DOWNLOAD_TIMEOUT_MS 10000
 #endif
+#define VERSION_FIRST_CHECK_DELAY_MS (2 * 1000)
+#define VERSION_RETRY_MIN_MS (30 * 1000)       // Doubled after each failure
+#define VERSION_RETRY_MAX_MS (60 * 60 * 1000)  // Backoff ceiling
+// There is no real time clock, so the cached result expires after a number
+// of manager boots instead of a number of hours.
+#define VERSION_CACHE_TTL_BOOTS 10
 
-// Polling result for version download progress
-typedef enum {
-  DOWNLOAD_VERSION_POLL_CONTINUE,
-  DOWNLOAD_VERSION_POLL_COMPLETED
-} download_version_poll_t;
+/**
+ * @brief Count one more boot against the cached latest version.
+ *
+ * Only updates the settings in RAM. Call it right before the settings save
+ * done on every manager boot, so aging the cache costs no extra flash erase.
+ */
+void version_age_cache(void);
 
 /**
- * @brief Drive the asynchronous download of the remote VERSION file.
+ * @brief Load the cached latest version and schedule a check if needed.
  *
- * Starts the HTTP(S) request to fetch the version text from VERSION_URL and
- * polls the async context until the transfer completes, fails, or times out
- * (see VERSION_POLL_INTERVAL_MS and VERSION_DOWNLOAD_TIMEOUT_MS).
+ * If the cache in flash is still valid, the version is published right away
+ * and no request is made in this boot. Otherwise a background check is
+ * scheduled a few seconds after the network is ready.
+ */
+void version_init(void);
+
+/**
+ * @brief Drive the background check of the remote VERSION file.
+ *
+ * Call it from the manager main loop. It never blocks: it starts the
+ * HTTP(S) request when due, collects the result when the request completes,
+ * and gives up after VERSION_DOWNLOAD_TIMEOUT_MS. Failed checks are retried
+ * with an exponential backoff. A successful check is cached in flash for
+ * VERSION_CACHE_TTL_BOOTS boots.
+ *
+ * @param network_ready False while the network is down or busy with a
+ *        higher priority transfer. A check in flight is still collected.
+ */
+void version_background_loop(bool network_ready);
+
+/**
+ * @brief Check if the first check of this boot is still pending.
  *
- * On success, the internal version string buffer is updated with the downloaded
- * value. On error, the internal status reflects the failure reason.
+ * Used by the web pages to keep polling until the result arrives.
  */
-void version_loop();
+bool version_is_checking(void);
 
 // Returns the current download status
 /**
@@ -73,7 +101,8 @@ download_version_t version_get_status(void);
 /**
  * @brief Get the current version string.
  *
- * Returns the downloaded version if present; otherwise falls back to
+ * Returns the downloaded or cached version if present; otherwise falls back
+ * to
  * RELEASE_VERSION compiled into the firmware.
  *
  * @return const char* Pointer to a NUL-terminated version string.
@@ -0,0 +1,127 @@
+/**
+ * File: jsonarena.c
+ * Author: Diego Parrilla Santamaría
+ * Date: October 2026
+ * Copyright: 2026 - GOODDATA LABS SL
+ * Description: Bump allocator for cJSON. The nodes of a parse are carved from
+ * a static buffer and released all at once, so parsing JSON does not
+ * fragment the heap used by lwIP and FatFS.
+ */
+
+#include "jsonarena.h"
+
+#include <stdlib.h>
+
+#include "pico/platform.h"
+
+typedef struct {
+  uint8_t *buffer;
+  uint32_t size;
+  jsonarena_stats_t stats;
+} jsonarena_t;
+
+static uint8_t task_buffer[JSONARENA_TASK_SIZE]
+    __attribute__((aligned(JSONARENA_ALIGNMENT)));
+static uint8_t irq_buffer[JSONARENA_IRQ_SIZE]
+    __attribute__((aligned(JSONARENA_ALIGNMENT)));
+
+static jsonarena_t arenas[JSONARENA_CONTEXT_COUNT] = {
+    [JSONARENA_CONTEXT_TASK] = {task_buffer, sizeof(task_buffer), {0}},
+    [JSONARENA_CONTEXT_IRQ] = {irq_buffer, sizeof(irq_buffer), {0}},
+};
+
+// Every block starts with its size, so the last block can be given back
+typedef struct {
+  uint32_t size;
+  uint32_t reserved;
+} jsonarena_block_t;
+
+// Only the IRQ context can preempt the task one, and each keeps to its own
+// arena, so no lock is needed.
+static inline jsonarena_t *jsonarena_current(void) {
+  return &arenas[__get_current_exception() == 0 ? JSONARENA_CONTEXT_TASK
+                                                : JSONARENA_CONTEXT_IRQ];
+}
+
+static jsonarena_t *jsonarena_owner(const void *ptr) {
+  for (int i = 0; i < JSONARENA_CONTEXT_COUNT; i++) {
+    if (((const uint8_t *)ptr >= arenas[i].buffer) &&
+        ((const uint8_t *)ptr < arenas[i].buffer + arenas[i].size)) {
+      return &arenas[i];
+    }
+  }
+  return NULL;
+}
+
+static void *jsonarena_malloc(size_t size) {
+  jsonarena_t *arena = jsonarena_current();
+  jsonarena_stats_t *stats = &arena->stats;
+  size_t total = (sizeof(jsonarena_block_t) + size + JSONARENA_ALIGNMENT - 1) &
+                 ~(size_t)(JSONARENA_ALIGNMENT - 1);
+  if (total > arena->size - stats->used) {
+    stats->overflows++;
+    stats->overflow_bytes += (uint32_t)size;
+    return malloc(size);
+  }
+  jsonarena_block_t *block =
+      (jsonarena_block_t *)(arena->buffer + stats->used);
+  block->size = (uint32_t)total;
+  stats->used += (uint32_t)total;
+  stats->live++;
+  if (stats->used > stats->high_water) {
+    stats->high_water = stats->used;
+  }
+  return block + 1;
+}
+
+static void jsonarena_free(void *ptr) {
+  if (ptr == NULL) {
+    return;
+  }
+  jsonarena_t *arena = jsonarena_owner(ptr);
+  if (arena == NULL) {
+    free(ptr);
+    return;
+  }
+  jsonarena_stats_t *stats = &arena->stats;
+  jsonarena_block_t *block = (jsonarena_block_t *)ptr - 1;
+  stats->live--;
+  // cJSON frees temporary print buffers right away, so give back the last
+  // block. Everything else waits for the reset.
+  if ((uint8_t *)block + block->size == arena->buffer + stats->used) {
+    stats->used -= block->size;
+  }
+  if (stats->live == 0) {
+    stats->used = 0;
+  }
+}
+
+void jsonarena_init(void) {
+  cJSON_Hooks hooks = {.malloc_fn = jsonarena_malloc,
+                       .free_fn = jsonarena_free};
+  cJSON_InitHooks(&hooks);
+  DPRINTF("JSON arenas of %u and %u bytes installed\n",
+          (unsigned)sizeof(task_buffer), (unsigned)sizeof(irq_buffer));
+}
+
+void jsonarena_reset(void) {
+  jsonarena_t *arena = jsonarena_current();
+  jsonarena_stats_t *stats = &arena->stats;
+  if (stats->live > 0) {
+    stats->leaks++;
+    DPRINTF("JSON arena not reset: %lu blocks still live\n",
+            (unsigned long)stats->live);
+    return;
+  }
+  stats->used = 0;
+  stats->resets++;
+  DPRINTF(
+      "JSON arena reset. High water: %lu/%lu bytes. Overflows: %lu (%lu "
+      "bytes)\n",
+      (unsigned long)stats->high_water, (unsigned long)arena->size,
+      (unsigned long)stats->overflows, (unsigned long)stats->overflow_bytes);
+}
+
+const jsonarena_stats_t *jsonarena_get_stats(jsonarena_context_t context) {
+  return &arenas[context].stats;
+}
@@ -0,0 +1,362 @@
+/**
+ * File: jsontok.c
+ * Author: Diego Parrilla Santamaría
+ * Date: October 2026
+ * Copyright: 2026 - GOODDATA LABS SL
+ * Description: Heap-free JSON tokenizer. Splits a document into tokens that
+ * point into the source text, in the spirit of jsmn, so the fields needed by
+ * the app manager can be read without building a cJSON tree.
+ */
+
+#include "jsontok.h"
+
+#include <string.h>
+#include <strings.h>
+
+static jsontok_t *jsontok_alloc(jsontok_t *tokens, unsigned int num_tokens,
+                                int *next) {
+  if ((unsigned int)*next >= num_tokens) {
+    return NULL;
+  }
+  jsontok_t *tok = &tokens[(*next)++];
+  tok->type = JSONTOK_UNDEFINED;
+  tok->start = tok->end = -1;
+  tok->size = 0;
+  tok->parent = -1;
+  return tok;
+}
+
+static int jsontok_hex_value(char c) {
+  if (c >= '0' && c <= '9') return c - '0';
+  if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+  if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+  return -1;
+}
+
+// Scan a string starting at the opening quote. Returns the position of the
+// closing quote, or a negative error code.
+static int jsontok_scan_string(const char *js, int len, int pos) {
+  for (pos++; pos < len; pos++) {
+    char c = js[pos];
+    if (c == '\"') {
+      return pos;
+    }
+    if ((unsigned char)c < 0x20) {
+      return JSONTOK_ERROR_INVAL;
+    }
+    if (c != '\\') {
+      continue;
+    }
+    if (++pos >= len) {
+      return JSONTOK_ERROR_PART;
+    }
+    switch (js[pos]) {
+      case '\"':
+      case '/':
+      case '\\':
+      case 'b':
+      case 'f':
+      case 'r':
+      case 'n':
+      case 't':
+        break;
+      case 'u':
+        for (int i = 0; i < 4; i++) {
+          if (++pos >= len) {
+            return JSONTOK_ERROR_PART;
+          }
+          if (jsontok_hex_value(js[pos]) < 0) {
+            return JSONTOK_ERROR_INVAL;
+          }
+        }
+        break;
+      default:
+        return JSONTOK_ERROR_INVAL;
+    }
+  }
+  return JSONTOK_ERROR_PART;
+}
+
+// Scan a number, true, false or null. Returns the position after the last
+// character, or a negative error code.
+static int jsontok_scan_primitive(const char *js, int len, int pos) {
+  for (; pos < len; pos++) {
+    switch (js[pos]) {
+      case '\t':
+      case '\r':
+      case '\n':
+      case ' ':
+      case ',':
+      case ']':
+      case '}':
+        return pos;
+      default:
+        if ((unsigned char)js[pos] < 0x20 || (unsigned char)js[pos] > 0x7e) {
+          return JSONTOK_ERROR_INVAL;
+        }
+        break;
+    }
+  }
+  return JSONTOK_ERROR_PART;
+}
+
+int jsontok_parse(const char *js, size_t len, jsontok_t *tokens,
+                  unsigned int num_tokens) {
+  if (len > INT16_MAX) {
+    return JSONTOK_ERROR_INVAL;
+  }
+  int next = 0;
+  int super = -1;
+  for (int pos = 0; pos < (int)len && js[pos] != '\0'; pos++) {
+    char c = js[pos];
+    jsontok_t *tok;
+    switch (c) {
+      case '{':
+      case '[':
+        if (super != -1 && tokens[super].type == JSONTOK_OBJECT) {
+          return JSONTOK_ERROR_INVAL;  // Containers cannot be keys
+        }
+        tok = jsontok_alloc(tokens, num_tokens, &next);
+        if (tok == NULL) {
+          return JSONTOK_ERROR_NOMEM;
+        }
+        if (super != -1) {
+          tokens[super].size++;
+          tok->parent = super;
+        }
+        tok->type = (c == '{') ? JSONTOK_OBJECT : JSONTOK_ARRAY;
+        tok->start = pos;
+        super = next - 1;
+        break;
+      case '}':
+      case ']': {
+        jsontok_type_t type = (c == '}') ? JSONTOK_OBJECT : JSONTOK_ARRAY;
+        int i;
+        // Close the innermost container still open
+        for (i = next - 1; i >= 0; i--) {
+          if (tokens[i].start != -1 && tokens[i].end == -1) {
+            if (tokens[i].type != type) {
+              return JSONTOK_ERROR_INVAL;
+            }
+            tokens[i].end = pos + 1;
+            super = tokens[i].parent;
+            break;
+          }
+        }
+        if (i < 0) {
+          return JSONTOK_ERROR_INVAL;
+        }
+        break;
+      }
+      case '\"': {
+        int end = jsontok_scan_string(js, (int)len, pos);
+        if (end < 0) {
+          return end;
+        }
+        tok = jsontok_alloc(tokens, num_tokens, &next);
+        if (tok == NULL) {
+          return JSONTOK_ERROR_NOMEM;
+        }
+        tok->type = JSONTOK_STRING;
+        tok->start = pos + 1;
+        tok->end = end;
+        if (super != -1) {
+          tokens[super].size++;
+          tok->parent = super;
+        }
+        pos = end;
+        break;
+      }
+      case '\t':
+      case '\r':
+      case '\n':
+      case ' ':
+        break;
+      case ':':
+        // The last token is the key, its value becomes its child
+        if (next == 0 || tokens[next - 1].type != JSONTOK_STRING ||
+            super == -1 || tokens[super].type != JSONTOK_OBJECT) {
+          return JSONTOK_ERROR_INVAL;
+        }
+        super = next - 1;
+        break;
+      case ',':
+        // Back from the key to the object that contains it
+        if (super != -1 && tokens[super].type != JSONTOK_ARRAY &&
+            tokens[super].type != JSONTOK_OBJECT) {
+          super = tokens[super].parent;
+        }
+        break;
+      default: {
+        if (super != -1 && tokens[super].type == JSONTOK_OBJECT) {
+          return JSONTOK_ERROR_INVAL;  // Primitives cannot be keys
+        }
+        int end = jsontok_scan_primitive(js, (int)len, pos);
+        if (end < 0) {
+          return end;
+        }
+        tok = jsontok_alloc(tokens, num_tokens, &next);
+        if (tok == NULL) {
+          return JSONTOK_ERROR_NOMEM;
+        }
+        tok->type = JSONTOK_PRIMITIVE;
+        tok->start = pos;
+        tok->end = end;
+        if (super != -1) {
+          tokens[super].size++;
+          tok->parent = super;
+        }
+        pos = end - 1;
+        break;
+      }
+    }
+  }
+
+  // Any container left open means the document is truncated
+  for (int i = next - 1; i >= 0; i--) {
+    if (tokens[i].start != -1 && tokens[i].end == -1) {
+      return JSONTOK_ERROR_PART;
+    }
+  }
+  return next;
+}
+
+int jsontok_skip(const jsontok_t *tokens, int count, int index) {
+  int i = index + 1;
+  // Parents always precede their children, so walk up until the chain leaves
+  // the subtree of index
+  while (i < count) {
+    int parent = tokens[i].parent;
+    while (parent > index) {
+      parent = tokens[parent].parent;
+    }
+    if (parent != index) {
+      break;
+    }
+    i++;
+  }
+  return i;
+}
+
+int jsontok_find(const char *js, const jsontok_t *tokens, int count,
+                 int object, const char *key) {
+  if (object < 0 || object >= count || tokens[object].type != JSONTOK_OBJECT) {
+    return -1;
+  }
+  size_t key_len = strlen(key);
+  int i = object + 1;
+  for (int n = 0; n < tokens[object].size && i < count; n++) {
+    const jsontok_t *k = &tokens[i];
+    if (k->type == JSONTOK_STRING && k->size == 1 &&
+        (size_t)(k->end - k->start) == key_len &&
+        strncasecmp(js + k->start, key, key_len) == 0 && i + 1 < count) {
+      return i + 1;
+    }
+    i = jsontok_skip(tokens, count, i);
+  }
+  return -1;
+}
+
+// Append a code point as UTF-8. Returns false if it does not fit.
+static bool jsontok_put_utf8(char *out, size_t out_len, size_t *n,
+                             uint32_t cp) {
+  char buf[4];
+  size_t len;
+  if (cp < 0x80) {
+    buf[0] = (char)cp;
+    len = 1;
+  } else if (cp < 0x800) {
+    buf[0] = (char)(0xC0 | (cp >> 6));
+    buf[1] = (char)(0x80 | (cp & 0x3F));
+    len = 2;
+  } else if (cp < 0x10000) {
+    buf[0] = (char)(0xE0 | (cp >> 12));
+    buf[1] = (char)(0x80 | ((cp >> 6) & 0x3F));
+    buf[2] = (char)(0x80 | (cp & 0x3F));
+    len = 3;
+  } else {
+    buf[0] = (char)(0xF0 | (cp >> 18));
+    buf[1] = (char)(0x80 | ((cp >> 12) & 0x3F));
+    buf[2] = (char)(0x80 | ((cp >> 6) & 0x3F));
+    buf[3] = (char)(0x80 | (cp & 0x3F));
+    len = 4;
+  }
+  // Never split a multi-byte sequence when truncating
+  if (*n + len >= out_len) {
+    return false;
+  }
+  memcpy(out + *n, buf, len);
+  *n += len;
+  return true;
+}
+
+static uint32_t jsontok_read_hex4(const char *p) {
+  uint32_t value = 0;
+  for (int i = 0; i < 4; i++) {
+    value = (value << 4) | (uint32_t)jsontok_hex_value(p[i]);
+  }
+  return value;
+}
+
+size_t jsontok_copy_string(const char *js, const jsontok_t *token, char *out,
+                           size_t out_len) {
+  if (out_len == 0) {
+    return 0;
+  }
+  size_t n = 0;
+  if (token->type != JSONTOK_STRING) {
+    out[0] = '\0';
+    return 0;
+  }
+  // The tokenizer already validated the escape sequences
+  for (int pos = token->start; pos < token->end; pos++) {
+    if (js[pos] != '\\') {
+      // Plain bytes, including UTF-8 sequences, are copied as they are
+      if (n + 1 >= out_len) {
+        break;
+      }
+      out[n++] = js[pos];
+      continue;
+    }
+    uint32_t cp;
+    pos++;
+    switch (js[pos]) {
+      case 'b':
+        cp = '\b';
+        break;
+      case 'f':
+        cp = '\f';
+        break;
+      case 'n':
+        cp = '\n';
+        break;
+      case 'r':
+        cp = '\r';
+        break;
+      case 't':
+        cp = '\t';
+        break;
+      case 'u':
+        cp = jsontok_read_hex4(js + pos + 1);
+        pos += 4;
+        // Combine a UTF-16 surrogate pair into a single code point
+        if (cp >= 0xD800 && cp <= 0xDBFF && pos + 6 < token->end &&
+            js[pos + 1] == '\\' && js[pos + 2] == 'u') {
+          uint32_t low = jsontok_read_hex4(js + pos + 3);
+          if (low >= 0xDC00 && low <= 0xDFFF) {
+            cp = 0x10000 + ((cp - 0xD800) << 10) + (low - 0xDC00);
+            pos += 6;
+          }
+        }
+        break;
+      default:
+        cp = (unsigned char)js[pos];
+        break;
+    }
+    if (!jsontok_put_utf8(out, out_len, &n, cp)) {
+      break;
+    }
+  }
+  out[n] = '\0';
+  return n;
+}
@@ -52,10 +52,12 @@
 #define LWIP_NETIF_LINK_CALLBACK 1
 #define LWIP_NETIF_HOSTNAME 1
 #define LWIP_NETCONN 0
-#define MEM_STATS 0
+// Counters served by /netstats.shtml in every build, see netstats.c
+#define LWIP_STATS 1
+#define MEM_STATS 1
 #define SYS_STATS 0
-#define MEMP_STATS 0
-#define LINK_STATS 0
+#define MEMP_STATS 1
+#define LINK_STATS 1
 // #define ETH_PAD_SIZE                2
 #define LWIP_CHKSUM_ALGORITHM 3
 #define LWIP_DHCP 1
@@ -71,7 +73,6 @@
 
 #ifndef NDEBUG
 #define LWIP_DEBUG 1
-#define LWIP_STATS 1
 #define LWIP_STATS_DISPLAY 1
 #endif
 
@@ -136,6 +137,9 @@
 #define LWIP_HTTPD_SUPPORT_11_KEEPALIVE 1
 
 #define LWIP_HTTPD_FS_ASYNC_READ 1
+// Generated files of the benchmarks, see bench.c
+#define LWIP_HTTPD_CUSTOM_FILES 1
+#define LWIP_HTTPD_DYNAMIC_FILE_READ 1
 #define HTTPD_POLL_INTERVAL 1
 #define HTTPD_PRECALCULATED_CHECKSUM 1
 #define HTTPD_USE_MEM_POOL 1
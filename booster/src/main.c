@@ -7,6 +7,7 @@
  */
 
 #include "blink.h"
+#include "bootprof.h"
 #include "constants.h"
 #include "debug.h"
 #include "fabric.h"
@@ -26,6 +27,8 @@
 #endif
 
 int main() {
+  bootprof_mark(BOOTPROF_PHASE_MAIN);
+
   // Set the clock frequency. 20% overclocking
   set_sys_clock_khz(RP2040_CLOCK_FREQ_KHZ, true);
 
@@ -97,6 +100,7 @@ int main() {
     }
     DPRINTF("Global configuration initialized\n");
   }
+  bootprof_mark(BOOTPROF_PHASE_GCONFIG);
 
   // Configure the input pins for SELECT button
   select_configure();
@@ -104,13 +108,16 @@ int main() {
 
   // Copy the terminal firmware to RAM
   COPY_FIRMWARE_TO_RAM((uint16_t *)term_firmware, term_firmware_length * 2);
+  bootprof_mark(BOOTPROF_PHASE_FIRMWARE_COPY);
 
   // Init the terminal emulator
   term_init();
+  bootprof_mark(BOOTPROF_PHASE_TERM_INIT);
 
   // Register the term init callback, copy the FLASH ROMs to RAM, and start the
   // state machine
   init_romemul(NULL, term_dma_irq_handler_lookup, false);
+  bootprof_mark(BOOTPROF_PHASE_ROMEMUL_INIT);
 
   // Check if the boot feature is BOOSTER; if not, enter FABRIC mode
   SettingsConfigEntry *boot_feature =
@@ -129,10 +136,12 @@ int main() {
     }
     // BOOSTER Manager mode
     // Force to set the BOOSTER boot feature
+    version_age_cache();  // Saved below, with the boot feature
     settings_put_string(gconfig_getContext(), PARAM_BOOT_FEATURE, "BOOSTER");
     settings_save(gconfig_getContext(), true);
     sleep_ms(100);  // Wait for the settings to be saved
     DPRINTF("Boot feature set to BOOSTER\n");
+    bootprof_mark(BOOTPROF_PHASE_BOOT_FEATURE);
     multicore_lockout_victim_init();  // keep the core 1 locked out
     mngr_init();
     mngr_loop();
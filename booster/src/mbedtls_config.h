@@ -67,6 +67,7 @@
 #define MBEDTLS_SSL_EXTENDED_MASTER_SECRET          // TLS extension (RFC 7627)
 #define MBEDTLS_SSL_MAX_FRAGMENT_LENGTH             // TLS extension (RFC 6066)
 #define MBEDTLS_SSL_SERVER_NAME_INDICATION          // TLS extension (RFC 6066)
+#define MBEDTLS_SSL_SESSION_TICKETS                 // TLS extension (RFC 5077)
 #define MBEDTLS_SSL_TRUNCATED_HMAC                  // TLS extension (RFC 6066)
 
 // Protocols
@@ -0,0 +1,235 @@
+/**
+ * File: metrics.c
+ * Author: Diego Parrilla Santamaría
+ * Date: October 2026
+ * Copyright: 2026 - GOODDATA LABS SL
+ * Description: Runtime metrics registry: counters, gauges and fixed-bucket
+ * histograms that any module can update, even from IRQ handlers, exported in
+ * the Prometheus text format at /metrics.
+ */
+
+#include "metrics.h"
+
+#include <stdarg.h>
+
+#include "hardware/sync.h"
+
+#define METRICS_HEADER_SIZE 128  // Room for the HTTP headers of the file
+
+typedef struct {
+  const char *name;
+  const char *help;
+} metrics_info_t;
+
+static const metrics_info_t counter_info[METRICS_COUNTER_COUNT] = {
+    {"protocol_commands", "Commands received from the computer"},
+    {"protocol_checksum_errors", "Commands dropped by a checksum error"},
+    {"flash_erases", "Flash erase operations"},
+    {"sd_errors", "Failed writes to the SD card"},
+    {"downloads", "Downloads of apps and firmware started"},
+    {"download_failures", "Downloads of apps and firmware failed"},
+    {"download_bytes", "Bytes received by the downloads"},
+    {"wifi_connects", "WiFi association attempts"},
+    {"wifi_link_losses", "WiFi links lost after being up"},
+    {"httpd_file_opens", "Files opened by the HTTP server"},
+    {"display_frames", "Frames published to the computer"},
+    {"display_copy_bytes", "Framebuffer bytes copied by the computer"}};
+
+static const metrics_info_t gauge_info[METRICS_GAUGE_COUNT] = {
+    {"wifi_rssi_dbm", "Last RSSI read of the WiFi link"},
+    {"download_kbps", "Throughput of the last download in KB/s"}};
+
+static const metrics_info_t histogram_info[METRICS_HISTOGRAM_COUNT] = {
+    {"download_duration_ms", "Duration of the downloads in milliseconds"},
+    {"flash_erase_duration_ms",
+     "Duration of the flash erases in milliseconds"}};
+
+// Upper bounds of the buckets, ascending. Not const: they are read by
+// metrics_observe(), which must not touch the flash.
+static uint8_t histogram_buckets[METRICS_HISTOGRAM_COUNT] = {6, 6};
+static uint32_t histogram_bounds[METRICS_HISTOGRAM_COUNT][METRICS_MAX_BUCKETS] =
+    {{1000, 5000, 15000, 30000, 60000, 120000},
+     {10, 50, 100, 250, 500, 1000}};
+
+// One copy per core: a core never writes the copy of the other one
+static uint32_t counters[NUM_CORES][METRICS_COUNTER_COUNT] = {0};
+static int32_t gauges[METRICS_GAUGE_COUNT] = {0};
+static uint32_t histogram_counts[NUM_CORES][METRICS_HISTOGRAM_COUNT]
+                                [METRICS_MAX_BUCKETS + 1] = {0};
+static uint32_t histogram_sums[NUM_CORES][METRICS_HISTOGRAM_COUNT] = {0};
+
+static char metrics_file[METRICS_HEADER_SIZE + METRICS_TEXT_SIZE];
+// Set while the server sends metrics_file. Opened and closed by the HTTP
+// server only, so no lock is needed.
+static bool metrics_file_busy = false;
+
+static const char metrics_busy_file[] =
+    "HTTP/1.1 503 Service Unavailable\r\n"
+    "Content-Length: 0\r\n"
+    "Retry-After: 1\r\n"
+    "Connection: close\r\n\r\n";
+
+void __not_in_flash_func(metrics_add)(metrics_counter_t counter,
+                                      uint32_t value) {
+  if (counter >= METRICS_COUNTER_COUNT) {
+    return;
+  }
+  // Only an IRQ on this same core could interleave with the update
+  uint32_t irq = save_and_disable_interrupts();
+  counters[get_core_num()][counter] += value;
+  restore_interrupts(irq);
+}
+
+void __not_in_flash_func(metrics_set)(metrics_gauge_t gauge, int32_t value) {
+  if (gauge < METRICS_GAUGE_COUNT) {
+    gauges[gauge] = value;
+  }
+}
+
+void __not_in_flash_func(metrics_observe)(metrics_histogram_t histogram,
+                                          uint32_t value) {
+  if (histogram >= METRICS_HISTOGRAM_COUNT) {
+    return;
+  }
+  // The last bucket is +Inf
+  uint8_t bucket = 0;
+  while (bucket < histogram_buckets[histogram] &&
+         value > histogram_bounds[histogram][bucket]) {
+    bucket++;
+  }
+  uint32_t irq = save_and_disable_interrupts();
+  uint core = get_core_num();
+  histogram_counts[core][histogram][bucket]++;
+  histogram_sums[core][histogram] += value;
+  restore_interrupts(irq);
+}
+
+uint32_t metrics_get_counter(metrics_counter_t counter) {
+  if (counter >= METRICS_COUNTER_COUNT) {
+    return 0;
+  }
+  uint32_t value = 0;
+  for (int core = 0; core < NUM_CORES; core++) {
+    value += counters[core][counter];
+  }
+  return value;
+}
+
+// Append to the buffer. The length never goes past buffer_len - 1.
+static int metrics_printf(char *buffer, size_t buffer_len, int len,
+                          const char *fmt, ...) {
+  if ((size_t)len + 1 >= buffer_len) {
+    return len;
+  }
+  va_list args;
+  va_start(args, fmt);
+  int printed = vsnprintf(buffer + len, buffer_len - len, fmt, args);
+  va_end(args);
+  if (printed < 0) {
+    return len;
+  }
+  len += printed;
+  return ((size_t)len >= buffer_len) ? (int)buffer_len - 1 : len;
+}
+
+static int metrics_header(char *buffer, size_t buffer_len, int len,
+                          const char *name, const char *suffix,
+                          const char *help, const char *type) {
+  return metrics_printf(buffer, buffer_len, len,
+                        "# HELP " METRICS_PREFIX "%s%s %s\n"
+                        "# TYPE " METRICS_PREFIX "%s%s %s\n",
+                        name, suffix, help, name, suffix, type);
+}
+
+int metrics_render(char *buffer, size_t buffer_len) {
+  if (buffer_len == 0) {
+    return 0;
+  }
+  buffer[0] = '\0';
+  int len = metrics_printf(
+      buffer, buffer_len, 0,
+      "# TYPE " METRICS_PREFIX "build_info gauge\n" METRICS_PREFIX
+      "build_info{version=\"%s\"} 1\n"
+      "# TYPE " METRICS_PREFIX "uptime_seconds gauge\n" METRICS_PREFIX
+      "uptime_seconds %llu\n",
+      RELEASE_VERSION, (unsigned long long)(time_us_64() / 1000000));
+  for (int i = 0; i < METRICS_COUNTER_COUNT; i++) {
+    len = metrics_header(buffer, buffer_len, len, counter_info[i].name,
+                         "_total", counter_info[i].help, "counter");
+    len = metrics_printf(buffer, buffer_len, len,
+                         METRICS_PREFIX "%s_total %lu\n", counter_info[i].name,
+                         (unsigned long)metrics_get_counter(i));
+  }
+  for (int i = 0; i < METRICS_GAUGE_COUNT; i++) {
+    len = metrics_header(buffer, buffer_len, len, gauge_info[i].name, "",
+                         gauge_info[i].help, "gauge");
+    len = metrics_printf(buffer, buffer_len, len, METRICS_PREFIX "%s %ld\n",
+                         gauge_info[i].name, (long)gauges[i]);
+  }
+  for (int i = 0; i < METRICS_HISTOGRAM_COUNT; i++) {
+    const char *name = histogram_info[i].name;
+    len = metrics_header(buffer, buffer_len, len, name, "",
+                         histogram_info[i].help, "histogram");
+    // Prometheus buckets are cumulative
+    uint32_t count = 0;
+    uint32_t sum = 0;
+    for (int bucket = 0; bucket <= histogram_buckets[i]; bucket++) {
+      for (int core = 0; core < NUM_CORES; core++) {
+        count += histogram_counts[core][i][bucket];
+      }
+      if (bucket < histogram_buckets[i]) {
+        len = metrics_printf(buffer, buffer_len, len,
+                             METRICS_PREFIX "%s_bucket{le=\"%lu\"} %lu\n", name,
+                             (unsigned long)histogram_bounds[i][bucket],
+                             (unsigned long)count);
+      }
+    }
+    for (int core = 0; core < NUM_CORES; core++) {
+      sum += histogram_sums[core][i];
+    }
+    len = metrics_printf(buffer, buffer_len, len,
+                         METRICS_PREFIX "%s_bucket{le=\"+Inf\"} %lu\n"
+                         METRICS_PREFIX "%s_sum %lu\n"
+                         METRICS_PREFIX "%s_count %lu\n",
+                         name, (unsigned long)count, name, (unsigned long)sum,
+                         name, (unsigned long)count);
+  }
+  return len;
+}
+
+bool metrics_open_file(struct fs_file *file, const char *name) {
+  if (strcmp(name, METRICS_URI) != 0) {
+    return false;
+  }
+  memset(file, 0, sizeof(*file));
+  file->flags = FS_FILE_FLAGS_HEADER_INCLUDED;
+  if (metrics_file_busy) {
+    // Rendering again would change the body of the scrape being sent
+    file->data = metrics_busy_file;
+    file->len = sizeof(metrics_busy_file) - 1;
+    return true;
+  }
+  metrics_file_busy = true;
+  // Render the body first, then put the headers right before it
+  char *body = metrics_file + METRICS_HEADER_SIZE;
+  int body_len = metrics_render(body, METRICS_TEXT_SIZE);
+  char header[METRICS_HEADER_SIZE];
+  int header_len = snprintf(header, sizeof(header),
+                            "HTTP/1.1 200 OK\r\n"
+                            "Content-Type: text/plain; version=0.0.4\r\n"
+                            "Content-Length: %d\r\n"
+                            "Cache-Control: no-store\r\n"
+                            "Connection: close\r\n\r\n",
+                            body_len);
+  memcpy(body - header_len, header, header_len);
+  file->data = body - header_len;
+  file->len = header_len + body_len;
+  return true;
+}
+
+void metrics_close_file(struct fs_file *file) {
+  const char *data = file->data;
+  if (data >= metrics_file && data < metrics_file + sizeof(metrics_file)) {
+    metrics_file_busy = false;
+  }
+}
@@ -0,0 +1,121 @@
+/**
+ * File: mirror.c
+ * Author: Diego Parrilla Santamaría
+ * Date: October 2026
+ * Copyright: 2026 - GOODDATA LABS SL
+ * Description: LAN mirrors of the app binaries and the version check. Sends
+ * the downloads to the first healthy host of an ordered list and falls back
+ * to the origin when all of them are failing.
+ */
+
+#include "mirror.h"
+
+#include <stdlib.h>
+
+// mirror_report runs in the lwIP callbacks and the rest in the main loop, so
+// the mirrors are only touched with the lwIP lock held. The lock is
+// recursive: the callbacks can take it again.
+static mirror_host_t mirrors[MIRROR_MAX_HOSTS];
+static uint8_t mirror_count = 0;
+static char mirror_setting[SETTINGS_MAX_VALUE_LENGTH] = {0};
+
+// Parse the setting again only when it changes, so the health of the
+// mirrors is kept across requests
+static void mirror_load(void) {
+  SettingsConfigEntry *entry =
+      settings_find_entry(gconfig_getContext(), PARAM_MIRROR_HOSTS);
+  const char *value = (entry != NULL) ? entry->value : "";
+  if (strcmp(value, mirror_setting) == 0) {
+    return;
+  }
+  snprintf(mirror_setting, sizeof(mirror_setting), "%s", value);
+  memset(mirrors, 0, sizeof(mirrors));
+  mirror_count = 0;
+
+  const char *p = value;
+  while (*p && mirror_count < MIRROR_MAX_HOSTS) {
+    while (*p == ' ' || *p == ',') p++;
+    size_t len = strcspn(p, ", ");
+    if (len == 0) {
+      break;
+    }
+    if (len < MIRROR_HOST_SIZE) {
+      mirror_host_t *mirror = &mirrors[mirror_count];
+      memcpy(mirror->host, p, len);
+      mirror->host[len] = '\0';
+      char *colon = strchr(mirror->host, ':');
+      if (colon != NULL) {
+        *colon = '\0';
+        mirror->port = (uint16_t)atoi(colon + 1);
+      }
+      if (mirror->host[0] != '\0') {
+        DPRINTF("Mirror %u: %s port %u\n", mirror_count, mirror->host,
+                mirror->port);
+        mirror_count++;
+      }
+    }
+    p += len;
+  }
+}
+
+bool mirror_route(mirror_route_t *route) {
+  route->mirror = MIRROR_ORIGIN;
+  route->hostname[0] = '\0';
+  route->port = 0;
+  bool mirrored = false;
+  cyw43_arch_lwip_begin();
+  mirror_load();
+  absolute_time_t now = get_absolute_time();
+  for (uint8_t i = 0; i < mirror_count; i++) {
+    mirror_host_t *mirror = &mirrors[i];
+    if (mirror->failures > 0 && absolute_time_diff_us(now, mirror->retry) > 0) {
+      continue;
+    }
+    route->mirror = (int8_t)i;
+    snprintf(route->hostname, sizeof(route->hostname), "%s", mirror->host);
+    route->port = mirror->port;
+    mirror->requests++;
+    DPRINTF("Routing the request to mirror %s\n", mirror->host);
+    mirrored = true;
+    break;
+  }
+  cyw43_arch_lwip_end();
+  return mirrored;
+}
+
+void mirror_report(const mirror_route_t *route, bool ok) {
+  if (route->mirror == MIRROR_ORIGIN) {
+    return;
+  }
+  cyw43_arch_lwip_begin();
+  // The list may have changed while the request was running
+  if (route->mirror < mirror_count &&
+      strcmp(mirrors[route->mirror].host, route->hostname) == 0) {
+    mirror_host_t *mirror = &mirrors[route->mirror];
+    if (ok) {
+      mirror->failures = 0;
+    } else {
+      mirror->errors++;
+      if (mirror->failures < 8) {
+        mirror->failures++;
+      }
+      uint32_t backoff_s = MIRROR_RETRY_MIN_S << (mirror->failures - 1);
+      if (backoff_s > MIRROR_RETRY_MAX_S) {
+        backoff_s = MIRROR_RETRY_MAX_S;
+      }
+      mirror->retry = make_timeout_time_ms(backoff_s * 1000);
+      DPRINTF("Mirror %s failed %u times. Skipped for %lu s\n", mirror->host,
+              mirror->failures, (unsigned long)backoff_s);
+    }
+  }
+  cyw43_arch_lwip_end();
+}
+
+uint8_t mirror_get_hosts(mirror_host_t hosts[MIRROR_MAX_HOSTS]) {
+  cyw43_arch_lwip_begin();
+  mirror_load();
+  uint8_t count = mirror_count;
+  memcpy(hosts, mirrors, count * sizeof(mirror_host_t));
+  cyw43_arch_lwip_end();
+  return count;
+}
@@ -9,15 +9,48 @@
 #include "mngr.h"
 
 static firmware_upgrade_state_t firmware_upgrade_state = FIRMWARE_UPGRADE_IDLE;
-static bool network_scan_enabled = false;
+static volatile bool network_scan_enabled = false;
+static bool network_scan_paused = false;
+// Milliseconds since boot when the lease ends. Renewed by the httpd and read
+// by the main loop: a 32 bit value is written in one go, a 64 bit time is not.
+static volatile uint32_t network_scan_lease_ms = 0;
 static bool device_reset = false;
 static bool factory_reset = false;
 static absolute_time_t reboot_time = {0};
 static absolute_time_t factory_reset_time = {0};
 
 #define MNGR_OFFLINE_STATUS_MESSAGE "Offline mode. Network disabled."
-
-void mngr_enable_network_scan() { network_scan_enabled = true; }
+#define MNGR_SDCARD_BOOT_STACK_SIZE (8 * 1024)
+// The network page asks for the WiFi list every 5 seconds. Stop scanning if
+// it misses three requests: the page has been closed.
+#define MNGR_NETWORK_SCAN_LEASE_MS (15 * 1000)
+
+// SD card boot done on core 1 while core 0 associates to the WiFi network.
+// Owned by core 1 until sdcard_boot_done is released.
+typedef struct {
+  sdcard_status_t status;
+  uint32_t total_size;
+  uint32_t free_space;
+  bool apps_folder_found;
+  bool table_changed;
+  uint16_t table_length;
+  uint8_t table[FLASH_SECTOR_SIZE];
+} mngr_sdcard_boot_t;
+
+static FATFS mngr_fs;
+static mngr_sdcard_boot_t *sdcard_boot = NULL;
+static uint32_t *sdcard_boot_stack = NULL;
+static semaphore_t sdcard_boot_done;
+
+void mngr_enable_network_scan() {
+  if (!network_scan_enabled) {
+    DPRINTF("Network page open. Scanning networks.\n");
+  }
+  // Lease first: the main loop must not see the scan enabled with an old one
+  network_scan_lease_ms =
+      to_ms_since_boot(get_absolute_time()) + MNGR_NETWORK_SCAN_LEASE_MS;
+  network_scan_enabled = true;
+}
 
 void mngr_disable_network_scan() { network_scan_enabled = false; }
 
@@ -37,18 +70,30 @@ static void mngr_enter_offline_mode(uint8_t wifi_status, const char *details,
   display_refresh();
 }
 
-int mngr_init() {
-  // Initialize the network
-  int err = network_initChipOnly();
-  if (err != 0) {
-    DPRINTF("Error initializing the network: %i\n", err);
-  }
+static bool mngr_download_busy(download_status_t status) {
+  return (status != DOWNLOAD_STATUS_IDLE) && (status != DOWNLOAD_STATUS_FAILED);
+}
+
+// True while an app or firmware download or an app launch is running. Used to
+// keep background network tasks out of the way.
+static bool mngr_is_busy(void) {
+  return mngr_download_busy(appmngr_get_download_status()) ||
+         mngr_download_busy(appmngr_get_download_firmware_status()) ||
+         appmngr_get_launch_status() == DOWNLOAD_LAUNCHAPP_SCHEDULED ||
+         appmngr_get_launch_status() == DOWNLOAD_LAUNCHAPP_INPROGRESS;
+}
 
-  // Initialize the SD card
-  FATFS fs;
+// Runs on core 1 with its own stack, or on core 0 if there is no memory for
+// the stack. Only touches the SD card and RAM, never the flash. The driver is
+// already initialized by core 0.
+static void mngr_sdcard_boot_work(void) {
+  if (sdcard_boot->status != SDCARD_INIT_OK) {
+    bootprof_mark(BOOTPROF_PHASE_SDCARD_MOUNT);
+    return;
+  }
   SettingsConfigEntry *appsFolder =
       settings_find_entry(gconfig_getContext(), PARAM_APPS_FOLDER);
-  char *appsFolderName = "/apps";
+  const char *appsFolderName = "/apps";
   if (appsFolder == NULL) {
     DPRINTF(
         "APPS_FOLDER not found in the configuration. Using default value\n");
@@ -56,36 +101,99 @@ int mngr_init() {
     DPRINTF("APPS_FOLDER: %s\n", appsFolder->value);
     appsFolderName = appsFolder->value;
   }
-  int sdcard_err = sdcard_initFilesystem(&fs, appsFolderName);
-  if (sdcard_err != SDCARD_INIT_OK) {
-    DPRINTF("Error initializing the SD card: %i\n", sdcard_err);
-  } else {
-    DPRINTF("SD card found & initialized\n");
+  sdcard_boot->status = sdcard_initFilesystem(&mngr_fs, appsFolderName);
+  if (sdcard_boot->status != SDCARD_INIT_OK) {
+    DPRINTF("Error initializing the SD card: %i\n", sdcard_boot->status);
+    bootprof_mark(BOOTPROF_PHASE_SDCARD_MOUNT);
+    return;
   }
-  appmngr_get_sdcard_info()->ready = (sdcard_err == SDCARD_INIT_OK);
+  DPRINTF("SD card found & initialized\n");
 
   // Obtain the free space in the SD card
-  uint32_t total_size = 0;
-  uint32_t free_space = 0;
-  sdcard_getInfo(&fs, &total_size, &free_space);
-  appmngr_get_sdcard_info()->total_size = total_size;
-  appmngr_get_sdcard_info()->free_space = free_space;
-  DPRINTF("SD card total size: %uMB\n", appmngr_get_sdcard_info()->total_size);
-  DPRINTF("SD card free space: %uMB\n", appmngr_get_sdcard_info()->free_space);
-  char *apps_folder =
-      settings_find_entry(gconfig_getContext(), PARAM_APPS_FOLDER)->value;
-  if (apps_folder == NULL) {
-    appmngr_get_sdcard_info()->apps_folder_found = false;
-    DPRINTF("Apps folder param not found\n");
-  } else {
-    appmngr_get_sdcard_info()->apps_folder_found = sdcard_dirExist(apps_folder);
-    DPRINTF("Apps folder found: %s\n",
-            appmngr_get_sdcard_info()->apps_folder_found ? "true" : "false");
+  sdcard_getInfo(&mngr_fs, &sdcard_boot->total_size,
+                 &sdcard_boot->free_space);
+  sdcard_boot->apps_folder_found =
+      (appsFolder != NULL) && sdcard_dirExist(appsFolder->value);
+  bootprof_mark(BOOTPROF_PHASE_SDCARD_MOUNT);
+
+  // Add the apps found in the SD card to the lookup table, in RAM only
+  sdcard_boot->table_changed = appmngr_scan_lookup_table(
+      sdcard_boot->table, &sdcard_boot->table_length);
+  bootprof_mark(BOOTPROF_PHASE_LOOKUP_SYNC);
+}
+
+static void mngr_sdcard_boot_core1(void) {
+  mngr_sdcard_boot_work();
+  sem_release(&sdcard_boot_done);
+  // Core 0 resets this core once it has collected the results
+  while (true) {
+    __wfe();
   }
+}
 
-  // Deinit the network
-  DPRINTF("Deinitializing the network\n");
-  network_deInit();
+static void mngr_sdcard_boot_start(void) {
+  sem_init(&sdcard_boot_done, 0, 1);
+  sdcard_boot = calloc(1, sizeof(mngr_sdcard_boot_t));
+  if (sdcard_boot == NULL) {
+    DPRINTF("No memory to boot the SD card\n");
+    return;
+  }
+  // The driver enables the DMA interrupt on the calling core. Core 1 is reset
+  // after the boot, so it must be core 0.
+  bootprof_begin(BOOTPROF_PHASE_SDCARD_MOUNT);
+  sdcard_boot->status = sdcard_initDriver();
+  sdcard_boot_stack = malloc(MNGR_SDCARD_BOOT_STACK_SIZE);
+  if (sdcard_boot_stack == NULL) {
+    DPRINTF("No memory for the core 1 stack. Booting the SD card on core 0\n");
+    mngr_sdcard_boot_work();
+    sem_release(&sdcard_boot_done);
+    return;
+  }
+  // Core 1 waits for the SELECT button. Borrow it until the SD card is ready.
+  select_coreWaitPushDisable();
+  multicore_launch_core1_with_stack(mngr_sdcard_boot_core1, sdcard_boot_stack,
+                                    MNGR_SDCARD_BOOT_STACK_SIZE);
+}
+
+static void mngr_sdcard_boot_wait(void) {
+  if (sdcard_boot == NULL) {
+    return;
+  }
+  sem_acquire_blocking(&sdcard_boot_done);
+  if (sdcard_boot_stack != NULL) {
+    // Core 1 stays in reset while the lookup table is written to flash
+    multicore_reset_core1();
+    free(sdcard_boot_stack);
+    sdcard_boot_stack = NULL;
+  }
+
+  sdcard_info_t *sdcard_info = appmngr_get_sdcard_info();
+  sdcard_info->ready = (sdcard_boot->status == SDCARD_INIT_OK);
+  if (sdcard_info->ready) {
+    sdcard_info->total_size = sdcard_boot->total_size;
+    sdcard_info->free_space = sdcard_boot->free_space;
+    sdcard_info->apps_folder_found = sdcard_boot->apps_folder_found;
+    DPRINTF("SD card total size: %uMB\n", sdcard_info->total_size);
+    DPRINTF("SD card free space: %uMB\n", sdcard_info->free_space);
+    if (sdcard_boot->table_changed) {
+      appmngr_save_lookup_table(sdcard_boot->table,
+                                sdcard_boot->table_length);
+    } else {
+      DPRINTF("sync: no changes, nothing to persist\n");
+    }
+    appmngr_print_apps_lookup_table(sdcard_boot->table,
+                                    sdcard_boot->table_length);
+  }
+  free(sdcard_boot);
+  sdcard_boot = NULL;
+
+  // Give core 1 back to the SELECT button
+  select_coreWaitPush(reset_device, reset_deviceAndEraseFlash);
+}
+
+int mngr_init() {
+  // Parse JSON in a static arena instead of the heap shared with lwIP
+  jsonarena_init();
 
   // Set hostname
   char *hostname =
@@ -113,10 +221,25 @@ int mngr_init() {
 
   display_mngr_start(ssid, url_host, url_ip);
 
+  // Publish the cached latest version. A check, if due, runs in the background
+  version_init();
+
+  // Init the download apps before core 1 starts parsing the apps info
+  appmngr_init();
+  bootprof_mark(BOOTPROF_PHASE_APPMNGR_INIT);
+
   wifi_mode_t wifi_mode_value = WIFI_MODE_STA;
   bool network_features_enabled = false;
   char mac_str[64] = {0};
-  err = network_wifiInit(wifi_mode_value);
+  // The first init of the chip. network_wifiInit() does nothing if the chip
+  // is already up, so a network_initChipOnly() before it would skip the
+  // country code.
+  int err = network_wifiInit(wifi_mode_value);
+  bootprof_mark(BOOTPROF_PHASE_WIFI_INIT);
+
+  // Mount the SD card and sync the lookup table while the WiFi associates
+  mngr_sdcard_boot_start();
+
   if (err != 0) {
     DPRINTF("Error initializing the network: %i\n", err);
     mngr_enter_offline_mode(DISPLAY_MNGR_WIFI_STATUS_RETRY_ERROR,
@@ -131,7 +254,9 @@ int mngr_init() {
     display_refresh();
 
     // Connect to the WiFi network
+    bootprof_begin(BOOTPROF_PHASE_WIFI_CONNECT);
     int numRetries = 3;
+    uint32_t retryDelayMs = 1000;  // Doubled after each failed attempt
     err = NETWORK_WIFI_STA_CONN_ERR_TIMEOUT;
     while (err != NETWORK_WIFI_STA_CONN_OK) {
       err = network_wifiStaConnect();
@@ -151,7 +276,8 @@ int mngr_init() {
             network_WifiStaConnStatusString(err),
             mac_str[0] != '\0' ? mac_str : NULL);
         display_refresh();
-        sleep_ms(3000);  // Wait before retrying
+        sleep_ms(retryDelayMs);  // Wait before retrying
+        retryDelayMs *= 2;
         display_mngr_wifi_change_status(DISPLAY_MNGR_WIFI_STATUS_CONNECTING,
                                         NULL, NULL, NULL,
                                         mac_str[0] != '\0' ? mac_str : NULL);
@@ -159,6 +285,8 @@ int mngr_init() {
       }
     }
 
+    bootprof_mark(BOOTPROF_PHASE_WIFI_CONNECT);
+
     if (err == NETWORK_WIFI_STA_CONN_OK) {
       network_features_enabled = true;
       DPRINTF("WiFi connected\n");
@@ -167,19 +295,6 @@ int mngr_init() {
       DPRINTF("IP address: %s\n", ip4addr_ntoa(&ip));
 
       snprintf(url_ip, sizeof(url_ip), "http://%s", ip4addr_ntoa(&ip));
-      version_loop();
-      download_version_t version_status = version_get_status();
-      if (version_status == DOWNLOAD_VERSION_COMPLETED) {
-        DPRINTF("Version download completed successfully\n");
-        if (version_isNewer()) {
-          DPRINTF("Downloaded version is newer than the built-in version\n");
-        } else {
-          DPRINTF(
-              "Downloaded version is not newer than the built-in version\n");
-        }
-      } else {
-        DPRINTF("Version download failed or in progress\n");
-      }
 
       display_mngr_wifi_change_status(DISPLAY_MNGR_WIFI_STATUS_CONNECTED,
                                       url_host, url_ip, NULL,
@@ -188,69 +303,25 @@ int mngr_init() {
     }
   }
 
-  // Init the download apps
-  appmngr_init();
+  // Collect the SD card results from core 1
+  bootprof_begin(BOOTPROF_PHASE_SDCARD_WAIT);
+  mngr_sdcard_boot_wait();
+  bootprof_mark(BOOTPROF_PHASE_SDCARD_WAIT);
 
-  // Configure the sd card, if possible
-  bool sdcard_ready = false;
-  if (!appmngr_get_sdcard_info()->ready) {
-    // Try to initialize the SD card
-    SettingsConfigEntry *appsFolder =
-        settings_find_entry(gconfig_getContext(), PARAM_APPS_FOLDER);
-    char *appsFolderName = "/apps";
-    if (appsFolder == NULL) {
-      DPRINTF(
-          "APPS_FOLDER not found in the configuration. Using default "
-          "value\n");
-    } else {
-      DPRINTF("APPS_FOLDER: %s\n", appsFolder->value);
-      appsFolderName = appsFolder->value;
-    }
-    int sdcard_err = sdcard_initFilesystem(&fs, appsFolderName);
-    if (sdcard_err == SDCARD_INIT_OK) {
-      DPRINTF("SD card found & initialized\n");
-      appmngr_get_sdcard_info()->ready = true;
-      // Obtain the free space in the SD card
-      uint32_t total_size = 0;
-      uint32_t free_space = 0;
-      sdcard_getInfo(&fs, &total_size, &free_space);
-      appmngr_get_sdcard_info()->total_size = total_size;
-      appmngr_get_sdcard_info()->free_space = free_space;
-      DPRINTF("SD card total size: %uMB\n",
-              appmngr_get_sdcard_info()->total_size);
-      DPRINTF("SD card free space: %uMB\n",
-              appmngr_get_sdcard_info()->free_space);
-      char *apps_folder =
-          settings_find_entry(gconfig_getContext(), PARAM_APPS_FOLDER)->value;
-      if (apps_folder != NULL) {
-        appmngr_get_sdcard_info()->apps_folder_found =
-            sdcard_dirExist(apps_folder);
-      }
-      sdcard_ready = true;
-
-      // appmngr load table
-      uint8_t *table = malloc(FLASH_SECTOR_SIZE);
-      uint16_t table_length = 0;
-      appmngr_load_apps_lookup_table(table, &table_length);
-      appmngr_print_apps_lookup_table(table, table_length);
-
-      // Now, try to sync the apps lookup table with the JSON files
-      appmngr_sync_lookup_table();
-
-      // appmngr load table
-      memset(table, 0, FLASH_SECTOR_SIZE);
-      appmngr_load_apps_lookup_table(table, &table_length);
-      appmngr_print_apps_lookup_table(table, table_length);
-      free(table);
-    } else {
-      DPRINTF("Error initializing the SD card: %i\n", sdcard_err);
-    }
+  // Core 1 is back in RAM. Keep the association for a faster connection.
+  if (network_features_enabled) {
+    network_saveFastConnect();
   }
 
+  // Load the cached apps catalog, if any. Refreshed in the background later.
+  catalog_init();
+  bootprof_mark(BOOTPROF_PHASE_CATALOG_LOAD);
+
   if (network_features_enabled) {
     // Start the HTTP server
     mngr_httpd_start();
     sleep_ms(500);
+    bootprof_mark(BOOTPROF_PHASE_HTTPD_START);
   }
 
   // appmngr_download_firmware_status(DOWNLOAD_STATUS_REQUESTED);
@@ -268,6 +339,8 @@ int mngr_init() {
   factory_reset_time = make_timeout_time_ms(0);
   absolute_time_t launch_time = make_timeout_time_ms(0);
   bool bypass = true;
+  bootprof_mark(BOOTPROF_PHASE_READY);
+  bootprof_print();
   while (1) {
     int wait_ms = 10;
     if (appmngr_get_download_status() == DOWNLOAD_STATUS_IN_PROGRESS ||
@@ -287,7 +360,24 @@ int mngr_init() {
     sleep_ms(wait_ms);
 #endif
     if (network_features_enabled && network_scan_enabled) {
-      network_scan(&wifi_scan_time, wifi_scan_polling_interval);
+      uint32_t now_ms = to_ms_since_boot(get_absolute_time());
+      if ((int32_t)(network_scan_lease_ms - now_ms) < 0) {
+        DPRINTF("Network page closed. Scan stopped.\n");
+        mngr_disable_network_scan();
+      } else if (mngr_is_busy()) {
+        // A scan takes the radio off channel for seconds: keep the airtime
+        // for the download or the launch in progress
+        if (!network_scan_paused) {
+          DPRINTF("Download or launch in progress. Scan paused.\n");
+          network_scan_paused = true;
+        }
+      } else {
+        network_scan_paused = false;
+        // Fill the list fast with an active scan, then listen to the beacons
+        // without competing with the connection
+        network_setScanPassive(mngr_get_networks()->count > 0);
+        network_scan(&wifi_scan_time, wifi_scan_polling_interval);
+      }
     }
     if (network_features_enabled && !term_isActive() &&
         absolute_time_diff_us(get_absolute_time(), wifi_signal_refresh_time) <
@@ -339,6 +429,10 @@ int mngr_init() {
         case DOWNLOAD_STATUS_COMPLETED: {
           // Save the app info to the SD card
           download_err_t err = appmngr_finish_download_app();
+          if (appmngr_get_download_status() == DOWNLOAD_STATUS_REQUESTED) {
+            // A mirror served a wrong file: download it again from the origin
+            break;
+          }
           appmngr_download_error(err);
           if (err != DOWNLOAD_OK) {
             DPRINTF("Error finishing download app\n");
@@ -396,6 +490,13 @@ int mngr_init() {
       }
     }
 
+    // Refresh the apps catalog cache in the background
+    catalog_loop(network_features_enabled && !mngr_is_busy());
+
+    // Check the latest version in the background, after the catalog
+    version_background_loop(network_features_enabled && !mngr_is_busy() &&
+                            catalog_get_status() != CATALOG_STATUS_FETCHING);
+
     if (appmngr_get_launch_status() == DOWNLOAD_LAUNCHAPP_INPROGRESS) {
       if ((absolute_time_diff_us(get_absolute_time(), launch_time) < 0)) {
         download_launch_err_t err = appmngr_launch_app();
@@ -17,8 +17,16 @@ static void *valid_connection;
 static char apps_installed_json[MAXIMUM_APP_INFO_SIZE];
 static bool apps_installed_found = false;
 static wifi_scan_data_t *networks = NULL;
+static wifi_network_rank_t ranked_networks[MAX_NETWORKS];
+static uint16_t ranked_count = 0;
+static uint32_t ranked_epoch = 0;
 static mngr_httpd_response_status_t response_status = MNGR_HTTPD_RESPONSE_OK;
 static char httpd_response_message[128] = {0};
+static uint32_t catalog_tag_filter = 0;
+static uint32_t catalog_device_filter = 0;
+static uint16_t catalog_ssi_app = 0;
+static uint32_t catalog_ssi_offset = 0;
+static bool catalog_ssi_first = true;
 
 static int mngr_httpd_base64_value(unsigned char c) {
   if (c >= 'A' && c <= 'Z') {
@@ -137,6 +145,41 @@ static int starts_with_case_insensitive(const char *str, const char *chars) {
   return 0;
 }
 
+/**
+ * @brief Copies a string escaped for a JSON string literal.
+ *
+ * Quotes and backslashes are escaped, and the bytes below 0x20 are written as
+ * \u00XX. A char whose escape does not fit is dropped with the rest.
+ *
+ * @param dst The destination buffer, always null terminated.
+ * @param dst_size The size of the destination buffer.
+ * @param src The string to escape. NULL is copied as an empty string.
+ * @return The length of the escaped string.
+ */
+static size_t mngr_httpd_json_escape(char *dst, size_t dst_size,
+                                     const char *src) {
+  size_t n = 0;
+  if (dst_size == 0) {
+    return 0;
+  }
+  for (const char *c = src; c != NULL && *c; c++) {
+    unsigned char byte = (unsigned char)*c;
+    if (byte < 0x20) {
+      if (n + 6 >= dst_size) break;
+      n += snprintf(dst + n, dst_size - n, "\\u%04x", byte);
+    } else if (byte == '"' || byte == '\\') {
+      if (n + 2 >= dst_size) break;
+      dst[n++] = '\\';
+      dst[n++] = (char)byte;
+    } else {
+      if (n + 1 >= dst_size) break;
+      dst[n++] = (char)byte;
+    }
+  }
+  dst[n] = '\0';
+  return n;
+}
+
 static char *get_status_message(mngr_httpd_response_status_t status,
                                 const char *detail) {
   // Concatenate the detail
@@ -193,12 +236,12 @@ static const char *ssi_tags[] = {
     "APPSURL",   // 17 - Apps Catalog URL
     "NVERSION",  // 18 - New Version
     "NVERSTR",   // 19 - New Version String
-    "PLHLDR11",  // 20 - Placeholder 11
-    "PLHLDR12",  // 21 - Placeholder 12
-    "PLHLDR13",  // 22 - Placeholder 13
-    "PLHLDR14",  // 23 - Placeholder 14
-    "PLHLDR15",  // 24 - Placeholder 15
-    "PLHLDR16",  // 25 - Placeholder 16
+    "CATMETA",   // 20 - Cached catalog metadata
+    "CATAPPS",   // 21 - Cached catalog apps
+    "BOOTPROF",  // 22 - Boot phases timeline
+    "VERCHECK",  // 23 - Background version check
+    "MIRRORS",   // 24 - LAN mirrors of the downloads
+    "NETSTATS",  // 25 - lwIP memory, TCP and link counters
     "PLHLDR17",  // 26 - Placeholder 17
     "PLHLDR18",  // 27 - Placeholder 18
     "PLHLDR19",  // 28 - Placeholder 19
@@ -341,6 +384,7 @@ const char *cgi_saveparams(int iIndex, int iNumParams, char *pcParam[],
         DPRINTF("Decoded value: %s\n", output_buffer);
         // Parse the JSON object
         bool valid_json = true;
+        bool catalog_url_changed = false;
         cJSON *root = cJSON_Parse(output_buffer);
         if (root == NULL) {
           DPRINTF("Error parsing JSON\n");
@@ -364,6 +408,9 @@ const char *cgi_saveparams(int iIndex, int iNumParams, char *pcParam[],
               if (strcasecmp(type->valuestring, "STRING") == 0) {
                 settings_put_string(gconfig_getContext(), name->valuestring,
                                     value->valuestring);
+                if (strcmp(name->valuestring, PARAM_APPS_CATALOG_URL) == 0) {
+                  catalog_url_changed = true;
+                }
                 DPRINTF("Setting %s to %s saved.\n", name->valuestring,
                         value->valuestring);
               } else if (strcasecmp(type->valuestring, "INT") == 0) {
@@ -397,10 +444,14 @@ const char *cgi_saveparams(int iIndex, int iNumParams, char *pcParam[],
 
           // Free the parsed JSON object
           cJSON_Delete(root);
+          jsonarena_reset();
 
           if (valid_json) {
             settings_save(gconfig_getContext(), true);
             DPRINTF("Settings saved\n");
+            if (catalog_url_changed) {
+              catalog_request_refresh();
+            }
             response_status = MNGR_HTTPD_RESPONSE_OK;
             snprintf(httpd_response_message, sizeof(httpd_response_message),
                      "");
@@ -598,6 +649,34 @@ const char *cgi_firmware_upgrade_confirm(int iIndex, int iNumParams,
   return "/response.shtml";
 }
 
+/**
+ * @brief Serve the catalog cached in the SD card
+ *
+ * Optional "tags" and "devices" parameters are hexadecimal bitmasks over the
+ * tag and device dictionaries of the cache. Apps not matching them are left
+ * out of the response.
+ *
+ * @param iIndex The index of the CGI handler.
+ * @param iNumParams The number of parameters passed to the CGI handler.
+ * @param pcParam An array of parameter names.
+ * @param pcValue An array of parameter values.
+ * @return The URL of the page with the cached catalog as JSON
+ */
+const char *cgi_catalog(int iIndex, int iNumParams, char *pcParam[],
+                        char *pcValue[]) {
+  DPRINTF("cgi_catalog called with index %d\n", iIndex);
+  catalog_tag_filter = 0;
+  catalog_device_filter = 0;
+  for (size_t i = 0; i < iNumParams; i++) {
+    if (strcmp(pcParam[i], "tags") == 0) {
+      catalog_tag_filter = (uint32_t)strtoul(pcValue[i], NULL, HEX_BASE);
+    } else if (strcmp(pcParam[i], "devices") == 0) {
+      catalog_device_filter = (uint32_t)strtoul(pcValue[i], NULL, HEX_BASE);
+    }
+  }
+  return "/catalog.shtml";
+}
+
 /**
  * @brief Array of CGI handlers for floppy select and eject operations.
  *
@@ -618,6 +697,8 @@ static const tCGI cgi_handlers[] = {
     {"/firmware_upgrade_start.cgi", cgi_firmware_upgrade_start},
     {"/firmware_upgrade_downloaded.cgi", cgi_firmware_upgrade_downloaded},
     {"/firmware_upgrade_confirm.cgi", cgi_firmware_upgrade_confirm},
+    {"/catalog.cgi", cgi_catalog},
+    {BENCH_DOWNLOAD_URI, bench_cgi_download},
 };
 
 /**
@@ -857,28 +938,35 @@ static u16_t ssi_handler(int iIndex, char *pcInsert, int iInsertLen
     }
     case 10: /* WIFILST */
     {
+      // One network per part, strongest first. Access points sharing the
+      // SSID are folded into the strongest one.
       if (current_tag_part == 0) {
         mngr_enable_network_scan();
         networks = mngr_get_networks();
+        ranked_count = network_rankNetworks(ranked_networks, MAX_NETWORKS);
+        ranked_epoch = network_getScanEpoch();
       }
-      // Loop through networks->count;
-      if (networks != NULL) {
-        if (current_tag_part < networks->count) {
-          wifi_network_info_t *network = &networks->networks[current_tag_part];
-          char last_char =
-              (current_tag_part == networks->count - 1) ? ' ' : ',';
-          printed = snprintf(pcInsert, iInsertLen,
-                             "{\"SSID\": \"%s\",\"BSSID\": \"%s\",\"RSSI\": "
-                             "\"%d\",\"AUTH\": \"%d\"}%c",
-                             network->ssid, network->bssid, network->rssi,
-                             network->auth_mode, last_char);
-          *next_tag_part = current_tag_part + 1;
-        } else {
-          printed = 0;
-          networks = NULL;
-        }
+      // Aging compacts the table and moves the entries: stop the list there
+      if (networks != NULL && current_tag_part < ranked_count &&
+          ranked_epoch == network_getScanEpoch()) {
+        wifi_network_info_t *network =
+            &networks->networks[ranked_networks[current_tag_part].index];
+        // Each byte may take 6 chars escaped
+        char ssid[MAX_SSID_LENGTH * 6];
+        mngr_httpd_json_escape(ssid, sizeof(ssid), network->ssid);
+        const uint8_t *bssid = network->bssid;
+        printed = snprintf(
+            pcInsert, iInsertLen,
+            "%s{\"SSID\": \"%s\",\"BSSID\": "
+            "\"%02x:%02x:%02x:%02x:%02x:%02x\",\"RSSI\": \"%d\",\"AUTH\": "
+            "\"%d\",\"APS\": %u}",
+            current_tag_part == 0 ? "" : ",", ssid, bssid[0], bssid[1],
+            bssid[2], bssid[3], bssid[4], bssid[5], network->rssi,
+            network->auth_mode, ranked_networks[current_tag_part].ap_count);
+        *next_tag_part = current_tag_part + 1;
       } else {
         printed = 0;
+        networks = NULL;
       }
       break;
     }
@@ -945,6 +1033,210 @@ static u16_t ssi_handler(int iIndex, char *pcInsert, int iInsertLen
       printed = snprintf(pcInsert, iInsertLen, "%s", version_get_string());
       break;
     }
+    case 20: /* CATMETA */
+    {
+      // Part 0 is the summary, then one part per tag and per device label
+      const catalog_header_t *header = catalog_get_header();
+      const catalog_stats_t *stats = catalog_get_stats();
+      uint16_t tags_end = 1 + header->tag_count;
+      uint16_t devices_end = tags_end + 1 + header->device_count;
+      if (current_tag_part == 0) {
+        printed = snprintf(
+            pcInsert, iInsertLen,
+            "\"ready\": %s, \"fetching\": %s, \"source\": \"%s\", "
+            "\"load_us\": %u, \"fetch_us\": %u, \"build_us\": %u, "
+            "\"count\": %u, \"total\": %u, \"truncated\": %s, \"tags\": [",
+            catalog_get_count() > 0 ? "true" : "false",
+            catalog_get_status() == CATALOG_STATUS_FETCHING ? "true" : "false",
+            stats->source == CATALOG_SOURCE_WARM   ? "warm"
+            : stats->source == CATALOG_SOURCE_COLD ? "cold"
+                                                   : "none",
+            (unsigned)stats->load_us, (unsigned)stats->fetch_us,
+            (unsigned)stats->build_us, (unsigned)catalog_get_count(),
+            (unsigned)header->total_count,
+            catalog_is_truncated() ? "true" : "false");
+      } else if (current_tag_part < tags_end) {
+        uint16_t i = current_tag_part - 1;
+        char tag[CATALOG_LABEL_LENGTH * 6];
+        mngr_httpd_json_escape(tag, sizeof(tag), header->tags[i]);
+        printed = snprintf(pcInsert, iInsertLen, "\"%s\"%s", tag,
+                           (i + 1 < header->tag_count) ? "," : "");
+      } else if (current_tag_part == tags_end) {
+        printed = snprintf(pcInsert, iInsertLen, "], \"devices\": [");
+      } else if (current_tag_part < devices_end) {
+        uint16_t i = current_tag_part - tags_end - 1;
+        char device[CATALOG_LABEL_LENGTH * 6];
+        mngr_httpd_json_escape(device, sizeof(device), header->devices[i]);
+        printed = snprintf(pcInsert, iInsertLen, "\"%s\"%s", device,
+                           (i + 1 < header->device_count) ? "," : "");
+      } else {
+        printed = snprintf(pcInsert, iInsertLen, "]");
+        break;
+      }
+      *next_tag_part = current_tag_part + 1;
+      break;
+    }
+    case 21: /* CATAPPS */
+    {
+      int chunk_size = 128;
+      if (current_tag_part == 0) {
+        catalog_ssi_app = 0;
+        catalog_ssi_offset = 0;
+        catalog_ssi_first = true;
+      }
+      printed = 0;
+      while (catalog_ssi_app < catalog_get_count()) {
+        const catalog_entry_t *entry = catalog_get_entry(catalog_ssi_app);
+        if (!catalog_entry_matches(entry, catalog_tag_filter,
+                                   catalog_device_filter)) {
+          catalog_ssi_app++;
+          catalog_ssi_offset = 0;
+          continue;
+        }
+        // Separate the app objects with a comma
+        size_t comma = (catalog_ssi_offset == 0 && !catalog_ssi_first) ? 1 : 0;
+        size_t room = (size_t)(iInsertLen - 1) - comma;
+        int chunk_len = catalog_read_app_chunk(
+            catalog_ssi_app, catalog_ssi_offset, pcInsert + comma,
+            (room < chunk_size) ? room : chunk_size);
+        if (chunk_len <= 0) {
+          catalog_ssi_app++;
+          catalog_ssi_offset = 0;
+          continue;
+        }
+        if (comma) {
+          pcInsert[0] = ',';
+        }
+        catalog_ssi_first = false;
+        catalog_ssi_offset += chunk_len;
+        if (catalog_ssi_offset >= entry->length) {
+          catalog_ssi_app++;
+          catalog_ssi_offset = 0;
+        }
+        printed = comma + chunk_len;
+        break;
+      }
+      if (printed > 0) {
+        *next_tag_part = current_tag_part + 1;
+      } else {
+        catalog_close_reader();
+      }
+      break;
+    }
+    case 22: /* BOOTPROF */
+    {
+      // Part 0 is the summary, then one part per boot phase and the WiFi
+      // connection path last
+      if (current_tag_part == 0) {
+        printed = snprintf(pcInsert, iInsertLen,
+                           "\"version\": \"%s\", \"date\": \"%s\", "
+                           "\"total_us\": %lu, \"phases\": [",
+                           RELEASE_VERSION, RELEASE_DATE,
+                           (unsigned long)bootprof_get_total_us());
+      } else if (current_tag_part <= BOOTPROF_PHASE_COUNT) {
+        bootprof_phase_t phase = (bootprof_phase_t)(current_tag_part - 1);
+        printed = snprintf(
+            pcInsert, iInsertLen,
+            "{\"name\": \"%s\", \"end_us\": %lu, \"duration_us\": %lu, "
+            "\"skipped\": %s}%s",
+            bootprof_get_name(phase),
+            (unsigned long)bootprof_get_end_us(phase),
+            (unsigned long)bootprof_get_duration_us(phase),
+            bootprof_get_end_us(phase) == 0 ? "true" : "false",
+            (phase + 1 < BOOTPROF_PHASE_COUNT) ? ", " : "");
+      } else {
+        const network_connect_stats_t *wifi = network_getConnectStats();
+        printed = snprintf(
+            pcInsert, iInsertLen,
+            "], \"wifi\": {\"path\": \"%s\", \"fast_tried\": %s, "
+            "\"fast_us\": %lu, \"full_us\": %lu, \"connected_us\": %lu}",
+            wifi->path == NETWORK_CONNECT_PATH_FAST   ? "fast"
+            : wifi->path == NETWORK_CONNECT_PATH_FULL ? "full"
+                                                      : "none",
+            wifi->fastTried ? "true" : "false", (unsigned long)wifi->fastUs,
+            (unsigned long)wifi->fullUs, (unsigned long)wifi->connectedAtUs);
+        break;
+      }
+      *next_tag_part = current_tag_part + 1;
+      break;
+    }
+    case 23: /* VERCHECK */
+    {
+      download_version_t version_status = version_get_status();
+      printed = snprintf(
+          pcInsert, iInsertLen,
+          "\"checking\": %s, \"source\": \"%s\", \"newer\": %s, "
+          "\"latest\": \"%s\", \"current\": \"%s\"",
+          version_is_checking() ? "true" : "false",
+          version_status == DOWNLOAD_VERSION_COMPLETED ? "network"
+          : version_status == DOWNLOAD_VERSION_CACHED  ? "cache"
+                                                       : "builtin",
+          version_isNewer() ? "true" : "false", version_get_string(),
+          RELEASE_VERSION);
+      break;
+    }
+    case 24: /* MIRRORS */
+    {
+      // Inserted in a JSON string of deviceconf.shtml
+      SettingsConfigEntry *mirrors =
+          settings_find_entry(gconfig_getContext(), PARAM_MIRROR_HOSTS);
+      printed = (int)mngr_httpd_json_escape(
+          pcInsert, iInsertLen, mirrors != NULL ? mirrors->value : NULL);
+      break;
+    }
+    case 25: /* NETSTATS */
+    {
+      // Part 0 is the heap and the link, part 1 the TCP counters, then one
+      // part per memory pool
+      uint8_t pools = netstats_get_pool_count();
+      if (current_tag_part == 0) {
+        netstats_pool_t heap;
+        netstats_proto_t link;
+        netstats_get_heap(&heap);
+        netstats_get_link(&link);
+        int32_t rssi = 0;
+        bool has_rssi = network_getCurrentRssi(&rssi);
+        printed = snprintf(
+            pcInsert, iInsertLen,
+            "\"heap\": {\"avail\": %lu, \"used\": %lu, \"max\": %lu, "
+            "\"err\": %lu}, \"link\": {\"xmit\": %lu, \"recv\": %lu, "
+            "\"drop\": %lu, \"err\": %lu, \"rssi\": %ld}, ",
+            (unsigned long)heap.avail, (unsigned long)heap.used,
+            (unsigned long)heap.max, (unsigned long)heap.err,
+            (unsigned long)link.xmit, (unsigned long)link.recv,
+            (unsigned long)link.drop, (unsigned long)link.err,
+            has_rssi ? (long)rssi : 0L);
+      } else if (current_tag_part == 1) {
+        netstats_proto_t tcp;
+        netstats_get_tcp(&tcp);
+        printed = snprintf(
+            pcInsert, iInsertLen,
+            "\"tcp\": {\"xmit\": %lu, \"recv\": %lu, \"rexmit\": %lu, "
+            "\"drop\": %lu, \"memerr\": %lu, \"err\": %lu}, \"pools\": [",
+            (unsigned long)tcp.xmit, (unsigned long)tcp.recv,
+            (unsigned long)tcp.rexmit, (unsigned long)tcp.drop,
+            (unsigned long)tcp.memerr, (unsigned long)tcp.err);
+      } else if (current_tag_part - 2 < pools) {
+        netstats_pool_t pool;
+        uint8_t index = (uint8_t)(current_tag_part - 2);
+        if (netstats_get_pool(index, &pool)) {
+          printed = snprintf(
+              pcInsert, iInsertLen,
+              "{\"name\": \"%s\", \"avail\": %lu, \"used\": %lu, "
+              "\"max\": %lu, \"err\": %lu}%s",
+              pool.name, (unsigned long)pool.avail, (unsigned long)pool.used,
+              (unsigned long)pool.max, (unsigned long)pool.err,
+              (index + 1 < pools) ? ", " : "");
+        } else {
+          printed = 0;
+        }
+      } else {
+        printed = snprintf(pcInsert, iInsertLen, "]");
+        break;
+      }
+      *next_tag_part = current_tag_part + 1;
+      break;
+    }
     case 40: /* WDHCP */
     {
       printed = snprintf(
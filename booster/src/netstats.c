@@ -0,0 +1,73 @@
+/**
+ * File: netstats.c
+ * Author: Diego Parrilla Santamaría
+ * Date: October 2026
+ * Copyright: 2026 - GOODDATA LABS SL
+ * Description: Read access to the lwIP memory counters, with the pool names
+ * that lwIP only keeps in debug builds.
+ */
+
+#include "netstats.h"
+
+// Same order as the memp_t enum
+static const char *const netstats_pool_names[] = {
+#define LWIP_MEMPOOL(name, num, size, desc) #name,
+#include "lwip/priv/memp_std.h"
+};
+
+uint8_t netstats_get_pool_count(void) { return (uint8_t)MEMP_MAX; }
+
+bool netstats_get_pool(uint8_t index, netstats_pool_t *pool) {
+#if LWIP_STATS && MEMP_STATS
+  if (index >= MEMP_MAX || lwip_stats.memp[index] == NULL) {
+    return false;
+  }
+  const struct stats_mem *mem = lwip_stats.memp[index];
+  pool->name = netstats_pool_names[index];
+  pool->avail = mem->avail;
+  pool->used = mem->used;
+  pool->max = mem->max;
+  pool->err = mem->err;
+  return true;
+#else
+  LWIP_UNUSED_ARG(index);
+  LWIP_UNUSED_ARG(pool);
+  return false;
+#endif
+}
+
+void netstats_get_heap(netstats_pool_t *heap) {
+  *heap = (netstats_pool_t){.name = "HEAP"};
+#if LWIP_STATS && MEM_STATS
+  heap->avail = lwip_stats.mem.avail;
+  heap->used = lwip_stats.mem.used;
+  heap->max = lwip_stats.mem.max;
+  heap->err = lwip_stats.mem.err;
+#endif
+}
+
+#if LWIP_STATS
+static void netstats_copy_proto(const struct stats_proto *src,
+                                netstats_proto_t *dst) {
+  dst->xmit = src->xmit;
+  dst->recv = src->recv;
+  dst->rexmit = src->rexmit;
+  dst->drop = src->drop;
+  dst->memerr = src->memerr;
+  dst->err = src->chkerr + src->lenerr + src->proterr + src->opterr + src->err;
+}
+#endif
+
+void netstats_get_tcp(netstats_proto_t *tcp) {
+  *tcp = (netstats_proto_t){0};
+#if LWIP_STATS && TCP_STATS
+  netstats_copy_proto(&lwip_stats.tcp, tcp);
+#endif
+}
+
+void netstats_get_link(netstats_proto_t *link) {
+  *link = (netstats_proto_t){0};
+#if LWIP_STATS && LINK_STATS
+  netstats_copy_proto(&lwip_stats.link, link);
+#endif
+}
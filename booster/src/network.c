@@ -5,6 +5,13 @@ static wifi_mode_t wifiCurrentMode = WIFI_MODE_STA;
 static wifi_network_info_t wifiNetworkInfo = {0};
 static wifi_scan_data_t wifiScanData = {0};
 static bool wifiScanInProgress = false;
+// Open addressing index of the scan table: BSSID hash slot to position in
+// wifiScanData.networks plus one. Zero is an empty slot.
+static uint8_t wifiScanIndex[NETWORK_SCAN_INDEX_SIZE] = {0};
+static uint16_t wifiScanGeneration = 0;
+static uint32_t wifiScanEpoch = 0;
+static uint32_t wifiScanCount = 0;
+static bool wifiScanPassive = false;
 static char wifiHostname[NETWORK_MAX_STRING_LENGTH];
 static ip_addr_t currentIp = {0};
 static uint8_t cyw43Mac[NETWORK_MAC_SIZE];
@@ -19,6 +26,14 @@ static bool mdnsStaRegistered = false;
 // Static variable to store the callback function
 static NetworkPollingCallback networkPollingCallback = NULL;
 
+// Last successful association, loaded from flash on the first connection, and
+// the one made in this boot, persisted later by network_saveFastConnect()
+static network_fast_connect_t fastConnect = {0};
+static bool fastConnectLoaded = false;
+static network_fast_connect_t fastConnectLast = {0};
+static bool fastConnectLastValid = false;
+static network_connect_stats_t connectStats = {0};
+
 static void network_resetConnectionState(void) {
   memset(&currentIp, 0, sizeof(currentIp));
   connectionStatus = DISCONNECTED;
@@ -53,6 +68,16 @@ static void network_resetStaInterface(struct netif *nif) {
   network_resetConnectionState();
 }
 
+#define NETWORK_FNV_OFFSET 2166136261u
+#define NETWORK_FNV_PRIME 16777619u
+
+static uint32_t network_fnv1a(uint32_t hash, const uint8_t *data, size_t len) {
+  for (size_t i = 0; i < len; i++) {
+    hash = (hash ^ data[i]) * NETWORK_FNV_PRIME;
+  }
+  return hash;
+}
+
 static const char *picoSerialStr() {
   static char buf[PICO_UNIQUE_BOARD_ID_SIZE_BYTES * 2 + 1];
   pico_unique_board_id_t boardId;
@@ -460,6 +485,99 @@ void network_safePoll() {
   }
 }
 
+// Look up a BSSID in the scan table. Returns its position, or -1 and the
+// empty slot where it would go. The index always has empty slots because it
+// is larger than MAX_NETWORKS, so the probe ends.
+static int network_scanFind(const uint8_t *bssid, uint32_t *emptySlot) {
+  uint32_t slot = network_fnv1a(NETWORK_FNV_OFFSET, bssid, NETWORK_MAC_SIZE) &
+                  (NETWORK_SCAN_INDEX_SIZE - 1);
+  while (wifiScanIndex[slot] != 0) {
+    int pos = wifiScanIndex[slot] - 1;
+    if (memcmp(wifiScanData.networks[pos].bssid, bssid, NETWORK_MAC_SIZE) ==
+        0) {
+      return pos;
+    }
+    slot = (slot + 1) & (NETWORK_SCAN_INDEX_SIZE - 1);
+  }
+  if (emptySlot != NULL) {
+    *emptySlot = slot;
+  }
+  return -1;
+}
+
+static int network_scanResult(void *env, const cyw43_ev_scan_result_t *result) {
+  LWIP_UNUSED_ARG(env);
+  if (result == NULL) {
+    return 0;
+  }
+  // The SSID in the result is not NUL terminated
+  char ssid[MAX_SSID_LENGTH];
+  size_t ssidLen = result->ssid_len < sizeof(ssid) - 1 ? result->ssid_len
+                                                        : sizeof(ssid) - 1;
+  memcpy(ssid, result->ssid, ssidLen);
+  ssid[ssidLen] = '\0';
+  if (ssid[0] == '\0') {
+    return 0;  // Hidden network
+  }
+
+  uint32_t slot = 0;
+  int pos = network_scanFind(result->bssid, &slot);
+  if (pos >= 0) {
+    // An access point answers several times per scan. Keep its strongest
+    // signal in this scan, and the latest one across scans.
+    if (wifiScanData.networks[pos].last_seen == wifiScanGeneration &&
+        result->rssi <= wifiScanData.networks[pos].rssi) {
+      return 0;
+    }
+  } else {
+    if (wifiScanData.count >= MAX_NETWORKS) {
+      return 0;
+    }
+    pos = wifiScanData.count++;
+    wifiScanIndex[slot] = (uint8_t)(pos + 1);
+    memcpy(wifiScanData.networks[pos].bssid, result->bssid, NETWORK_MAC_SIZE);
+    DPRINTF("FOUND NETWORK %s with auth %d and RSSI %d\n", ssid,
+            result->auth_mode, result->rssi);
+  }
+  wifi_network_info_t *network = &wifiScanData.networks[pos];
+  memcpy(network->ssid, ssid, ssidLen + 1);
+  network->ssid_hash =
+      network_fnv1a(NETWORK_FNV_OFFSET, (const uint8_t *)ssid, ssidLen);
+  network->auth_mode = result->auth_mode;
+  network->rssi = result->rssi;
+  network->channel = result->channel;
+  network->last_seen = wifiScanGeneration;
+  return 0;
+}
+
+// Drop the access points missing from the last NETWORK_SCAN_MAX_AGE scans
+// and rebuild the index over the compacted table
+static void network_scanAge(void) {
+  uint16_t kept = 0;
+  for (uint16_t i = 0; i < wifiScanData.count; i++) {
+    uint16_t age =
+        (uint16_t)(wifiScanGeneration - wifiScanData.networks[i].last_seen);
+    if (age < NETWORK_SCAN_MAX_AGE) {
+      if (kept != i) {
+        wifiScanData.networks[kept] = wifiScanData.networks[i];
+      }
+      kept++;
+    }
+  }
+  if (kept == wifiScanData.count) {
+    return;
+  }
+  DPRINTF("Aged out %u networks\n", (unsigned)(wifiScanData.count - kept));
+  wifiScanData.count = kept;
+  wifiScanEpoch++;
+  memset(wifiScanIndex, 0, sizeof(wifiScanIndex));
+  for (uint16_t i = 0; i < wifiScanData.count; i++) {
+    uint32_t slot = 0;
+    network_scanFind(wifiScanData.networks[i].bssid, &slot);
+    wifiScanIndex[slot] = (uint8_t)(i + 1);
+  }
+}
+
 /**
  * @brief Scans for available Wi-Fi networks and stores the results.
  *
@@ -476,55 +594,20 @@ int network_scan(absolute_time_t *wifiScanTime, int wifiScanInterval) {
     // If the network is not initialized, we cancel the scan
     return -1;
   }
-  int scan_result(void *env, const cyw43_ev_scan_result_t *result) {
-    // Check if the BSSID already exists in the found networks
-    bool bssid_exists(wifi_network_info_t * network) {
-      for (size_t i = 0; i < wifiScanData.count; i++) {
-        if (strcmp(wifiScanData.networks[i].bssid, network->bssid) == 0) {
-          return true;  // BSSID found
-        }
-      }
-      return false;  // BSSID not found
-    }
-    if (result && wifiScanData.count < MAX_NETWORKS) {
-      wifi_network_info_t network;
-
-      // Copy SSID
-      snprintf(network.ssid, sizeof(network.ssid), "%s", result->ssid);
-
-      // Format BSSID
-      snprintf(network.bssid, sizeof(network.bssid),
-               "%02x:%02x:%02x:%02x:%02x:%02x", result->bssid[0],
-               result->bssid[1], result->bssid[2], result->bssid[3],
-               result->bssid[4], result->bssid[5]);
-
-      // Store authentication mode
-      network.auth_mode = result->auth_mode;
-
-      // Store signal strength
-      network.rssi = result->rssi;
-
-      // Check if BSSID already exists
-      if (!bssid_exists(&network)) {
-        if (strlen(network.ssid) > 0) {
-          wifiScanData.networks[wifiScanData.count] = network;
-          wifiScanData.count++;
-          DPRINTF("FOUND NETWORK %s (%s) with auth %d and RSSI %d\n",
-                  network.ssid, network.bssid, network.auth_mode, network.rssi);
-        }
-      }
-    }
-    return 0;
-  }
   // DPRINTF("Time diff: %lld\n", absolute_time_diff_us(get_absolute_time(),
   // (absolute_time_t)*wifi_scan_time));
   if (absolute_time_diff_us(get_absolute_time(), *wifiScanTime) < 0) {
     if (!wifiScanInProgress) {
       DPRINTF("Scanning networks...\n");
       cyw43_wifi_scan_options_t scanOptions = {0};
-      int err = cyw43_wifi_scan(&cyw43_state, &scanOptions, NULL, scan_result);
+      scanOptions.scan_type = wifiScanPassive ? 1 : 0;
+      wifiScanGeneration++;
+      wifiScanCount++;
+      int err = cyw43_wifi_scan(&cyw43_state, &scanOptions, NULL,
+                                network_scanResult);
       if (err == 0) {
-        DPRINTF("Performing wifi scan\n");
+        DPRINTF("Performing %s wifi scan\n",
+                wifiScanPassive ? "passive" : "active");
         wifiScanInProgress = true;
       } else {
         DPRINTF("Failed to start scan: %d\n", err);
@@ -534,6 +617,10 @@ int network_scan(absolute_time_t *wifiScanTime, int wifiScanInterval) {
       if (!cyw43_wifi_scan_active(&cyw43_state)) {
         DPRINTF("Continue scanning...\n");
         wifiScanInProgress = false;
+        // The httpd callbacks read the table from the lwIP context
+        cyw43_arch_lwip_begin();
+        network_scanAge();
+        cyw43_arch_lwip_end();
       }
       *wifiScanTime = make_timeout_time_ms(wifiScanInterval * SEC_TO_MS);
     }
@@ -541,8 +628,13 @@ int network_scan(absolute_time_t *wifiScanTime, int wifiScanInterval) {
   // else {
   //     DPRINTF("Scan already in progress\n");
   // }
+  return 0;
 }
 
+void network_setScanPassive(bool passive) { wifiScanPassive = passive; }
+
+uint32_t network_getScanCount(void) { return wifiScanCount; }
+
 int network_scanIsActive() {
   if (!cyw43Initialized) {
     // If the network is not initialized, we cancel the scan
@@ -562,6 +654,47 @@ int network_scanIsActive() {
  */
 wifi_scan_data_t *network_getFoundNetworks() { return &wifiScanData; }
 
+uint16_t network_rankNetworks(wifi_network_rank_t *ranked,
+                              uint16_t maxRanked) {
+  uint16_t count = 0;
+  for (uint16_t i = 0; i < wifiScanData.count; i++) {
+    const wifi_network_info_t *network = &wifiScanData.networks[i];
+    uint16_t group = 0;
+    for (; group < count; group++) {
+      const wifi_network_info_t *leader =
+          &wifiScanData.networks[ranked[group].index];
+      if (leader->ssid_hash == network->ssid_hash &&
+          strcmp(leader->ssid, network->ssid) == 0) {
+        break;
+      }
+    }
+    if (group < count) {
+      ranked[group].ap_count++;
+      if (network->rssi > wifiScanData.networks[ranked[group].index].rssi) {
+        ranked[group].index = (uint8_t)i;
+      }
+    } else if (count < maxRanked) {
+      ranked[count].index = (uint8_t)i;
+      ranked[count].ap_count = 1;
+      count++;
+    }
+  }
+  // Insertion sort, strongest first. A few dozen networks at most.
+  for (uint16_t i = 1; i < count; i++) {
+    wifi_network_rank_t item = ranked[i];
+    int16_t rssi = wifiScanData.networks[item.index].rssi;
+    int j = (int)i - 1;
+    while (j >= 0 && wifiScanData.networks[ranked[j].index].rssi < rssi) {
+      ranked[j + 1] = ranked[j];
+      j--;
+    }
+    ranked[j + 1] = item;
+  }
+  return count;
+}
+
+uint32_t network_getScanEpoch(void) { return wifiScanEpoch; }
+
 static void wifiLinkCallback(struct netif *netif) {
   if (!netif_is_link_up(netif)) {
     connectionStatus = DISCONNECTED;
@@ -613,7 +746,156 @@ static void srv_txt(struct mdns_service *service, void *txt_userdata) {
 }
 #endif
 
-wifi_sta_conn_process_status_t network_wifiStaConnect() {
+// Hash of the settings an association was made with. A cached association is
+// only reused if the SSID, password and auth mode have not changed.
+static uint32_t network_configHash(const char *ssid, const char *password,
+                                   const char *auth) {
+  const char *fields[] = {ssid, password, auth};
+  const uint8_t separator = 0xff;
+  uint32_t hash = NETWORK_FNV_OFFSET;
+  for (size_t i = 0; i < sizeof(fields) / sizeof(fields[0]); i++) {
+    const char *field = fields[i] != NULL ? fields[i] : "";
+    hash = network_fnv1a(hash, (const uint8_t *)field, strlen(field));
+    hash = network_fnv1a(hash, &separator, 1);
+  }
+  return hash;
+}
+
+static uint32_t network_currentConfigHash(void) {
+  SettingsContext *ctx = gconfig_getContext();
+  SettingsConfigEntry *ssid = settings_find_entry(ctx, PARAM_WIFI_SSID);
+  SettingsConfigEntry *password = settings_find_entry(ctx, PARAM_WIFI_PASSWORD);
+  SettingsConfigEntry *auth = settings_find_entry(ctx, PARAM_WIFI_AUTH);
+  return network_configHash(ssid != NULL ? ssid->value : NULL,
+                            password != NULL ? password->value : NULL,
+                            auth != NULL ? auth->value : NULL);
+}
+
+// The record is a single settings value of comma separated hex fields:
+// bssid,channel,hash,ip,netmask,gateway,dns,lease
+static void network_formatFastConnect(const network_fast_connect_t *fast,
+                                      char *out, size_t outLen) {
+  snprintf(out, outLen,
+           "%02x%02x%02x%02x%02x%02x,%lx,%08lx,%08lx,%08lx,%08lx,%08lx,%lx",
+           fast->bssid[0], fast->bssid[1], fast->bssid[2], fast->bssid[3],
+           fast->bssid[4], fast->bssid[5], (unsigned long)fast->channel,
+           (unsigned long)fast->configHash,
+           (unsigned long)fast->ip, (unsigned long)fast->netmask,
+           (unsigned long)fast->gateway, (unsigned long)fast->dns,
+           (unsigned long)fast->leaseSeconds);
+}
+
+static bool network_parseFastConnect(const char *text,
+                                     network_fast_connect_t *fast) {
+  char *end = NULL;
+  memset(fast, 0, sizeof(*fast));
+  for (int i = 0; i < NETWORK_MAC_SIZE; i++) {
+    char byteStr[3] = {text[i * 2], text[i * 2 + 1], '\0'};
+    if (!isxdigit((unsigned char)byteStr[0]) ||
+        !isxdigit((unsigned char)byteStr[1])) {
+      return false;
+    }
+    fast->bssid[i] = (uint8_t)strtoul(byteStr, NULL, HEX_BASE);
+  }
+  const char *p = text + NETWORK_MAC_SIZE * 2;
+  uint32_t fields[7];
+  for (int i = 0; i < 7; i++) {
+    if (*p != ',') {
+      return false;
+    }
+    fields[i] = strtoul(p + 1, &end, HEX_BASE);
+    if (end == p + 1) {
+      return false;
+    }
+    p = end;
+  }
+  fast->channel = fields[0];
+  fast->configHash = fields[1];
+  fast->ip = fields[2];
+  fast->netmask = fields[3];
+  fast->gateway = fields[4];
+  fast->dns = fields[5];
+  fast->leaseSeconds = fields[6];
+  fast->valid = (*p == '\0');
+  return fast->valid;
+}
+
+static void network_loadFastConnect(void) {
+  fastConnectLoaded = true;
+  SettingsConfigEntry *entry =
+      settings_find_entry(gconfig_getContext(), PARAM_WIFI_FAST_CONNECT);
+  if (entry == NULL || entry->value[0] == '\0') {
+    DPRINTF("No cached association. Full connection\n");
+    return;
+  }
+  if (!network_parseFastConnect(entry->value, &fastConnect)) {
+    DPRINTF("Invalid cached association: %s\n", entry->value);
+    return;
+  }
+  if (fastConnect.configHash != network_currentConfigHash()) {
+    DPRINTF("WiFi settings changed. Cached association ignored\n");
+    fastConnect.valid = false;
+  }
+}
+
+// Remember the association just made: the BSSID and channel of the access
+// point and, with DHCP, the lease granted.
+static void network_recordFastConnect(struct netif *nif) {
+  network_fast_connect_t *fast = &fastConnectLast;
+  memset(fast, 0, sizeof(*fast));
+  if (cyw43_wifi_get_bssid(&cyw43_state, fast->bssid) != 0) {
+    return;
+  }
+  fast->channel = CYW43_CHANNEL_NONE;
+#ifdef CYW43_IOCTL_GET_CHANNEL
+  // Returns hw_channel, target_channel and scan_channel
+  uint32_t channelInfo[3] = {0};
+  if (cyw43_ioctl(&cyw43_state, CYW43_IOCTL_GET_CHANNEL, sizeof(channelInfo),
+                  (uint8_t *)channelInfo, CYW43_ITF_STA) == 0) {
+    fast->channel = channelInfo[0];
+  }
+#endif
+  fast->configHash = network_currentConfigHash();
+  cyw43_arch_lwip_begin();
+  struct dhcp *dhcp = netif_dhcp_data(nif);
+  if (dhcp != NULL && dhcp_supplied_address(nif)) {
+    fast->ip = ip4_addr_get_u32(netif_ip4_addr(nif));
+    fast->netmask = ip4_addr_get_u32(netif_ip4_netmask(nif));
+    fast->gateway = ip4_addr_get_u32(netif_ip4_gw(nif));
+    fast->dns = ip4_addr_get_u32(ip_2_ip4(dns_getserver(0)));
+    fast->leaseSeconds = dhcp->offered_t0_lease;
+  }
+  cyw43_arch_lwip_end();
+  fast->valid = true;
+  fastConnectLastValid = true;
+}
+
+// Seed the DHCP client with the cached lease. When the link comes up lwIP
+// sees a bound client and sends a REQUEST for the same address (INIT-REBOOT,
+// RFC 2131 3.2) instead of a DISCOVER. A NAK or no answer falls back to the
+// full discovery on its own. The caller holds the lwIP lock: the DHCP timers
+// run in the lwIP context and read the same state.
+static void network_primeDhcp(struct netif *nif,
+                              const network_fast_connect_t *fast) {
+  struct dhcp *dhcp = netif_dhcp_data(nif);
+  if (dhcp == NULL || fast->ip == 0 || dhcp->state != DHCP_STATE_INIT) {
+    return;
+  }
+  ip4_addr_set_u32(&dhcp->offered_ip_addr, fast->ip);
+  ip4_addr_set_u32(&dhcp->offered_sn_mask, fast->netmask);
+  ip4_addr_set_u32(&dhcp->offered_gw_addr, fast->gateway);
+  dhcp->state = DHCP_STATE_REBOOTING;
+  if (fast->dns != 0) {
+    ip_addr_t dns;
+    ip_addr_set_ip4_u32(&dns, fast->dns);
+    dns_setserver(0, &dns);
+  }
+  DPRINTF("DHCP INIT-REBOOT with %s\n",
+          ip4addr_ntoa(&dhcp->offered_ip_addr));
+}
+
+static wifi_sta_conn_process_status_t network_wifiStaConnectPath(
+    const network_fast_connect_t *fast, int timeoutSeconds) {
   if (!cyw43Initialized) {
     DPRINTF("WiFi not initialized. Cancelling connection\n");
     return NETWORK_WIFI_STA_CONN_ERR_NOT_INITIALIZED;
@@ -676,6 +958,9 @@ wifi_sta_conn_process_status_t network_wifiStaConnect() {
        settings_find_entry(gconfig_getContext(), PARAM_WIFI_DHCP)->value[0] ==
            'T')) {
     DPRINTF("DHCP enabled\n");
+    if (fast != NULL) {
+      network_primeDhcp(nif, fast);
+    }
   } else {
     DPRINTF("Static IP enabled\n");
     dhcp_stop(nif);
@@ -770,34 +1055,52 @@ wifi_sta_conn_process_status_t network_wifiStaConnect() {
 
   uint32_t authValue = getAuthPicoCode(atoi(authMode->value));
   int errorCode = 0;
+  metrics_inc(METRICS_WIFI_CONNECTS);
   DPRINTF("Connecting to SSID=%s, password=%s, auth=%08x. ASYNC\n", ssid->value,
           passwordValue != NULL ? passwordValue : "<null>", authValue);
-  errorCode =
-      cyw43_arch_wifi_connect_async(ssid->value, passwordValue, authValue);
+  if (fast != NULL) {
+    // Directed association: no scan, straight to the cached access point
+    DPRINTF("Directed join to %02x:%02x:%02x:%02x:%02x:%02x, channel %lu\n",
+            fast->bssid[0], fast->bssid[1], fast->bssid[2], fast->bssid[3],
+            fast->bssid[4], fast->bssid[5], (unsigned long)fast->channel);
+    errorCode = cyw43_wifi_join(
+        &cyw43_state, strlen(ssid->value), (const uint8_t *)ssid->value,
+        passwordValue != NULL ? strlen(passwordValue) : 0,
+        (const uint8_t *)passwordValue,
+        passwordValue != NULL ? authValue : CYW43_AUTH_OPEN, fast->bssid,
+        fast->channel);
+  } else {
+    errorCode =
+        cyw43_arch_wifi_connect_async(ssid->value, passwordValue, authValue);
+  }
   if (errorCode != 0) {
     DPRINTF("Failed to connect to WiFi: %d\n", errorCode);
     return NETWORK_WIFI_STA_CONN_ERR_CONNECTION_FAILED;
   }
 
   // Enter a loop until the device has a WiFi connection with an IP address. Or
-  // timesout.
+  // timesout. The status is checked every NETWORK_CONNECT_POLL_MS, so a fast
+  // association is not rounded up to whole seconds.
   wifi_sta_conn_status_t prevStatus = DISCONNECTED;
-  int wifiConnPollingInterval = 1;  // 1 seconds
-  absolute_time_t wifiConnStatusTime = make_timeout_time_ms(1 * SEC_TO_MS);
+  absolute_time_t statusTime = get_absolute_time();
+  absolute_time_t blinkTime = make_timeout_time_ms(NETWORK_CONNECT_BLINK_MS);
   absolute_time_t wifiConnConnTimeout =
-      make_timeout_time_ms(NETWORK_CONNECT_TIMEOUT * SEC_TO_MS);  // 30 seconds
+      make_timeout_time_ms(timeoutSeconds * SEC_TO_MS);
   while (absolute_time_diff_us(get_absolute_time(), wifiConnConnTimeout) > 0) {
 #ifdef BLINK_H
-    blink_morse('T');
+    if (absolute_time_diff_us(get_absolute_time(), blinkTime) < 0) {
+      blink_toogle();
+      blinkTime = make_timeout_time_ms(NETWORK_CONNECT_BLINK_MS);
+    }
 #endif
 
-    wifi_sta_conn_status_t status =
-        network_wifiConnStatus(&wifiConnStatusTime, wifiConnPollingInterval);
+    wifi_sta_conn_status_t status = network_wifiConnStatus(&statusTime, 0);
 #if PICO_CYW43_ARCH_POLL
     network_safe_poll();
-    cyw43_arch_wait_for_work_until(make_timeout_time_ms(2 * SEC_TO_MS));
+    cyw43_arch_wait_for_work_until(
+        make_timeout_time_ms(NETWORK_CONNECT_POLL_MS));
 #else
-    sleep_ms(NETWORK_POLLING_INTERVAL);
+    sleep_ms(NETWORK_CONNECT_POLL_MS);
 #endif
     if (networkPollingCallback != NULL) {
       networkPollingCallback();
@@ -813,6 +1116,13 @@ wifi_sta_conn_process_status_t network_wifiStaConnect() {
 #endif
       break;
     }
+    if (fast != NULL &&
+        (status == CONNECT_FAILED_ERROR || status == BADAUTH_ERROR ||
+         status == GENERIC_ERROR)) {
+      // The cached access point is gone. Do not wait for the timeout.
+      DPRINTF("Directed join failed: %s\n", network_wifiConnStatusStr());
+      return NETWORK_WIFI_STA_CONN_ERR_CONNECTION_FAILED;
+    }
   }
   if (absolute_time_diff_us(get_absolute_time(), wifiConnConnTimeout) <= 0) {
     DPRINTF("WiFi connection timeout\n");
@@ -821,9 +1131,71 @@ wifi_sta_conn_process_status_t network_wifiStaConnect() {
   }
 
   DPRINTF("Connected. Check the connection status...\n");
+  network_recordFastConnect(nif);
   return 0;
 }
 
+wifi_sta_conn_process_status_t network_wifiStaConnect() {
+  if (!fastConnectLoaded) {
+    network_loadFastConnect();
+  }
+
+  wifi_sta_conn_process_status_t res;
+  uint32_t startUs;
+  if (fastConnect.valid) {
+    connectStats.fastTried = true;
+    startUs = time_us_32();
+    res = network_wifiStaConnectPath(&fastConnect,
+                                     NETWORK_FAST_CONNECT_TIMEOUT);
+    connectStats.fastUs += time_us_32() - startUs;
+    if (res == NETWORK_WIFI_STA_CONN_OK) {
+      connectStats.path = NETWORK_CONNECT_PATH_FAST;
+      connectStats.connectedAtUs = time_us_32();
+      DPRINTF("Fast path connected in %lu ms, %lu ms since power-on\n",
+              (unsigned long)(connectStats.fastUs / 1000),
+              (unsigned long)(connectStats.connectedAtUs / 1000));
+      return res;
+    }
+    // Only once per boot. The retries go through the full path.
+    DPRINTF("Fast path failed (%d). Falling back to the full path\n", res);
+    fastConnect.valid = false;
+  }
+
+  startUs = time_us_32();
+  res = network_wifiStaConnectPath(NULL, NETWORK_CONNECT_TIMEOUT);
+  connectStats.fullUs += time_us_32() - startUs;
+  if (res == NETWORK_WIFI_STA_CONN_OK) {
+    connectStats.path = NETWORK_CONNECT_PATH_FULL;
+    connectStats.connectedAtUs = time_us_32();
+    DPRINTF("Full path connected in %lu ms, %lu ms since power-on\n",
+            (unsigned long)(connectStats.fullUs / 1000),
+            (unsigned long)(connectStats.connectedAtUs / 1000));
+  }
+  return res;
+}
+
+void network_saveFastConnect(void) {
+  if (!fastConnectLastValid) {
+    return;
+  }
+  char value[SETTINGS_MAX_VALUE_LENGTH];
+  network_formatFastConnect(&fastConnectLast, value, sizeof(value));
+  SettingsContext *ctx = gconfig_getContext();
+  SettingsConfigEntry *entry =
+      settings_find_entry(ctx, PARAM_WIFI_FAST_CONNECT);
+  // Only erase the flash when the access point or the lease changed
+  if (entry == NULL || strcmp(entry->value, value) == 0) {
+    return;
+  }
+  DPRINTF("Saving the association for the next boot: %s\n", value);
+  settings_put_string(ctx, PARAM_WIFI_FAST_CONNECT, value);
+  settings_save(ctx, true);
+}
+
+const network_connect_stats_t *network_getConnectStats(void) {
+  return &connectStats;
+}
+
 char *network_wifiConnStatusStr() { return connectionStatusStr; }
 
 wifi_sta_conn_status_t network_wifiConnStatus(
@@ -841,6 +1213,7 @@ wifi_sta_conn_status_t network_wifiConnStatus(
   if ((wifiConnStatusTime == NULL) ||
       (absolute_time_diff_us(get_absolute_time(), *wifiConnStatusTime) < 0)) {
     // Check the connection status
+    wifi_sta_conn_status_t prevStatus = connectionStatus;
     int linkStatus = cyw43_tcpip_link_status(&cyw43_state, CYW43_ITF_STA);
     switch (linkStatus) {
       case CYW43_LINK_DOWN: {
@@ -887,6 +1260,9 @@ wifi_sta_conn_status_t network_wifiConnStatus(
                  "LINK UNKNOWN");
       }
     }
+    if (prevStatus == CONNECTED_WIFI_IP && connectionStatus != prevStatus) {
+      metrics_inc(METRICS_WIFI_LINK_LOSSES);
+    }
     *wifiConnStatusTime =
         make_timeout_time_ms(wifiConStatusInterval * SEC_TO_MS);
   }
@@ -940,6 +1316,7 @@ bool network_getCurrentRssi(int32_t *rssi) {
     *rssi = 0;
     return false;
   }
+  metrics_set(METRICS_GAUGE_WIFI_RSSI, *rssi);
 
   return *rssi != 0;
 }
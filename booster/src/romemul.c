@@ -30,7 +30,7 @@ void __not_in_flash_func(dma_irq_handler_lookup)(void) {
 
   dma_hw->ints1 = 1u << lookup_data_rom_dma_channel;
 
-  DPRINTF("DMA_LSB LOOKUP: $%x\n", addr_lsb);
+  TRACE1(ROMEMUL_LOOKUP, addr_lsb);
 
   // Clear the interrupt request for the channel
 
@@ -43,7 +43,7 @@ void __not_in_flash_func(dma_irq_handler_address)(void) {
   uint32_t addr =
       (uint32_t)dma_hw->ch[read_addr_rom_dma_channel].al3_read_addr_trig;
   uint16_t value = *((uint16_t *)addr);
-  DPRINTF("DMA ADDR: $%x, VALUE: $%x\n", addr, value);
+  TRACE2(ROMEMUL_ADDRESS, addr, value);
 
   // Clear the interrupt request for the channel
   dma_hw->ints0 = 1u << read_addr_rom_dma_channel;
@@ -1,6 +1,6 @@
 #include "sdcard.h"
 
-static sdcard_status_t sdcardInit() {
+sdcard_status_t sdcard_initDriver() {
   DPRINTF("Initializing SD card...\n");
   // Initialize the SD card
   bool success = sd_init_driver();
@@ -37,7 +37,7 @@ bool sdcard_dirExist(const char *dir) {
 
 sdcard_status_t sdcard_initFilesystem(FATFS *fsPtr, const char *folderName) {
   // Check the status of the sd card
-  sdcard_status_t sdcardOk = sdcardInit();
+  sdcard_status_t sdcardOk = sdcard_initDriver();
   if (sdcardOk != SDCARD_INIT_OK) {
     DPRINTF("Error initializing the SD card.\n");
     return SDCARD_INIT_ERROR;
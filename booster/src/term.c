@@ -12,16 +12,39 @@
 #include <stdarg.h>
 
 #include "appmngr.h"
+#include "bootprof.h"
+#include "catalog.h"
 #include "display_mngr.h"
 
 #define TERM_MENU_TITLE "Downloaded apps\n"
-#define TERM_MENU_INSTRUCTIONS "Type app number and press Enter\n"
+#define TERM_MENU_INSTRUCTIONS "Type app number or /name and Enter\n"
 #define TERM_MENU_RETURN_OPTION "0. Return to connection menu\n"
+#define TERM_MENU_CATALOG_OPTION "C. Browse the apps catalog\n"
+#define TERM_MENU_BOOT_OPTION "B. Show the boot timeline\n"
 #define TERM_MENU_PROMPT "App #: "
+#define TERM_MENU_BROWSE_STATUS "Apps %u-%u of %u. Arrow keys scroll"
+#define TERM_MENU_SEARCH_CHAR '/'
+#define TERM_CATALOG_TITLE "Apps catalog (* = downloaded)\n"
+#define TERM_CATALOG_RETURN "Press Enter to return\n"
+#define TERM_BOOT_TITLE "Boot timeline (ms)\n"
+// Title, blank line and return lines around the catalog list
+#define TERM_CATALOG_MAX_LINES (TERM_SCREEN_SIZE_Y - 4)
+// The apps menu is a fixed header, a window on the list of apps, a status
+// line and the prompt in the last line
+#define TERM_MENU_HEADER_ROWS 5
+#define TERM_MENU_LIST_ROWS (TERM_SCREEN_SIZE_Y - TERM_MENU_HEADER_ROWS - 2)
+#define TERM_MENU_STATUS_ROW (TERM_SCREEN_SIZE_Y - 2)
+#define TERM_MENU_PROMPT_ROW (TERM_SCREEN_SIZE_Y - 1)
+// Input that fits in the prompt line, keeping the last column for the cursor
+#define TERM_MENU_INPUT_MAX (TERM_SCREEN_SIZE_X - sizeof(TERM_MENU_PROMPT))
+
+// Screens shown on top of the apps menu
+typedef enum { TERM_VIEW_MENU, TERM_VIEW_CATALOG, TERM_VIEW_BOOT } term_view_t;
 
 static TransmissionProtocol last_protocol;
 static bool last_protocol_valid = false;
 static bool term_active = false;
+static term_view_t term_view = TERM_VIEW_MENU;
 
 static uint32_t memory_shared_address = 0;
 static uint32_t memory_random_token_address = 0;
@@ -37,6 +60,8 @@ static uint8_t prev_cursor_x = 0;
 static uint8_t prev_cursor_y = 0;
 static char input_buffer[TERM_INPUT_BUFFER_SIZE];
 static size_t input_length = 0;
+static uint16_t menu_first = 0;  // First app in the window of the menu
+static int menu_selected = -1;   // App highlighted in the menu, -1 if none
 
 /**
  * @brief Callback that handles the protocol command received.
@@ -52,12 +77,13 @@ static void __not_in_flash_func(handle_protocol_command)(
     const TransmissionProtocol *protocol) {
   memcpy(&last_protocol, protocol, sizeof(TransmissionProtocol));
   last_protocol_valid = true;
+  metrics_inc(METRICS_PROTOCOL_COMMANDS);
 }
 
 static void __not_in_flash_func(handle_protocol_checksum_error)(
     const TransmissionProtocol *protocol) {
-  DPRINTF("Checksum error detected (ID=%u, Size=%u)\n", protocol->command_id,
-          protocol->payload_size);
+  metrics_inc(METRICS_PROTOCOL_CHECKSUM_ERRORS);
+  TRACE2(PROTOCOL_CHECKSUM, protocol->command_id, protocol->payload_size);
 }
 
 static void term_reset_input(void) {
@@ -67,10 +93,13 @@ static void term_reset_input(void) {
 
 static void term_leave_to_manager(void) {
   term_active = false;
+  term_view = TERM_VIEW_MENU;
   installed_app_count = 0;
   installed_apps_ready = false;
   term_reset_input();
   SEND_COMMAND_TO_DISPLAY(DISPLAY_COMMAND_NOP);
+  // The manager screens draw in screen order
+  display_reset_scroll();
   display_mngr_redraw_current();
 }
 
@@ -81,6 +110,8 @@ static uint16_t term_load_installed_apps(void) {
 static void term_refresh_apps_cache(void) {
   installed_apps_ready = appmngr_get_sdcard_info()->ready;
   installed_app_count = installed_apps_ready ? term_load_installed_apps() : 0;
+  menu_first = 0;
+  menu_selected = -1;
 }
 
 void __not_in_flash_func(term_dma_irq_handler_lookup)(void) {
@@ -112,6 +143,7 @@ void term_init(void) {
                           new_random_seed_token);
 
   term_active = false;
+  term_view = TERM_VIEW_MENU;
   installed_app_count = 0;
   installed_apps_ready = false;
   term_reset_input();
@@ -128,39 +160,71 @@ static void term_clear_screen(void) {
   display_term_clear();
 }
 
-static void term_scroll_up(void) {
-  memmove(screen, screen + TERM_SCREEN_SIZE_X,
-          TERM_SCREEN_SIZE - TERM_SCREEN_SIZE_X);
-  memset(screen + TERM_SCREEN_SIZE - TERM_SCREEN_SIZE_X, 0, TERM_SCREEN_SIZE_X);
-  display_scrollup(TERM_DISPLAY_ROW_BYTES);
+// Scroll the screen up by rows of chars. The display buffer scrolls once for
+// all of them.
+static void term_scroll_up(uint8_t rows) {
+  if (rows == 0) {
+    return;
+  }
+  if (rows > TERM_SCREEN_SIZE_Y) {
+    rows = TERM_SCREEN_SIZE_Y;
+  }
+  size_t kept = (size_t)(TERM_SCREEN_SIZE_Y - rows) * TERM_SCREEN_SIZE_X;
+  memmove(screen, screen + rows * TERM_SCREEN_SIZE_X, kept);
+  memset(screen + kept, 0, TERM_SCREEN_SIZE - kept);
+  display_scrollup(rows);
 }
 
-static void term_put_char(char c) {
-  screen[cursor_y * TERM_SCREEN_SIZE_X + cursor_x] = c;
-  display_term_char(cursor_x, cursor_y, c);
-  cursor_x++;
-  if (cursor_x >= TERM_SCREEN_SIZE_X) {
-    cursor_x = 0;
-    cursor_y++;
-    if (cursor_y >= TERM_SCREEN_SIZE_Y) {
-      term_scroll_up();
-      cursor_y = TERM_SCREEN_SIZE_Y - 1;
+// Write text at the cursor without refreshing the display. The lines the
+// text needs are counted first, so the screen scrolls at most once, then the
+// text is drawn a run at a time and the cursor once at the end.
+static void term_write_text(const char *buf, size_t len) {
+  // Rows the cursor moves down
+  uint16_t lines = 0;
+  uint8_t x = cursor_x;
+  for (size_t i = 0; i < len; i++) {
+    if (buf[i] == '\n' || buf[i] == '\r' || ++x >= TERM_SCREEN_SIZE_X) {
+      x = 0;
+      lines++;
     }
   }
-}
+  uint16_t scroll = 0;
+  if (cursor_y + lines > TERM_SCREEN_SIZE_Y - 1) {
+    scroll = cursor_y + lines - (TERM_SCREEN_SIZE_Y - 1);
+  }
 
-static void term_render_char(char c) {
   display_term_char(prev_cursor_x, prev_cursor_y, ' ');
-  if (c == '\n' || c == '\r') {
-    cursor_x = 0;
-    cursor_y++;
-    if (cursor_y >= TERM_SCREEN_SIZE_Y) {
-      term_scroll_up();
-      cursor_y = TERM_SCREEN_SIZE_Y - 1;
+  term_scroll_up(scroll > TERM_SCREEN_SIZE_Y ? TERM_SCREEN_SIZE_Y : scroll);
+
+  // Rows above the top of the screen were scrolled out: skip them
+  int y = (int)cursor_y - (int)scroll;
+  x = cursor_x;
+  size_t i = 0;
+  while (i < len) {
+    if (buf[i] == '\n' || buf[i] == '\r') {
+      x = 0;
+      y++;
+      i++;
+      continue;
+    }
+    uint8_t run = 0;
+    while (i + run < len && buf[i + run] != '\n' && buf[i + run] != '\r' &&
+           x + run < TERM_SCREEN_SIZE_X) {
+      run++;
+    }
+    if (y >= 0) {
+      memcpy(&screen[y * TERM_SCREEN_SIZE_X + x], &buf[i], run);
+      display_term_chars(x, (uint8_t)y, &buf[i], run);
+    }
+    i += run;
+    x += run;
+    if (x >= TERM_SCREEN_SIZE_X) {
+      x = 0;
+      y++;
     }
-  } else {
-    term_put_char(c);
   }
+  cursor_x = x;
+  cursor_y = (uint8_t)y;
 
   display_term_cursor(cursor_x, cursor_y);
   prev_cursor_x = cursor_x;
@@ -168,11 +232,7 @@ static void term_render_char(char c) {
 }
 
 static void term_print_string(const char *str) {
-  while (*str) {
-    term_render_char(*str);
-    str++;
-  }
-  display_term_refresh();
+  term_write_text(str, strlen(str));
 }
 
 static void term_printf(const char *fmt, ...) {
@@ -180,35 +240,212 @@ static void term_printf(const char *fmt, ...) {
   char buffer[256];
 
   va_start(args, fmt);
-  vsnprintf(buffer, sizeof(buffer), fmt, args);
+  int len = vsnprintf(buffer, sizeof(buffer), fmt, args);
   va_end(args);
-  term_print_string(buffer);
+  if (len < 0) {
+    return;
+  }
+  term_write_text(buffer, ((size_t)len < sizeof(buffer)) ? (size_t)len
+                                                         : sizeof(buffer) - 1);
+}
+
+// Write a whole line of the screen in place, padded with spaces. The cursor
+// does not move.
+static void term_write_line(uint8_t row, const char *text) {
+  char *line = &screen[row * TERM_SCREEN_SIZE_X];
+  size_t len = strnlen(text, TERM_SCREEN_SIZE_X);
+  memcpy(line, text, len);
+  memset(line + len, ' ', TERM_SCREEN_SIZE_X - len);
+  display_term_chars(0, row, line, TERM_SCREEN_SIZE_X);
+}
+
+// Draw only the apps in the window of the menu, from the cache in memory
+static void term_draw_menu_list(void) {
+  char line[TERM_SCREEN_SIZE_X + 1];
+  for (uint8_t row = 0; row < TERM_MENU_LIST_ROWS; row++) {
+    uint16_t index = menu_first + row;
+    line[0] = '\0';
+    if (index < installed_app_count) {
+      const appmngr_installed_app_t *app = &installed_apps[index];
+      char mark = ((int)index == menu_selected) ? '>' : ' ';
+      if (app->version[0] != '\0') {
+        snprintf(line, sizeof(line), "%c%u. %s (%s)", mark,
+                 (unsigned)(index + 1), app->name, app->version);
+      } else {
+        snprintf(line, sizeof(line), "%c%u. %s", mark, (unsigned)(index + 1),
+                 app->name);
+      }
+    }
+    term_write_line(TERM_MENU_HEADER_ROWS + row, line);
+  }
 }
 
-static void term_print_prompt(void) { term_print_string(TERM_MENU_PROMPT); }
+// Show a message in the status line of the menu, or where the window is in
+// the list if the message is NULL
+static void term_menu_status(const char *status) {
+  char line[TERM_SCREEN_SIZE_X + 1];
+  if (status == NULL) {
+    if (!installed_apps_ready) {
+      status = "SD card not ready";
+    } else if (installed_app_count == 0) {
+      status = "No downloaded apps found";
+    } else {
+      uint16_t last = menu_first + TERM_MENU_LIST_ROWS;
+      if (last > installed_app_count) {
+        last = installed_app_count;
+      }
+      snprintf(line, sizeof(line), TERM_MENU_BROWSE_STATUS,
+               (unsigned)(menu_first + 1), (unsigned)last,
+               (unsigned)installed_app_count);
+      status = line;
+    }
+  }
+  term_write_line(TERM_MENU_STATUS_ROW, status);
+}
 
+// Draw the prompt line with the input typed so far and the cursor after it
+static void term_menu_prompt(void) {
+  char line[TERM_SCREEN_SIZE_X + 1];
+  snprintf(line, sizeof(line), "%s%s", TERM_MENU_PROMPT, input_buffer);
+  term_write_line(TERM_MENU_PROMPT_ROW, line);
+  cursor_x = (uint8_t)strlen(line);
+  cursor_y = TERM_MENU_PROMPT_ROW;
+  display_term_cursor(cursor_x, cursor_y);
+  prev_cursor_x = cursor_x;
+  prev_cursor_y = cursor_y;
+}
+
+// Nothing below refreshes the display: term_loop() publishes the changes
+// once per command, whatever the number of keys in it.
 static void term_print_menu(void) {
+  uint64_t start_us = time_us_64();
   term_clear_screen();
   term_print_string(TERM_MENU_TITLE);
   term_print_string(TERM_MENU_INSTRUCTIONS);
   term_print_string(TERM_MENU_RETURN_OPTION);
+  term_print_string(TERM_MENU_CATALOG_OPTION);
+  term_print_string(TERM_MENU_BOOT_OPTION);
+  term_draw_menu_list();
+  term_menu_status(NULL);
+  term_menu_prompt();
+  DPRINTF("Menu drawn in %llu us\n", time_us_64() - start_us);
+  (void)start_us;
+}
 
-  if (!installed_apps_ready) {
-    term_print_string("SD card not ready\n");
-  } else if (installed_app_count == 0) {
-    term_print_string("No downloaded apps found\n");
+// Highlight an app and move the window of the menu to show it
+static void term_menu_select(int index) {
+  if (installed_app_count == 0) {
+    return;
+  }
+  if (index < 0) {
+    index = 0;
+  } else if (index >= installed_app_count) {
+    index = installed_app_count - 1;
+  }
+  menu_selected = index;
+  if (index < menu_first) {
+    menu_first = (uint16_t)index;
+  } else if (index >= menu_first + TERM_MENU_LIST_ROWS) {
+    menu_first = (uint16_t)(index - TERM_MENU_LIST_ROWS + 1);
+  }
+  term_draw_menu_list();
+  term_menu_status(NULL);
+}
+
+// Case insensitive search of text in name
+static bool term_name_contains(const char *name, const char *text) {
+  size_t len = strlen(text);
+  for (; *name != '\0'; name++) {
+    size_t i = 0;
+    while (i < len && name[i] != '\0' &&
+           tolower((unsigned char)name[i]) == tolower((unsigned char)text[i])) {
+      i++;
+    }
+    if (i == len) {
+      return true;
+    }
+  }
+  return false;
+}
+
+// Highlight the first app with the text in its name
+static void term_menu_search(const char *text) {
+  if (*text == '\0') {
+    return;
+  }
+  for (uint16_t i = 0; i < installed_app_count; i++) {
+    if (term_name_contains(installed_apps[i].name, text)) {
+      term_menu_select(i);
+      return;
+    }
+  }
+  // Drop the highlight so Enter cannot launch an app that does not match
+  if (menu_selected >= 0) {
+    menu_selected = -1;
+    term_draw_menu_list();
+  }
+  term_menu_status("No app matches");
+}
+
+static bool term_is_app_installed(const char *uuid) {
+  for (uint16_t i = 0; i < installed_app_count; i++) {
+    if (strcmp(installed_apps[i].uuid, uuid) == 0) {
+      return true;
+    }
+  }
+  return false;
+}
+
+static void term_print_catalog(void) {
+  term_view = TERM_VIEW_CATALOG;
+  term_clear_screen();
+  term_print_string(TERM_CATALOG_TITLE);
+  term_print_string("\n");
+
+  uint16_t count = catalog_get_count();
+  if (count == 0) {
+    term_print_string(catalog_get_status() == CATALOG_STATUS_FETCHING
+                          ? "Catalog download in progress\n"
+                          : "Catalog not available yet\n");
   } else {
-    for (uint16_t i = 0; i < installed_app_count; i++) {
-      if (installed_apps[i].version[0] != '\0') {
-        term_printf("%u. %s (%s)\n", (unsigned)(i + 1), installed_apps[i].name,
-                    installed_apps[i].version);
-      } else {
-        term_printf("%u. %s\n", (unsigned)(i + 1), installed_apps[i].name);
-      }
+    uint16_t shown = (count > TERM_CATALOG_MAX_LINES)
+                         ? (TERM_CATALOG_MAX_LINES - 1)
+                         : count;
+    for (uint16_t i = 0; i < shown; i++) {
+      const catalog_entry_t *entry = catalog_get_entry(i);
+      term_printf("%c %s (%s)\n",
+                  term_is_app_installed(entry->uuid) ? '*' : ' ', entry->name,
+                  entry->version);
+    }
+    if (shown < count) {
+      term_printf("  ... and %u more\n", (unsigned)(count - shown));
     }
   }
+  term_print_string(TERM_CATALOG_RETURN);
+}
 
-  term_print_prompt();
+static void term_print_boot_timeline(void) {
+  term_view = TERM_VIEW_BOOT;
+  term_clear_screen();
+  term_print_string(TERM_BOOT_TITLE);
+  term_print_string("\n");
+  for (int i = 0; i < BOOTPROF_PHASE_COUNT; i++) {
+    if (bootprof_get_end_us(i) == 0) {
+      term_printf("%-16s  skipped\n", bootprof_get_name(i));
+    } else {
+      term_printf("%-16s %8lu\n", bootprof_get_name(i),
+                  (unsigned long)(bootprof_get_duration_us(i) / 1000));
+    }
+  }
+  term_printf("%-16s %8lu\n", "total",
+              (unsigned long)(bootprof_get_total_us() / 1000));
+  const network_connect_stats_t *wifi = network_getConnectStats();
+  if (wifi->path != NETWORK_CONNECT_PATH_NONE) {
+    term_printf("WiFi %s path, connected at %lu\n",
+                wifi->path == NETWORK_CONNECT_PATH_FAST ? "fast" : "full",
+                (unsigned long)(wifi->connectedAtUs / 1000));
+  }
+  term_print_string(TERM_CATALOG_RETURN);
 }
 
 static void term_enter_menu(void) {
@@ -222,17 +459,25 @@ static void term_enter_menu(void) {
 }
 
 static void term_show_status(const char *status) {
-  term_print_string(status);
-  term_print_string("\n");
-  term_print_prompt();
+  term_reset_input();
+  term_menu_status(status);
+  term_menu_prompt();
 }
 
 static void term_handle_selection(void) {
   char *endptr = NULL;
   long selected_index = 0;
 
-  if (input_length == 0) {
-    term_show_status("Enter an app number");
+  // Without a number, run the app highlighted with the arrow keys or search
+  if (input_length == 0 || input_buffer[0] == TERM_MENU_SEARCH_CHAR) {
+    if (menu_selected < 0) {
+      term_show_status(input_length == 0 ? "Enter an app number"
+                                         : "No app matches");
+      return;
+    }
+    term_reset_input();
+    appmngr_schedule_launch_app(installed_apps[menu_selected].uuid);
+    term_leave_to_manager();
     return;
   }
 
@@ -285,7 +530,6 @@ static void term_input_char(char c) {
           cursor_y--;
           cursor_x = TERM_SCREEN_SIZE_X - 1;
         } else {
-          display_term_refresh();
           return;
         }
       } else {
@@ -294,31 +538,114 @@ static void term_input_char(char c) {
 
       screen[cursor_y * TERM_SCREEN_SIZE_X + cursor_x] = 0;
       display_term_char(cursor_x, cursor_y, ' ');
+
+      if (term_view == TERM_VIEW_MENU &&
+          input_buffer[0] == TERM_MENU_SEARCH_CHAR) {
+        term_menu_search(input_buffer + 1);
+      }
     }
 
     display_term_cursor(cursor_x, cursor_y);
     prev_cursor_x = cursor_x;
     prev_cursor_y = cursor_y;
-    display_term_refresh();
+    return;
+  }
+
+  if (term_view != TERM_VIEW_MENU) {
+    // Any line end goes back to the apps menu
+    if (c == '\n' || c == '\r') {
+      term_view = TERM_VIEW_MENU;
+      term_reset_input();
+      term_print_menu();
+    }
+    return;
+  }
+
+  if ((c == 'c' || c == 'C') && input_length == 0) {
+    term_print_catalog();
+    return;
+  }
+
+  if ((c == 'b' || c == 'B') && input_length == 0) {
+    term_print_boot_timeline();
     return;
   }
 
   if (c == '\n' || c == '\r') {
-    term_render_char('\n');
     term_handle_selection();
-    display_term_refresh();
     return;
   }
 
-  if (!isdigit((unsigned char)c)) {
+  // A number, or a search if the input starts with the search char
+  bool search = (input_length > 0) ? input_buffer[0] == TERM_MENU_SEARCH_CHAR
+                                   : c == TERM_MENU_SEARCH_CHAR;
+  if (search ? (c < 0x20 || c > 0x7E) : !isdigit((unsigned char)c)) {
     return;
   }
 
-  if (input_length < TERM_INPUT_BUFFER_SIZE - 1) {
+  if (input_length < TERM_MENU_INPUT_MAX) {
     input_buffer[input_length++] = c;
     input_buffer[input_length] = '\0';
-    term_render_char(c);
-    display_term_refresh();
+    if (search) {
+      term_menu_search(input_buffer + 1);
+    }
+    term_write_text(&c, 1);
+  }
+}
+
+// Keys without a char: the arrow keys browse the apps menu
+static void term_input_scan_code(uint8_t scan_code) {
+  if (!term_active || term_view != TERM_VIEW_MENU) {
+    return;
+  }
+
+  int index = menu_selected;
+  switch (scan_code) {
+    case TERM_SCAN_CODE_UP:
+      index--;
+      break;
+    case TERM_SCAN_CODE_DOWN:
+      index++;
+      break;
+    case TERM_SCAN_CODE_LEFT:
+      index -= TERM_MENU_LIST_ROWS;
+      break;
+    case TERM_SCAN_CODE_RIGHT:
+      index += TERM_MENU_LIST_ROWS;
+      break;
+    case TERM_SCAN_CODE_HOME:
+      index = 0;
+      break;
+    default:
+      return;
+  }
+  // The first key only highlights the top of the window
+  if (menu_selected < 0 && scan_code != TERM_SCAN_CODE_HOME) {
+    index = menu_first;
+  }
+  term_menu_select(index);
+}
+
+// A key as read by the computer: ASCII code in the low byte, scan code in
+// the third one and the shift keys in the high one
+static void term_input_key(uint32_t key) {
+  char keystroke = (char)(key & 0xFF);
+  uint8_t shift_key = (key & 0xFF000000) >> 24;
+  uint8_t scan_code = (key & 0xFF0000) >> 16;
+
+  if (keystroke >= 0x20 && keystroke <= 0x7E) {
+    DPRINTF("Keystroke: %c. Shift key: %d, Scan code: %d\n", keystroke,
+            shift_key, scan_code);
+  } else {
+    DPRINTF("Keystroke: %d. Shift key: %d, Scan code: %d\n", keystroke,
+            shift_key, scan_code);
+  }
+  (void)shift_key;
+
+  if (keystroke == 0) {
+    term_input_scan_code(scan_code);
+  } else {
+    term_input_char(keystroke);
   }
 }
 
@@ -365,21 +692,20 @@ void __not_in_flash_func(term_loop)(void) {
       case APP_TERMINAL_KEYSTROKE: {
         uint16_t *payload = ((uint16_t *)(last_protocol).payload);
         TPROTO_NEXT32_PAYLOAD_PTR(payload);
-
-        uint32_t payload32 = TPROTO_GET_PAYLOAD_PARAM32(payload);
-        char keystroke = (char)(payload32 & 0xFF);
-        uint8_t shift_key = (payload32 & 0xFF000000) >> 24;
-        uint8_t scan_code = (payload32 & 0xFF0000) >> 16;
-
-        if (keystroke >= 0x20 && keystroke <= 0x7E) {
-          DPRINTF("Keystroke: %c. Shift key: %d, Scan code: %d\n", keystroke,
-                  shift_key, scan_code);
-        } else {
-          DPRINTF("Keystroke: %d. Shift key: %d, Scan code: %d\n", keystroke,
-                  shift_key, scan_code);
+        term_input_key(TPROTO_GET_PAYLOAD_PARAM32(payload));
+        break;
+      }
+      case APP_TERMINAL_KEYSTROKES: {
+        // The keys typed between two commands, oldest first. Empty slots are 0
+        uint16_t *payload = ((uint16_t *)(last_protocol).payload);
+        TPROTO_NEXT32_PAYLOAD_PTR(payload);
+        for (int i = 0; i < TERM_KEYSTROKES_BATCH; i++) {
+          uint32_t key = TPROTO_GET_PAYLOAD_PARAM32(payload);
+          TPROTO_NEXT32_PAYLOAD_PTR(payload);
+          if (key != 0) {
+            term_input_key(key);
+          }
         }
-
-        term_input_char(keystroke);
         break;
       }
       default:
@@ -387,6 +713,11 @@ void __not_in_flash_func(term_loop)(void) {
         break;
     }
 
+    // One frame for all the changes made by the command
+    if (term_active) {
+      display_term_refresh();
+    }
+
     if (memory_random_token_address != 0) {
       TPROTO_SET_RANDOM_TOKEN(memory_random_token_address, random_token);
 
@@ -0,0 +1,256 @@
+/**
+ * File: trace.c
+ * Author: Diego Parrilla Santamaría
+ * Date: October 2026
+ * Copyright: 2026 - GOODDATA LABS SL
+ * Description: Binary trace log. Records an event id and its raw arguments in
+ * a RAM ring per core, with no formatting, so the IRQ handlers can be traced
+ * without changing the bus timing. The dumps are formatted on the host by
+ * decode_trace.py with the format strings of trace_events.h.
+ */
+
+#include "trace.h"
+
+#include "hardware/sync.h"
+
+#if BOOSTER_TRACE
+
+#define TRACE_PRINT_BYTES 32  // Bytes per line of trace_print()
+
+static trace_record_t trace_rings[NUM_CORES][TRACE_RING_RECORDS];
+static volatile uint32_t trace_heads[NUM_CORES] = {0};
+static volatile bool trace_paused = false;
+
+// Headers and answers of the custom files
+static char trace_http_header[128];
+static char trace_answer[192];
+
+void __not_in_flash_func(trace_record)(trace_event_t event, uint8_t nargs,
+                                       uint32_t a0, uint32_t a1, uint32_t a2,
+                                       uint32_t a3) {
+  if (trace_paused) {
+    return;
+  }
+  uint core = get_core_num();
+  // Only an IRQ on this same core could take the same slot
+  uint32_t irq = save_and_disable_interrupts();
+  uint32_t head = trace_heads[core]++;
+  restore_interrupts(irq);
+  trace_record_t *record =
+      &trace_rings[core][head & (TRACE_RING_RECORDS - 1)];
+  record->timestamp_us = timer_hw->timerawl;
+  record->event = (uint16_t)event;
+  record->core = (uint8_t)core;
+  record->nargs = nargs;
+  record->args[0] = a0;
+  record->args[1] = a1;
+  record->args[2] = a2;
+  record->args[3] = a3;
+}
+
+void trace_pause(bool paused) { trace_paused = paused; }
+
+static uint32_t trace_core_count(uint core) {
+  uint32_t head = trace_heads[core];
+  return (head < TRACE_RING_RECORDS) ? head : TRACE_RING_RECORDS;
+}
+
+static uint32_t trace_count(void) {
+  uint32_t count = 0;
+  for (uint core = 0; core < NUM_CORES; core++) {
+    count += trace_core_count(core);
+  }
+  return count;
+}
+
+// The index-th record of the dump: the oldest records of core 0 first
+static const trace_record_t *trace_get(uint32_t index) {
+  for (uint core = 0; core < NUM_CORES; core++) {
+    uint32_t count = trace_core_count(core);
+    if (index < count) {
+      uint32_t first = trace_heads[core] - count;
+      return &trace_rings[core][(first + index) & (TRACE_RING_RECORDS - 1)];
+    }
+    index -= count;
+  }
+  return NULL;
+}
+
+uint32_t trace_get_size(void) {
+  return sizeof(trace_header_t) + trace_count() * sizeof(trace_record_t);
+}
+
+size_t trace_read(uint32_t offset, uint8_t *buffer, size_t len) {
+  trace_header_t header = {.magic = TRACE_MAGIC,
+                           .version = TRACE_VERSION,
+                           .record_size = sizeof(trace_record_t),
+                           .count = trace_count()};
+  size_t copied = 0;
+  while (copied < len) {
+    const uint8_t *src;
+    uint32_t left;
+    if (offset < sizeof(header)) {
+      src = (const uint8_t *)&header + offset;
+      left = sizeof(header) - offset;
+    } else {
+      uint32_t pos = offset - sizeof(header);
+      const trace_record_t *record = trace_get(pos / sizeof(trace_record_t));
+      if (record == NULL) {
+        break;
+      }
+      src = (const uint8_t *)record + pos % sizeof(trace_record_t);
+      left = sizeof(trace_record_t) - pos % sizeof(trace_record_t);
+    }
+    if (left > len - copied) {
+      left = len - copied;
+    }
+    memcpy(buffer + copied, src, left);
+    copied += left;
+    offset += left;
+  }
+  return copied;
+}
+
+void trace_print(void) {
+  bool paused = trace_paused;
+  trace_pause(true);
+  uint32_t size = trace_get_size();
+  DPRINTFRAW("TRACE BEGIN %lu\n", (unsigned long)size);
+  uint8_t line[TRACE_PRINT_BYTES];
+  for (uint32_t offset = 0; offset < size; offset += sizeof(line)) {
+    size_t len = trace_read(offset, line, sizeof(line));
+    DPRINTFRAW("TRACE ");
+    for (size_t i = 0; i < len; i++) {
+      DPRINTFRAW("%02x", line[i]);
+    }
+    DPRINTFRAW("\n");
+  }
+  DPRINTFRAW("TRACE END\n");
+  trace_pause(paused);
+}
+
+int trace_save(const char *filename) {
+  FIL file;
+  if (f_open(&file, filename, FA_WRITE | FA_CREATE_ALWAYS) != FR_OK) {
+    DPRINTF("Error opening %s\n", filename);
+    return -1;
+  }
+  bool paused = trace_paused;
+  trace_pause(true);
+  uint32_t size = trace_get_size();
+  uint8_t chunk[512];
+  FRESULT res = FR_OK;
+  for (uint32_t offset = 0; offset < size && res == FR_OK;
+       offset += sizeof(chunk)) {
+    size_t len = trace_read(offset, chunk, sizeof(chunk));
+    UINT written = 0;
+    res = f_write(&file, chunk, len, &written);
+    if (res == FR_OK && written != len) {
+      res = FR_DISK_ERR;
+    }
+  }
+  trace_pause(paused);
+  if (f_close(&file) != FR_OK || res != FR_OK) {
+    DPRINTF("Error writing %s: %d\n", filename, res);
+    return -1;
+  }
+  DPRINTF("Trace saved to %s: %lu bytes\n", filename, (unsigned long)size);
+  return 0;
+}
+
+static void trace_answer_file(struct fs_file *file, const char *text) {
+  int len = snprintf(trace_answer, sizeof(trace_answer),
+                     "HTTP/1.1 200 OK\r\n"
+                     "Content-Type: text/plain\r\n"
+                     "Content-Length: %u\r\n"
+                     "Cache-Control: no-store\r\n"
+                     "Connection: close\r\n\r\n%s",
+                     (unsigned)strlen(text), text);
+  memset(file, 0, sizeof(*file));
+  file->data = trace_answer;
+  file->len = len;
+  file->flags = FS_FILE_FLAGS_HEADER_INCLUDED;
+}
+
+bool trace_open_file(struct fs_file *file, const char *name) {
+  if (strcmp(name, TRACE_SD_URI) == 0) {
+    trace_answer_file(file, trace_save(TRACE_SD_FILENAME) == 0
+                                ? "Saved to " TRACE_SD_FILENAME "\n"
+                                : "Error saving to " TRACE_SD_FILENAME "\n");
+    return true;
+  }
+  if (strcmp(name, TRACE_PRINT_URI) == 0) {
+    trace_print();
+    trace_answer_file(file, "Printed to the debug output\n");
+    return true;
+  }
+  if (strcmp(name, TRACE_URI) != 0) {
+    return false;
+  }
+  // Paused until the file is closed, so the rings do not move under the
+  // server while it sends them
+  trace_pause(true);
+  int header_len = snprintf(trace_http_header, sizeof(trace_http_header),
+                            "HTTP/1.1 200 OK\r\n"
+                            "Content-Type: application/octet-stream\r\n"
+                            "Content-Length: %lu\r\n"
+                            "Cache-Control: no-store\r\n"
+                            "Connection: close\r\n\r\n",
+                            (unsigned long)trace_get_size());
+  memset(file, 0, sizeof(*file));
+  // No data pointer: the server reads it with trace_read_file()
+  file->len = header_len + (int)trace_get_size();
+  file->flags = FS_FILE_FLAGS_HEADER_INCLUDED;
+  file->pextension = trace_http_header;
+  return true;
+}
+
+int trace_read_file(struct fs_file *file, char *buffer, int count) {
+  if (file->pextension != trace_http_header) {
+    return -1;
+  }
+  int header_len = (int)strlen(trace_http_header);
+  int copied = 0;
+  while (copied < count && file->index < header_len) {
+    buffer[copied++] = trace_http_header[file->index++];
+  }
+  if (copied < count) {
+    size_t len = trace_read((uint32_t)(file->index - header_len),
+                            (uint8_t *)buffer + copied, count - copied);
+    file->index += (int)len;
+    copied += (int)len;
+  }
+  return copied;
+}
+
+bool trace_close_file(struct fs_file *file) {
+  if (file->pextension != trace_http_header) {
+    return false;
+  }
+  trace_pause(false);
+  return true;
+}
+
+#else
+
+// Without BOOSTER_TRACE there are no rings and the trace URIs are not found
+
+bool trace_open_file(struct fs_file *file, const char *name) {
+  (void)file;
+  (void)name;
+  return false;
+}
+
+int trace_read_file(struct fs_file *file, char *buffer, int count) {
+  (void)file;
+  (void)buffer;
+  (void)count;
+  return -1;
+}
+
+bool trace_close_file(struct fs_file *file) {
+  (void)file;
+  return false;
+}
+
+#endif  // BOOSTER_TRACE
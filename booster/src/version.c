@@ -1,6 +1,7 @@
 #include "version.h"
 
 #include <ctype.h>
+#include <stdlib.h>
 
 typedef struct {
   char protocol[16];
@@ -8,14 +9,30 @@ typedef struct {
   char uri[256];
 } url_components_t;
 
-download_version_t status = DOWNLOAD_VERSION_IDLE;
+// Result of the check, published to the UI
+static download_version_t status = DOWNLOAD_VERSION_IDLE;
 static char version_string[64] = {0};
+
+// Written by the HTTP callbacks. A request abandoned on timeout may still
+// complete later, so it never touches the published result.
+static download_version_t download_status = DOWNLOAD_VERSION_IDLE;
+static char download_buf[64] = {0};
 static size_t version_buf_used = 0;  // <— track appended bytes
 
+// Background check scheduling
+static bool check_due = false;        // Cache missing or expired
+static bool check_active = false;     // Waiting for the current request
+static bool first_check_done = false;  // An attempt finished in this boot
+static bool request_in_flight = false;  // The HTTP client owns the request
+static uint32_t check_start_us = 0;
+static uint32_t retry_interval_ms = VERSION_RETRY_MIN_MS;
+static absolute_time_t next_check_time = {0};
+
 // Persistent storage for async HTTP request strings to avoid dangling pointers
 static char request_host_buf[256];
 static char request_uri_buf[512];
 static HTTPC_REQUEST_T request = {0};
+static mirror_route_t request_route = {MIRROR_ORIGIN};
 
 // ------------------- helpers -------------------
 static int strncasecmp_ascii(const char *a, const char *b, size_t n) {
@@ -78,20 +95,20 @@ static err_t http_client_receive_version_fn(__unused void *arg,
   }
   if (err != ERR_OK) {
     DPRINTF("Error receiving data: %d\n", err);
-    status = DOWNLOAD_VERSION_FAILED;
+    download_status = DOWNLOAD_VERSION_FAILED;
     pbuf_free(p);
     return err;
   }
 
   // How many bytes can we still store (reserve 1 byte for NUL)
-  size_t cap = sizeof(version_string) - 1u - version_buf_used;
+  size_t cap = sizeof(download_buf) - 1u - version_buf_used;
   if (cap > 0) {
     // Copy up to 'cap' bytes from the pbuf chain
     u16_t to_copy = (u16_t)((p->tot_len < cap) ? p->tot_len : cap);
     if (to_copy) {
-      pbuf_copy_partial(p, version_string + version_buf_used, to_copy, 0);
+      pbuf_copy_partial(p, download_buf + version_buf_used, to_copy, 0);
       version_buf_used += to_copy;
-      version_string[version_buf_used] = '\0';
+      download_buf[version_buf_used] = '\0';
     }
   }
   // Acknowledge all received bytes even if we truncated locally
@@ -103,8 +120,9 @@ static err_t http_client_receive_version_fn(__unused void *arg,
   pbuf_free(p);
 
   // Still in progress until result callback says done
-  if (status == DOWNLOAD_VERSION_START || status == DOWNLOAD_VERSION_IDLE) {
-    status = DOWNLOAD_VERSION_IN_PROGRESS;
+  if (download_status == DOWNLOAD_VERSION_START ||
+      download_status == DOWNLOAD_VERSION_IDLE) {
+    download_status = DOWNLOAD_VERSION_IN_PROGRESS;
   }
   return ERR_OK;
 }
@@ -122,7 +140,7 @@ static err_t http_client_header_check_size_fn(
   // Case-insensitive search for "Content-Length:"
   const char *label = "Content-Length:";
   char *p = buf;
-  size_t max_len = sizeof(version_string) - 1;
+  size_t max_len = sizeof(download_buf) - 1;
 
   while (p && *p) {
     // find end of line
@@ -136,7 +154,7 @@ static err_t http_client_header_check_size_fn(
       unsigned long cl = strtoul(num, NULL, 10);
       if (cl > max_len) {
         DPRINTF("Content-Length too large: %lu > %u\n", cl, (unsigned)max_len);
-        status = DOWNLOAD_VERSION_FAILED;
+        download_status = DOWNLOAD_VERSION_FAILED;
         return ERR_VAL;  // refuse large bodies
       }
       break;  // ok
@@ -145,7 +163,8 @@ static err_t http_client_header_check_size_fn(
   }
 
   // Mark we’re ready to receive body
-  if (status == DOWNLOAD_VERSION_START) status = DOWNLOAD_VERSION_IN_PROGRESS;
+  if (download_status == DOWNLOAD_VERSION_START)
+    download_status = DOWNLOAD_VERSION_IN_PROGRESS;
   return ERR_OK;
 }
 
@@ -158,18 +177,14 @@ static void http_client_result_complete_fn(void *arg,
           httpc_result, rx_content_len, srv_res, err);
   req->complete = true;
 
-#if BOOSTER_DOWNLOAD_HTTPS == 1
-  if (req->tls_config) {  // free here too to avoid leaks on error
-    altcp_tls_free_config(req->tls_config);
-    req->tls_config = NULL;
-  }
-#endif
-
-  if (err == ERR_OK && srv_res == 200) {
-    status = DOWNLOAD_VERSION_COMPLETED;
+  if (err == ERR_OK && srv_res == 200 &&
+      download_status != DOWNLOAD_VERSION_FAILED) {
+    download_status = DOWNLOAD_VERSION_COMPLETED;
   } else {
-    status = DOWNLOAD_VERSION_FAILED;
+    download_status = DOWNLOAD_VERSION_FAILED;
   }
+  mirror_report(&request_route,
+                download_status == DOWNLOAD_VERSION_COMPLETED);
 }
 
 // ------------------- driver code -------------------
@@ -177,38 +192,42 @@ static void http_client_result_complete_fn(void *arg,
 static download_version_t version_start_download(const char *url) {
   // reset accumulation buffer
   version_buf_used = 0;
-  version_string[0] = '\0';
+  download_buf[0] = '\0';
+  request = (HTTPC_REQUEST_T){0};
 
   url_components_t components;
 
   if (!url || !*url) {
     // No URL: use built-in version
-    snprintf(version_string, sizeof(version_string), "%s", RELEASE_VERSION);
-    status = DOWNLOAD_VERSION_DEFAULT;
-    return status;
+    download_status = DOWNLOAD_VERSION_DEFAULT;
+    return download_status;
   }
   if (parse_url(url, &components) != 0) {
     DPRINTF("Error parsing URL: %s\n", url ? url : "(null)");
-    snprintf(version_string, sizeof(version_string), "%s", RELEASE_VERSION);
-    status = DOWNLOAD_VERSION_CANNOTPARSEURL;
-    return status;
+    download_status = DOWNLOAD_VERSION_CANNOTPARSEURL;
+    return download_status;
   }
-  status = DOWNLOAD_VERSION_START;
+  download_status = DOWNLOAD_VERSION_START;
 
   // Persist host and URI (components are on stack)
-  snprintf(request_host_buf, sizeof(request_host_buf), "%s", components.host);
+  bool mirrored = mirror_route(&request_route);
+  snprintf(request_host_buf, sizeof(request_host_buf), "%s",
+           mirrored ? request_route.hostname : components.host);
   snprintf(request_uri_buf, sizeof(request_uri_buf), "%s", components.uri);
   request.hostname = request_host_buf;
   request.url = request_uri_buf;
+  request.port = request_route.port;
   request.complete = false;
+  request.callback_arg = &request;
 
   request.headers_fn = http_client_header_check_size_fn;
   request.recv_fn = http_client_receive_version_fn;
   request.result_fn = http_client_result_complete_fn;
 
 #if BOOSTER_DOWNLOAD_HTTPS == 1
-  request.tls_config = altcp_tls_create_config_client(NULL, 0);
-  DPRINTF("Download with HTTPS\n");
+  // The mirrors are on the LAN and serve plain HTTP
+  request.tls_config = mirrored ? NULL : http_client_tls_config();
+  DPRINTF("Download with %s\n", mirrored ? "HTTP" : "HTTPS");
 #else
   DPRINTF("Download with HTTP\n");
 #endif
@@ -216,63 +235,155 @@ static download_version_t version_start_download(const char *url) {
   int rc = http_client_request_async(cyw43_arch_async_context(), &request);
   if (rc != 0) {
     DPRINTF("http_client_request_async failed: %d\n", rc);
-#if BOOSTER_DOWNLOAD_HTTPS == 1
-    if (request.tls_config) {
-      altcp_tls_free_config(request.tls_config);
-      request.tls_config = NULL;
-    }
-#endif
-    status = DOWNLOAD_VERSION_FAILED;
-    return status;
+    mirror_report(&request_route, false);
+    download_status = DOWNLOAD_VERSION_FAILED;
+    return download_status;
   }
-  status = DOWNLOAD_VERSION_IN_PROGRESS;
-  return status;
+  download_status = DOWNLOAD_VERSION_IN_PROGRESS;
+  return download_status;
 }
 
-static download_version_poll_t version_poll_download(void) {
-  if (!request.complete) {
-    async_context_poll(cyw43_arch_async_context());
-    async_context_wait_for_work_ms(cyw43_arch_async_context(),
-                                   VERSION_POLL_INTERVAL_MS);
-    return DOWNLOAD_VERSION_POLL_CONTINUE;
+// Keep the leading version token only. The string ends up in flash, in the
+// JSON served to the browser and on the Atari screen, so drop anything else.
+static bool version_sanitize(const char *in, char *out, size_t out_len) {
+  size_t n = 0;
+  while (*in == ' ' || *in == '\t' || *in == '\r' || *in == '\n') ++in;
+  for (; *in && n + 1 < out_len; ++in) {
+    if (!isalnum((unsigned char)*in) && strchr(".-_+~", *in) == NULL) break;
+    out[n++] = *in;
   }
-  return DOWNLOAD_VERSION_POLL_COMPLETED;
+  out[n] = '\0';
+  return n > 0;
 }
 
-static download_version_t version_finish_download(void) {
-  DPRINTF("Download finished with status=%d, content=\"%s\"\n", status,
-          version_string);
-  return status;
+static void version_store_cache(void) {
+  SettingsContext *ctx = gconfig_getContext();
+  SettingsConfigEntry *cached = settings_find_entry(ctx, PARAM_VERSION_CACHE);
+  settings_put_string(ctx, PARAM_VERSION_CACHE, version_string);
+  settings_put_integer(ctx, PARAM_VERSION_CACHE_TTL, VERSION_CACHE_TTL_BOOTS);
+  settings_save(ctx, true);
+  DPRINTF("Latest version %s cached for %d boots (was %s)\n", version_string,
+          VERSION_CACHE_TTL_BOOTS,
+          (cached != NULL && cached->value[0] != '\0') ? cached->value
+                                                       : "empty");
 }
 
-void version_loop(void) {
-  status = DOWNLOAD_VERSION_IDLE;
-  request = (HTTPC_REQUEST_T){0};
-  version_buf_used = 0;
-  version_string[0] = '\0';
+static void version_check_failed(void) {
+  // Keep showing the cached version, if any, and try again later
+  if (status != DOWNLOAD_VERSION_CACHED) {
+    status = DOWNLOAD_VERSION_FAILED;
+  }
+  next_check_time = make_timeout_time_ms(retry_interval_ms);
+  DPRINTF("Version check failed. Next attempt in %u s\n",
+          (unsigned)(retry_interval_ms / 1000));
+  retry_interval_ms = (retry_interval_ms >= VERSION_RETRY_MAX_MS / 2)
+                          ? VERSION_RETRY_MAX_MS
+                          : retry_interval_ms * 2;
+}
 
-  download_version_t start_status = version_start_download(VERSION_URL);
-  if (start_status == DOWNLOAD_VERSION_DEFAULT ||
-      start_status == DOWNLOAD_VERSION_CANNOTPARSEURL ||
-      start_status == DOWNLOAD_VERSION_FAILED) {
+static void version_finish_check(void) {
+  DPRINTF("Version check finished in %u ms with status=%d, content=\"%s\"\n",
+          (unsigned)((time_us_32() - check_start_us) / 1000), download_status,
+          download_buf);
+  first_check_done = true;
+  if (download_status != DOWNLOAD_VERSION_COMPLETED ||
+      !version_sanitize(download_buf, version_string,
+                        sizeof(version_string))) {
+    version_check_failed();
     return;
   }
+  status = DOWNLOAD_VERSION_COMPLETED;
+  check_due = false;
+  retry_interval_ms = VERSION_RETRY_MIN_MS;
+  version_store_cache();
+  bootprof_mark(BOOTPROF_PHASE_VERSION_CHECK);
+}
 
-  uint32_t waited_ms = 0;
-  while (version_poll_download() == DOWNLOAD_VERSION_POLL_CONTINUE) {
-    if (status == DOWNLOAD_VERSION_FAILED) break;
-    waited_ms += VERSION_POLL_INTERVAL_MS;
-    if (waited_ms >= VERSION_DOWNLOAD_TIMEOUT_MS) {
-      DPRINTF("VERSION download timed out after %u ms\n", waited_ms);
-      status = DOWNLOAD_VERSION_FAILED;
-      break;
+void version_age_cache(void) {
+  SettingsContext *ctx = gconfig_getContext();
+  SettingsConfigEntry *ttl = settings_find_entry(ctx, PARAM_VERSION_CACHE_TTL);
+  if (ttl == NULL) {
+    return;
+  }
+  int boots_left = atoi(ttl->value);
+  if (boots_left > 0) {
+    settings_put_integer(ctx, PARAM_VERSION_CACHE_TTL, boots_left - 1);
+  }
+}
+
+void version_init(void) {
+  SettingsContext *ctx = gconfig_getContext();
+  SettingsConfigEntry *cached = settings_find_entry(ctx, PARAM_VERSION_CACHE);
+  SettingsConfigEntry *ttl = settings_find_entry(ctx, PARAM_VERSION_CACHE_TTL);
+  int boots_left = (ttl != NULL) ? atoi(ttl->value) : 0;
+
+  if (cached != NULL &&
+      version_sanitize(cached->value, version_string, sizeof(version_string))) {
+    status = DOWNLOAD_VERSION_CACHED;
+  }
+  check_due = (status != DOWNLOAD_VERSION_CACHED) || (boots_left <= 0);
+  first_check_done = !check_due;
+  retry_interval_ms = VERSION_RETRY_MIN_MS;
+  next_check_time = make_timeout_time_ms(VERSION_FIRST_CHECK_DELAY_MS);
+  DPRINTF("Cached latest version: %s, valid for %d more boots. %s\n",
+          (status == DOWNLOAD_VERSION_CACHED) ? version_string : "none",
+          boots_left, check_due ? "Check scheduled" : "No check needed");
+}
+
+void version_background_loop(bool network_ready) {
+  if (request_in_flight) {
+    if (request.complete) {
+      request_in_flight = false;
+      if (check_active) {
+        check_active = false;
+        version_finish_check();
+      }
+    } else if (check_active && (time_us_32() - check_start_us) >=
+                                   VERSION_DOWNLOAD_TIMEOUT_MS * 1000u) {
+      // lwIP closes the connection on its own timeout. Until then the request
+      // buffers stay busy and no new attempt is started.
+      DPRINTF("Version check timed out after %u ms\n",
+              (unsigned)VERSION_DOWNLOAD_TIMEOUT_MS);
+      check_active = false;
+      first_check_done = true;
+      version_check_failed();
     }
+    return;
   }
 
-  (void)version_finish_download();
-  request = (HTTPC_REQUEST_T){0};
+  if (!check_due || !network_ready ||
+      absolute_time_diff_us(get_absolute_time(), next_check_time) > 0) {
+    return;
+  }
+
+  check_start_us = time_us_32();
+  bootprof_begin(BOOTPROF_PHASE_VERSION_CHECK);
+  download_version_t start_status = version_start_download(VERSION_URL);
+  if (start_status == DOWNLOAD_VERSION_DEFAULT ||
+      start_status == DOWNLOAD_VERSION_CANNOTPARSEURL) {
+    // Nothing to check against. Not worth retrying.
+    DPRINTF("No usable VERSION_URL. Version check disabled\n");
+    if (status != DOWNLOAD_VERSION_CACHED) {
+      status = start_status;
+    }
+    check_due = false;
+    first_check_done = true;
+    return;
+  }
+  if (start_status == DOWNLOAD_VERSION_FAILED) {
+    first_check_done = true;
+    version_check_failed();
+    return;
+  }
+  if (status != DOWNLOAD_VERSION_CACHED) {
+    status = DOWNLOAD_VERSION_IN_PROGRESS;
+  }
+  request_in_flight = true;
+  check_active = true;
 }
 
+bool version_is_checking(void) { return check_due && !first_check_done; }
+
 download_version_t version_get_status(void) { return status; }
 
 const char *version_get_string(void) {
@@ -0,0 +1,116 @@
+import re
+import struct
+import argparse
+
+# Dumps of the booster trace log, see booster/src/include/trace.h
+TRACE_MAGIC = 0x43525442
+TRACE_HEADER_FORMAT = "<IHHII"
+TRACE_HEADER_SIZE = 16
+TRACE_RECORD_FORMAT = "<IHBB4I"
+TRACE_RECORD_SIZE = 24
+TRACE_EVENTS_FILE = "booster/src/include/trace_events.h"
+
+TRACE_EVENT_PATTERN = re.compile(r'^\s*TRACE_EVENT\(\s*(\w+)\s*,\s*"(.*)"\s*\)')
+SIGNED_CONVERSION = re.compile(r"%[-+ 0#]*\d*l*[di]")
+
+
+def read_events(events_path):
+    # The id of an event is its position in trace_events.h
+    events = []
+    with open(events_path, "r") as f:
+        for line in f:
+            match = TRACE_EVENT_PATTERN.match(line)
+            if match:
+                events.append((match.group(1), match.group(2)))
+    return events
+
+
+def read_dump(dump_path):
+    with open(dump_path, "rb") as f:
+        data = f.read()
+    if len(data) >= 4 and struct.unpack("<I", data[:4])[0] == TRACE_MAGIC:
+        return data
+    # A capture of the debug output with the lines of trace_print()
+    hex_data = []
+    for line in data.decode("ascii", errors="ignore").splitlines():
+        line = line.strip()
+        if line.startswith("TRACE ") and not line.startswith(
+            ("TRACE BEGIN", "TRACE END")
+        ):
+            hex_data.append(line[len("TRACE ") :])
+    return bytes.fromhex("".join(hex_data))
+
+
+def format_record(events, event, nargs, args):
+    if event >= len(events):
+        return f"unknown event {event}: {[hex(a) for a in args[:nargs]]}"
+    name, fmt = events[event]
+    args = list(args[:nargs])
+    # The arguments are stored as unsigned 32-bit values
+    for i, conversion in enumerate(re.findall(r"%[-+ 0#]*\d*l*[diuxXc]", fmt)):
+        if i < len(args) and SIGNED_CONVERSION.fullmatch(conversion):
+            if args[i] >= 0x80000000:
+                args[i] -= 0x100000000
+    try:
+        return f"{name}: {fmt % tuple(args)}"
+    except (TypeError, ValueError):
+        return f"{name}: {fmt} {args}"
+
+
+def decode(dump_path, events_path):
+    events = read_events(events_path)
+    data = read_dump(dump_path)
+    if len(data) < TRACE_HEADER_SIZE:
+        print("No trace data found")
+        return
+    magic, version, record_size, count, _ = struct.unpack(
+        TRACE_HEADER_FORMAT, data[:TRACE_HEADER_SIZE]
+    )
+    if magic != TRACE_MAGIC or record_size != TRACE_RECORD_SIZE:
+        print(f"Not a trace dump: magic {hex(magic)}, record size {record_size}")
+        return
+    records = []
+    for i in range(count):
+        offset = TRACE_HEADER_SIZE + i * TRACE_RECORD_SIZE
+        if offset + TRACE_RECORD_SIZE > len(data):
+            print(f"Dump truncated after {i} of {count} records")
+            break
+        records.append(
+            struct.unpack(
+                TRACE_RECORD_FORMAT, data[offset : offset + TRACE_RECORD_SIZE]
+            )
+        )
+    # Each core has its own ring: merge them by time
+    records.sort(key=lambda record: record[0])
+    previous = records[0][0] if records else 0
+    print(f"Trace version {version}, {len(records)} records")
+    for timestamp, event, core, nargs, *args in records:
+        print(
+            f"{timestamp:>12} us {timestamp - previous:>+10} core {core} "
+            f"{format_record(events, event, nargs, args)}"
+        )
+        previous = timestamp
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description="Decode a dump of the booster trace log."
+    )
+    parser.add_argument(
+        "dump_path",
+        type=str,
+        help="Binary dump (/trace or /trace.bin) or a capture of the debug "
+        "output with the TRACE lines",
+    )
+    parser.add_argument(
+        "--events",
+        type=str,
+        default=TRACE_EVENTS_FILE,
+        help="trace_events.h of the firmware that made the dump",
+    )
+    args = parser.parse_args()
+    decode(args.dump_path, args.events)
+
+
+if __name__ == "__main__":
+    main()
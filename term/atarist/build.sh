@@ -32,11 +32,14 @@ filesize=$(ST_WORKING_FOLDER=$working_folder stcmd stat -c %s "$filename")
 
 # Size for 64Kbytes in bytes
 #targetsize=$((64 * 1024))
-targetsize=2048
+# The image is copied to the start of the ROM4 window, and the RP2040 writes the
+# high resolution translation table 4Kbytes after it. The code copied to RAM
+# must also fit in the 4Kbytes before the screen memory (SCREEN_SIZE).
+targetsize=4096
 
-# Check if the file is larger than 64Kbytes
+# Check if the file is larger than the target size
 if [ "$filesize" -gt "$targetsize" ]; then
-    echo "The file is already larger than 64Kbytes."
+    echo "The file is already larger than $targetsize bytes."
     exit 2
 fi
 
@@ -32,6 +32,22 @@ ROWS_HIGH			equ 200		; 200 rows in the ST
 BYTES_ROW_HIGH		equ 80		; 80 bytes per row in the ST
 PRE_RESET_WAIT		equ $FFFFF
 TRANSTABLE			equ $FA1000	; Translation table for high resolution
+CHAR_ROWS			equ 25		; Rows of 8 lines tracked by the dirty bitmap
+ALL_ROWS			equ ((1<<CHAR_ROWS)-1)	; Dirty bitmap with all the rows
+WORDS_CHAR_ROW		equ 160		; Words of the framebuffer in a row of chars
+BYTES_CHAR_ROW		equ 320		; Bytes of the framebuffer in a row of chars
+SCREEN_CHAR_ROW		equ 1280	; Bytes of the screen in a row of chars, low and high
+FRAME_GEN_ADDR		equ (FRAMEBUFFER_ADDR + FRAMEBUFFER_SIZE + 4)	; Frame generation word
+DIRTY_ROWS_ADDR		equ (FRAMEBUFFER_ADDR + FRAMEBUFFER_SIZE + 8)	; Rows changed by the last frame
+TOP_ROW_ADDR		equ (FRAMEBUFFER_ADDR + FRAMEBUFFER_SIZE + 6)	; Row of the framebuffer at the top of the screen
+FRAME_SLOT_SIZE		equ 8		; Frames with odd generation use the top row and dirty rows 8 bytes after
+EXPANDED_FLAG_ADDR	equ (FRAMEBUFFER_ADDR + FRAMEBUFFER_SIZE + 12)	; Not 0 if the expanded framebuffer is kept
+EXPANDED_ADDR		equ (ROM4_ADDR + $2000)	; Framebuffer with the pixels doubled horizontally, 640x200. From ROM4, not the framebuffer
+EXPANDED_SIZE		equ (FRAMEBUFFER_SIZE * 2)
+EXPANDED_CHAR_ROW	equ (BYTES_CHAR_ROW * 2)	; Bytes of the expanded framebuffer in a row of chars
+WORDS_EXPANDED_ROW	equ (WORDS_CHAR_ROW * 2)	; Words of the expanded framebuffer in a row of chars
+DELTA_ADDR			equ (FRAMEBUFFER_ADDR + $2000)	; Spans of words changed by the frames with even generation. From the framebuffer: $FAA000
+DELTA_AREA_SIZE		equ $1000	; The frames with odd generation in the next area
 
 ; If 1, the display will not use the framebuffer and will write directly to the
 ; display memory. This is useful to reduce the memory usage in the rp2040
@@ -65,6 +81,8 @@ APP_TERMINAL 				equ $0 ; The terminal app
 ; App terminal commands
 APP_TERMINAL_START   		equ $0 ; Start terminal command
 APP_TERMINAL_KEYSTROKE 		equ $1 ; Keystroke command
+APP_TERMINAL_KEYSTROKES 	equ $2 ; Batch of keystrokes command
+KEYS_BATCH				equ 4  ; Keys in a batch, one in each of D3-D6
 
 _dskbufp                equ $4c6                            ; Address of the disk buffer pointer    
 
@@ -115,25 +133,7 @@ check_shift_keys	macro
 
 ; Check the keys pressed
 check_keys			macro
-
-					gemdos	Cconis,2		; Check if a key is pressed
-					tst.l d0
-					beq .\@no_key
-
-					gemdos	Cnecin,2		; Read the key pressed
-
-					cmp.b #27, d0		; Check if the key is ESC
-					beq .\@esc_key	; If it is, send terminal command
-
-					move.l d0, d3
-					send_sync APP_TERMINAL_KEYSTROKE, 4
-
-					bra .\@no_key
-.\@esc_key:
-					send_sync APP_TERMINAL_START, 0
-
-.\@no_key:
-
+					bsr send_keys
 					endm
 
 check_commands		macro
@@ -185,7 +185,7 @@ pre_auto:
 	lea SCREEN_SIZE(a2), a2		; Move to the end of the screen memory
 	move.l a2, a3				; Save the screen memory address in A3
 	; Copy the code out of the ROM to avoid unstable behavior
-    move.l #end_rom_code - start_rom_code, d6
+    move.l #end_rom_code - start_rom_code + 3, d6	; Round up to longwords
     lea start_rom_code, a1    ; a1 points to the start of the code in ROM
     lsr.w #2, d6
     subq #1, d6
@@ -201,18 +201,42 @@ start_rom_code:
 ; Enable bconin to return shift key status
 	or.b #%1000, _conterm.w
 
+; Force a full copy of the first frame
+	lea last_frame_gen(pc), a4
+	move.w FRAME_GEN_ADDR, d4
+	subq.w #2, d4
+	move.w d4, (a4)
+
 ; Get the resolution of the screen
 	get_rez
 	cmp.w #2, d0				; Check if the resolution is 640x400 (high resolution)
-	beq .print_loop_high		; If it is, print the message in high resolution
+	beq .start_high				; If it is, print the message in high resolution
+	cmp.w #1, d0				; Medium resolution needs the expanded framebuffer
+	bne.s .print_loop_low
+	tst.w EXPANDED_FLAG_ADDR
+	bne .print_loop_med
 
 .print_loop_low:
 	vsync_wait
 
+; Copy only the rows of chars changed since the last frame copied
+	bsr read_dirty_rows			; D7 = rows to copy
+	tst.l d7
+	beq.s .copy_done_low		; Nothing changed
+	moveq #0, d1				; Low resolution spans
+	bsr apply_deltas			; Only the words changed, if possible
+	beq.s .copy_done_low
+
 ; We must move from the cartridge ROM to the screen memory to display the messages
 	move.l a6, a0				; Set the screen memory address in a0
 	move.l #FRAMEBUFFER_ADDR, a1			; Set the cartridge ROM address in a1
-	move.l #((FRAMEBUFFER_SIZE / 2) -1), d0			; Set the number of words to copy
+	add.l d3, a1				; Start at the top row of the ring
+	lea (FRAMEBUFFER_ADDR + FRAMEBUFFER_SIZE), a4	; End of the ring
+	moveq #(CHAR_ROWS - 1), d5	; Set the number of rows of chars to check - 1
+.copy_row_low:
+	lsr.l #1, d7				; Next row dirty?
+	bcc.s .skip_row_low
+	move.w #(WORDS_CHAR_ROW - 1), d0	; Set the number of words to copy
 .copy_screen_low:
 	move.w (a1)+ , d1			; Copy a word from the cartridge ROM
 	ifne DISPLAY_BYPASS_FRAMEBUFFER == 1
@@ -223,23 +247,54 @@ start_rom_code:
 	move.w d1, d2				; Copy the word to d2
 	move.l d2, (a0)+			; Copy the word to the screen memory
 	move.l d2, (a0)+			; Copy the word to the screen memory
-	dbf d0, .copy_screen_low    ; Loop until all the message is copied
+	dbf d0, .copy_screen_low    ; Loop until the row is copied
+	bra.s .next_row_low
+.skip_row_low:
+	lea BYTES_CHAR_ROW(a1), a1	; Skip the row in the framebuffer
+	lea SCREEN_CHAR_ROW(a0), a0	; and in the screen
+.next_row_low:
+	cmp.l a4, a1				; Past the last row of the ring?
+	bne.s .no_wrap_low
+	move.l #FRAMEBUFFER_ADDR, a1	; Wrap to the first one
+.no_wrap_low:
+	dbf d5, .copy_row_low
+.copy_done_low:
 
 ; Check the different commands and the keyboard
 	check_commands
 
 	bra .print_loop_low		; Continue printing the message
 
+.start_high:
+	tst.w EXPANDED_FLAG_ADDR	; Copy the expanded framebuffer if kept
+	bne .print_loop_high_expanded
+
 .print_loop_high:
 	vsync_wait
 
+; Copy only the rows of chars changed since the last frame copied
+	bsr read_dirty_rows			; D7 = rows to copy
+	tst.l d7
+	beq .copy_done_high			; Nothing changed
+
 ; We must move from the cartridge ROM to the screen memory to display the messages
 	move.l a6, a1				; Set the screen memory address in a1
 	move.l a6, a2
 	lea BYTES_ROW_HIGH(a2), a2	; Move to the next line in the screen
 	move.l #FRAMEBUFFER_ADDR, a0		; Set the cartridge ROM address in a0
+	add.l d3, a0				; Start at the top row of the ring
+	lea (FRAMEBUFFER_ADDR + FRAMEBUFFER_SIZE), a4	; End of the ring
 	move.l #TRANSTABLE, a3		; Set the translation table in a3
-	move.l #(ROWS_HIGH -1), d0	; Set the number of rows to copy - 1
+	moveq #(CHAR_ROWS - 1), d5	; Set the number of rows of chars to check - 1
+.copy_char_row_high:
+	lsr.l #1, d7				; Next row dirty?
+	bcs.s .copy_row_high
+	lea BYTES_CHAR_ROW(a0), a0	; Skip the row in the framebuffer
+	lea SCREEN_CHAR_ROW(a1), a1	; and in the screen
+	lea SCREEN_CHAR_ROW(a2), a2
+	bra.s .next_char_row_high
+.copy_row_high:
+	moveq #7, d0				; Set the number of lines in a row of chars - 1
 .copy_screen_row_high:
 	move.l #(COLS_HIGH -1), d1	; Set the number of columns to copy - 1 
 .copy_screen_col_high:
@@ -267,12 +322,113 @@ start_rom_code:
 	lea BYTES_ROW_HIGH(a1), a1	; Move to the next line in the screen
 	lea BYTES_ROW_HIGH(a2), a2	; Move to the next line in the screen
 
-	dbf d0, .copy_screen_row_high   ; Loop until all the message is copied
+	dbf d0, .copy_screen_row_high   ; Loop until the row of chars is copied
+.next_char_row_high:
+	cmp.l a4, a0				; Past the last row of the ring?
+	bne.s .no_wrap_high
+	move.l #FRAMEBUFFER_ADDR, a0	; Wrap to the first one
+.no_wrap_high:
+	dbf d5, .copy_char_row_high
+.copy_done_high:
 
 ; Check the different commands and the keyboard
 	check_commands
 
 	bra .print_loop_high		; Continue printing the message
+
+; High resolution from the expanded framebuffer: each line is already 640
+; pixels, so it is copied with movem to the two lines of the screen.
+.print_loop_high_expanded:
+	vsync_wait
+
+	bsr read_dirty_rows			; D7 = rows to copy
+	tst.l d7
+	beq .copy_done_high_expanded	; Nothing changed
+	moveq #2, d1				; High resolution spans
+	bsr apply_deltas			; Only the words changed, if possible
+	beq .copy_done_high_expanded
+
+	move.l a6, a1				; Set the screen memory address in a1
+	move.l #EXPANDED_ADDR, a0	; Set the expanded framebuffer address in a0
+	add.l d3, a0				; Rows of the expanded framebuffer are twice
+	add.l d3, a0				; as long
+	lea (EXPANDED_ADDR + EXPANDED_SIZE), a4	; End of the ring
+	moveq #(CHAR_ROWS - 1), d5	; Set the number of rows of chars to check - 1
+.copy_char_row_high_expanded:
+	lsr.l #1, d7				; Next row dirty?
+	bcs.s .copy_row_high_expanded
+	lea EXPANDED_CHAR_ROW(a0), a0	; Skip the row in the framebuffer
+	lea SCREEN_CHAR_ROW(a1), a1	; and in the screen
+	bra.s .next_char_row_high_expanded
+.copy_row_high_expanded:
+	moveq #7, d6				; Set the number of lines in a row of chars - 1
+.copy_line_high_expanded:
+	rept (BYTES_ROW_HIGH / 20)
+	movem.l (a0)+, d0-d4		; 20 bytes of the line
+	movem.l d0-d4, (a1)			; to the even line of the screen
+	movem.l d0-d4, BYTES_ROW_HIGH(a1)	; and to the odd one
+	lea 20(a1), a1
+	endr
+	lea BYTES_ROW_HIGH(a1), a1	; Skip the odd line
+	dbf d6, .copy_line_high_expanded
+.next_char_row_high_expanded:
+	cmp.l a4, a0				; Past the last row of the ring?
+	bne.s .no_wrap_high_expanded
+	move.l #EXPANDED_ADDR, a0	; Wrap to the first one
+.no_wrap_high_expanded:
+	dbf d5, .copy_char_row_high_expanded
+.copy_done_high_expanded:
+
+; Check the different commands and the keyboard
+	check_commands
+
+	bra .print_loop_high_expanded	; Continue printing the message
+
+; Medium resolution from the expanded framebuffer: the same word in the two
+; planes, colors 0 and 3.
+.print_loop_med:
+	vsync_wait
+
+	bsr read_dirty_rows			; D7 = rows to copy
+	tst.l d7
+	beq.s .copy_done_med		; Nothing changed
+	moveq #1, d1				; Medium resolution spans
+	bsr apply_deltas			; Only the words changed, if possible
+	beq.s .copy_done_med
+
+	move.l a6, a1				; Set the screen memory address in a1
+	move.l #EXPANDED_ADDR, a0	; Set the expanded framebuffer address in a0
+	add.l d3, a0				; Rows of the expanded framebuffer are twice
+	add.l d3, a0				; as long
+	lea (EXPANDED_ADDR + EXPANDED_SIZE), a4	; End of the ring
+	moveq #(CHAR_ROWS - 1), d5	; Set the number of rows of chars to check - 1
+.copy_row_med:
+	lsr.l #1, d7				; Next row dirty?
+	bcc.s .skip_row_med
+	move.w #(WORDS_EXPANDED_ROW - 1), d0	; Set the number of words to copy
+.copy_screen_med:
+	move.w (a0)+, d1			; Copy a word from the expanded framebuffer
+	move.w d1, d2
+	swap d2
+	move.w d1, d2
+	move.l d2, (a1)+			; to the two planes
+	dbf d0, .copy_screen_med
+	bra.s .next_row_med
+.skip_row_med:
+	lea EXPANDED_CHAR_ROW(a0), a0	; Skip the row in the framebuffer
+	lea SCREEN_CHAR_ROW(a1), a1	; and in the screen
+.next_row_med:
+	cmp.l a4, a0				; Past the last row of the ring?
+	bne.s .no_wrap_med
+	move.l #EXPANDED_ADDR, a0	; Wrap to the first one
+.no_wrap_med:
+	dbf d5, .copy_row_med
+.copy_done_med:
+
+; Check the different commands and the keyboard
+	check_commands
+
+	bra .print_loop_med			; Continue printing the message
 	
 .reset:
     move.l #PRE_RESET_WAIT, d6
@@ -291,6 +447,185 @@ boot_gem:
 	; If we get here, continue loading GEM
     rts
 
+; Return in D7 the bitmap of the rows of chars to copy, bit 0 for the top row.
+; 0 if the frame was already copied, all the rows if a frame was missed or
+; changed while reading it. Return in D3 the offset in the framebuffer of the
+; row at the top of the screen, in D4 the generation of the frame and in D6 0
+; if it is the frame after the last one copied. The top row and the bitmap are
+; read from the slot of the generation, which the next frame does not touch.
+; Modifies A4.
+read_dirty_rows:
+	move.w FRAME_GEN_ADDR, d4	; Generation of the frame
+	moveq #1, d3
+	and.w d4, d3
+	lsl.w #3, d3				; Offset of the slot of the frame
+	lea TOP_ROW_ADDR, a4
+	adda.w d3, a4
+	moveq #0, d3
+	move.w (a4)+, d3			; Row at the top of the screen
+	move.l (a4), d7				; Rows changed by that frame
+	mulu #BYTES_CHAR_ROW, d3	; Offset of the row in the framebuffer
+	lea last_frame_gen(pc), a4
+	cmp.w FRAME_GEN_ADDR, d4	; Still the same frame?
+	bne.s .all_rows
+	move.w d4, d6
+	sub.w (a4), d6				; Frames since the last one copied
+	beq.s .no_rows
+	subq.w #1, d6				; Only the next one: use its bitmap
+	beq.s .rows_done
+.all_rows:
+	moveq #1, d6				; Not the next frame
+	move.l #ALL_ROWS, d7
+.rows_done:
+	move.w d4, (a4)
+	rts
+.no_rows:
+	moveq #0, d7
+	rts
+
+; Copy only the spans of words changed by the frame. Needs the frame after the
+; last one copied and the spans from the RP2040, else returns with the Z flag
+; clear and the dirty rows must be copied. D1 is the resolution: 0 low, 1
+; medium and 2 high, D3, D4 and D6 as returned by read_dirty_rows. Each span
+; is used only if the generation is still D4 after reading it: two frames
+; later the RP2040 writes its spans to the same area.
+; Modifies D0, D2, D5, D6, A0-A2.
+apply_deltas:
+	tst.w d6					; The frame after the last one copied?
+	bne .deltas_exit
+	lea DELTA_ADDR, a2
+	btst #0, d4					; Odd generation?
+	beq.s .even_frame
+	lea DELTA_AREA_SIZE(a2), a2
+.even_frame:
+	move.w (a2)+, d5			; Spans
+	cmp.w #$FFFF, d5			; No spans, copy the rows
+	beq .deltas_no_spans
+	bra .next_span_start
+.next_span:
+	moveq #0, d0
+	move.w (a2)+, d0			; First word of the span, in screen order
+	move.w (a2)+, d6			; Words in the span - 1
+	cmp.w FRAME_GEN_ADDR, d4	; Read before the next frame? The one after
+	bne .deltas_late			; it rewrites this area
+	move.l d0, d2
+	add.w d2, d2				; Offset in screen order
+	add.w d3, d2				; Offset in the ring of rows
+	cmp.w #FRAMEBUFFER_SIZE, d2
+	blo.s .in_ring
+	sub.w #FRAMEBUFFER_SIZE, d2
+.in_ring:
+	move.l a6, a1				; Screen memory
+	tst.b d1
+	bne.s .span_expanded
+
+	lea FRAMEBUFFER_ADDR, a0	; Low resolution: 8 bytes per word
+	add.w d2, a0
+	lsl.l #3, d0
+	add.l d0, a1
+.span_low:
+	move.w (a0)+, d0
+	ifne DISPLAY_BYPASS_FRAMEBUFFER == 1
+	rol.w #8, d0				; swap high and low bytes
+	endif
+	move.w d0, d2
+	swap d2
+	move.w d0, d2
+	move.l d2, (a1)+			; The word in the four planes
+	move.l d2, (a1)+
+	dbf d6, .span_low
+	bra.s .next_span_start
+
+.span_expanded:
+	lea EXPANDED_ADDR, a0		; Two expanded words per word
+	add.w d2, a0
+	add.w d2, a0
+	cmp.b #2, d1
+	beq.s .span_high
+	lsl.l #3, d0				; Medium resolution: 8 bytes per word
+	add.l d0, a1
+	add.w d6, d6				; Expanded words - 1
+	addq.w #1, d6
+.span_med:
+	move.w (a0)+, d0
+	move.w d0, d2
+	swap d2
+	move.w d0, d2
+	move.l d2, (a1)+			; The expanded word in the two planes
+	dbf d6, .span_med
+	bra.s .next_span_start
+
+.span_high:
+	divu #(BYTES_ROW_HIGH / 4), d0	; Line in the low word, word in the high one
+	move.l d0, d2
+	swap d2
+	lsl.w #2, d2				; 4 bytes per word
+	add.w d2, a1
+	mulu #(BYTES_ROW_HIGH * 2), d0	; Two lines of the screen per line
+	add.l d0, a1
+.span_high_word:
+	move.l (a0)+, d0
+	move.l d0, (a1)				; The even line
+	move.l d0, BYTES_ROW_HIGH(a1)	; and the odd one
+	addq.l #4, a1
+	dbf d6, .span_high_word
+
+.next_span_start:
+	dbf d5, .next_span
+
+	cmp.w FRAME_GEN_ADDR, d4	; A new frame while copying?
+	beq.s .deltas_exit			; Z set, done
+.deltas_late:
+	lea last_frame_gen(pc), a2
+	subq.w #1, (a2)				; Copy all the rows next time
+	cmp.w d4, d4				; Z set, done
+.deltas_exit:
+	rts
+.deltas_no_spans:
+	moveq #1, d6				; Z clear, copy the rows
+	rts
+
+; Send the keys typed since the last call, up to KEYS_BATCH in each command.
+; The keys are queued in D3-D6 with the oldest first, the empty slots are 0.
+; Modifies D0-D7 and A0-A3.
+send_keys:
+	moveq #0, d3
+	moveq #0, d4
+	moveq #0, d5
+	moveq #0, d6
+	moveq #(KEYS_BATCH - 1), d7	; Keys in the batch - 1
+.next_key:
+	gemdos	Cconis,2			; Check if a key is pressed
+	tst.l d0
+	beq.s .send_batch
+
+	gemdos	Cnecin,2			; Read the key pressed
+
+	cmp.b #27, d0				; Check if the key is ESC
+	beq.s .esc_key				; If it is, send terminal command
+
+	move.l d4, d3				; Queue the key after the previous ones
+	move.l d5, d4
+	move.l d6, d5
+	move.l d0, d6
+	dbf d7, .next_key
+.send_batch:
+	tst.l d6
+	beq.s .no_keys
+	send_sync APP_TERMINAL_KEYSTROKES, 16
+.no_keys:
+	rts
+.esc_key:
+	bsr.s .send_batch			; The keys typed before ESC first
+	send_sync APP_TERMINAL_START, 0
+	rts
+
+; Generation of the last frame copied. Written in the copy of the code in RAM,
+; so always addressed relative to the PC.
+last_frame_gen:
+	dc.w 0
+	even
+
 ; Shared functions included at the end of the file
 ; Don't forget to include the macros for the shared functions at the top of file
     include "inc/sidecart_functions.s"